@@ -22,6 +22,7 @@ public class OpenPF2GameFramework : ModuleRules
 				"GameplayTags",
 				"GameplayTasks",
 				"EnhancedInput",
+				"NetCore",
 			}
 		);
 
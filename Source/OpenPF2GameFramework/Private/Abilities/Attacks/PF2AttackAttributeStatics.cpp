@@ -12,56 +12,36 @@
 #include "CharacterStats/PF2AttributeSetMacros.h"
 
 #include "Utilities/PF2ArrayUtilities.h"
-#include "Utilities/PF2GameplayAbilityUtilities.h"
-
-TArray<const FGameplayEffectAttributeCaptureDefinition*> FPF2AttackAttributeStatics::GetAllDamageCaptures() const
-{
-	return PF2ArrayUtilities::Filter(
-		this->GetCaptureDefinitions(),
-		[](const FGameplayEffectAttributeCaptureDefinition* CaptureDefinition)
-		{
-			return CaptureDefinition->AttributeToCapture.GetName().StartsWith("TmpDmgType");
-		});
-}
 
 const FGameplayEffectAttributeCaptureDefinition* FPF2AttackAttributeStatics::GetDamageCaptureForDamageType(
-	const FName& DamageTypeName) const
+	const FGameplayTag& DamageType) const
 {
-	const FGameplayEffectAttributeCaptureDefinition* Result = nullptr;
+	const FGameplayEffectAttributeCaptureDefinition* Result =
+		this->GetCaptureBySlot(this->GetDamageSlotForDamageType(DamageType));
 
-	if (this->DamageTypeToTransientDamageAttributeMap.Contains(DamageTypeName))
-	{
-		const FName ResistanceAttributeName = this->DamageTypeToTransientDamageAttributeMap[DamageTypeName];
-
-		Result = this->GetCaptureByAttributeName(ResistanceAttributeName.ToString());
-	}
-	else
+	if (Result == nullptr)
 	{
 		UE_LOG(
 			LogPf2Stats,
 			Error,
 			TEXT("No damage attribute corresponds to damage type '%s'."),
-			*(DamageTypeName.ToString())
+			*(DamageType.ToString())
 		);
 	}
 
 	return Result;
 }
 
-FGameplayTag FPF2AttackAttributeStatics::GetDamageTypeForDamageAttribute(const FGameplayAttribute& Attribute) const
+uint32 FPF2AttackAttributeStatics::GetDamageTypeMask(const FGameplayTagContainer& Tags) const
 {
-	FGameplayTag FoundTag;
+	uint32 Result = 0;
 
-	for (const auto& Pair : this->DamageTypeToTransientDamageAttributeMap)
+	for (const FGameplayTag& Tag : Tags)
 	{
-		if (Pair.Value == Attribute.AttributeName)
-		{
-			FoundTag = PF2GameplayAbilityUtilities::GetTag(Pair.Key);
-			break;
-		}
+		Result |= this->GetDamageTypeMaskBit(Tag);
 	}
 
-	return FoundTag;
+	return Result;
 }
 
 FPF2AttackAttributeStatics::FPF2AttackAttributeStatics():
@@ -140,4 +120,49 @@ FPF2AttackAttributeStatics::FPF2AttackAttributeStatics():
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2AttackAttributeSet, TmpDmgTypePoison, Source, false);
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2AttackAttributeSet, TmpDmgTypeBleed, Source, false);
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2AttackAttributeSet, TmpDmgTypePrecision, Source, false);
+
+	this->DamageCaptures = PF2ArrayUtilities::Filter(
+		this->GetCaptureDefinitions(),
+		[](const FGameplayEffectAttributeCaptureDefinition* CaptureDefinition)
+		{
+			return CaptureDefinition->AttributeToCapture.GetName().StartsWith(Damage_Attribute_Prefix);
+		});
+
+	this->DamageTypesBySlot.SetNum(this->GetNumCaptureSlots());
+
+	for (const auto& [DamageTypeName, DamageAttributeName] : this->DamageTypeToTransientDamageAttributeMap)
+	{
+		const FGameplayTag DamageType     = FGameplayTag::RequestGameplayTag(DamageTypeName, false);
+		const FProperty*   DamageProperty =
+			FindFProperty<FProperty>(UPF2AttackAttributeSet::StaticClass(), DamageAttributeName);
+
+		// Missing damage type tags were reported above.
+		if (DamageType.IsValid() && (DamageProperty != nullptr))
+		{
+			const int32 DamageSlot = this->GetSlotOfAttribute(FGameplayAttribute(DamageProperty));
+
+			if (DamageSlot != INDEX_NONE)
+			{
+				this->DamageSlotsByDamageType.Add(DamageType, DamageSlot);
+				this->DamageTypesBySlot[DamageSlot] = DamageType;
+			}
+		}
+	}
+
+	checkf(
+		this->DamageCaptures.Num() <= MaxDamageTypesInMask,
+		TEXT("There are too many damage types (%d) to fit in a damage type mask."),
+		this->DamageCaptures.Num()
+	);
+
+	for (int32 DamageIndex = 0; DamageIndex < this->DamageCaptures.Num(); ++DamageIndex)
+	{
+		const FGameplayTag DamageType =
+			this->GetDamageTypeForDamageAttribute(this->DamageCaptures[DamageIndex]->AttributeToCapture);
+
+		if (DamageType.IsValid())
+		{
+			this->DamageTypeMaskBits.Add(DamageType, 1u << DamageIndex);
+		}
+	}
 }
@@ -1,10 +1,12 @@
-// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
 //
 // This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 // distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "Actors/Components/PF2AbilitySystemComponent.h"
 
+#include <Algo/BinarySearch.h>
+
 #include <UObject/ConstructorHelpers.h>
 
 #include "OpenPF2GameFramework.h"
@@ -13,6 +15,8 @@
 
 #include "Abilities/PF2InteractableAbilityInterface.h"
 
+#include "GameplayEffects/PF2WeightGroupRegistry.h"
+
 #include "Utilities/PF2ArrayUtilities.h"
 #include "Utilities/PF2EnumUtilities.h"
 #include "Utilities/PF2InterfaceUtilities.h"
@@ -21,7 +25,11 @@
 const FName UPF2AbilitySystemComponent::DefaultMovementAbilityTagName   = FName(TEXT("GameplayAbility.Type.DefaultMovement"));
 const FName UPF2AbilitySystemComponent::DefaultFaceTargetAbilityTagName = FName(TEXT("GameplayAbility.Type.DefaultFaceTarget"));
 
-UPF2AbilitySystemComponent::UPF2AbilitySystemComponent() : Events(nullptr), bAreAbilitiesAvailable(false)
+UPF2AbilitySystemComponent::UPF2AbilitySystemComponent() :
+	Events(nullptr),
+	bAreAbilitiesAvailable(false),
+	bReapplyAllPassiveGEsOnTagChange(false),
+	DynamicTagBatchDepth(0)
 {
 	const FString DynamicTagsGeFilename =
 		PF2CharacterConstants::GetBlueprintPath(
@@ -293,10 +301,22 @@ void UPF2AbilitySystemComponent::AddPassiveGameplayEffectWithWeight(
 		this->ActivatedWeightGroups.Add(WeightGroup);
 	}
 
+	if (this->IsInDynamicTagBatch())
+	{
+		// Defer activation of the new GE (and re-application of subsequent weight groups) until the batch ends.
+		this->PassiveGameplayEffects.Add(WeightGroup, Effect);
+		this->CachedPassiveGameplayEffectsToApply.Empty();
+		this->CachedWeightGroupTagDependencies.Empty();
+
+		this->BatchedWeightGroups.Add(WeightGroup);
+		return;
+	}
+
 	this->InvokeAndReapplyPassiveGEsInSubsequentWeightGroups(WeightGroup, [this, WeightGroup, Effect]
 	{
 		this->PassiveGameplayEffects.Add(WeightGroup, Effect);
 		this->CachedPassiveGameplayEffectsToApply.Empty();
+		this->CachedWeightGroupTagDependencies.Empty();
 
 		if (this->ActivatedWeightGroups.Contains(WeightGroup))
 		{
@@ -312,6 +332,7 @@ void UPF2AbilitySystemComponent::SetPassiveGameplayEffects(const TMultiMap<FName
 	{
 		this->PassiveGameplayEffects = Effects;
 		this->CachedPassiveGameplayEffectsToApply.Empty();
+		this->CachedWeightGroupTagDependencies.Empty();
 	});
 }
 
@@ -321,22 +342,18 @@ void UPF2AbilitySystemComponent::RemoveAllPassiveGameplayEffects()
 
 	this->PassiveGameplayEffects.Empty();
 	this->CachedPassiveGameplayEffectsToApply.Empty();
+	this->CachedWeightGroupTagDependencies.Empty();
 }
 
 void UPF2AbilitySystemComponent::ActivateAllPassiveGameplayEffects()
 {
-	const TMultiMap<FName, TSubclassOf<UGameplayEffect>> EffectsToApply = this->GetPassiveGameplayEffectsToApply();
-
-	TSet<FName> AllWeightGroups,
-	            InactiveGroups;
-
-	EffectsToApply.GetKeys(AllWeightGroups);
-
-	InactiveGroups = AllWeightGroups.Difference(this->ActivatedWeightGroups);
+	// Applying a passive GE can add or remove passive GEs, which discards the cache, so iterate over a copy of it.
+	const TArray<FPF2PassiveGameplayEffectWeightGroup> Groups = this->GetPassiveGameplayEffectsToApply();
 
-	for (const auto& InactiveGroup : InactiveGroups)
+	// Weight groups are activated in weight order. ActivatePassiveGameplayEffects() skips groups that are already active.
+	for (const FPF2PassiveGameplayEffectWeightGroup& Group : Groups)
 	{
-		this->ActivatePassiveGameplayEffects(InactiveGroup);
+		this->ActivatePassiveGameplayEffects(Group.WeightGroup);
 	}
 }
 
@@ -352,21 +369,20 @@ void UPF2AbilitySystemComponent::DeactivateAllPassiveGameplayEffects()
 
 TSet<FName> UPF2AbilitySystemComponent::ActivatePassiveGameplayEffectsAfter(const FName StartingWeightGroup)
 {
-	const TMultiMap<FName, TSubclassOf<UGameplayEffect>> EffectsToApply = this->GetPassiveGameplayEffectsToApply();
+	const FPF2WeightGroupRegistry&                     WeightGroupRegistry = FPF2WeightGroupRegistry::GetInstance();
+	TSet<FName>                                        ActivatedGroups;
 
-	TSet<FName> AllWeightGroups,
-	            InactiveGroups,
-	            ActivatedGroups;
+	// Applying a passive GE can add or remove passive GEs, which discards the cache, so iterate over a copy of it.
+	const TArray<FPF2PassiveGameplayEffectWeightGroup> Groups              = this->GetPassiveGameplayEffectsToApply();
 
-	EffectsToApply.GetKeys(AllWeightGroups);
-
-	InactiveGroups = AllWeightGroups.Difference(this->ActivatedWeightGroups);
-
-	for (const auto& InactiveGroup : InactiveGroups)
+	for (const FPF2PassiveGameplayEffectWeightGroup& Group : Groups)
 	{
-		if (StartingWeightGroup.LexicalLess(InactiveGroup) && this->ActivatePassiveGameplayEffects(InactiveGroup))
+		const FName WeightGroup = Group.WeightGroup;
+
+		if (WeightGroupRegistry.IsBefore(StartingWeightGroup, WeightGroup) &&
+			this->ActivatePassiveGameplayEffects(WeightGroup))
 		{
-			ActivatedGroups.Add(InactiveGroup);
+			ActivatedGroups.Add(WeightGroup);
 		}
 	}
 
@@ -375,14 +391,16 @@ TSet<FName> UPF2AbilitySystemComponent::ActivatePassiveGameplayEffectsAfter(cons
 
 TSet<FName> UPF2AbilitySystemComponent::DeactivatePassiveGameplayEffectsAfter(const FName StartingWeightGroup)
 {
-	TSet<FName> DeactivatedGroups;
+	const FPF2WeightGroupRegistry& WeightGroupRegistry = FPF2WeightGroupRegistry::GetInstance();
+	TSet<FName>                    DeactivatedGroups;
 
 	// We have to make a copy of the set because we'll be modifying it in the loop.
 	TSet<FName> WeightGroups = this->ActivatedWeightGroups;
 
 	for (const FName& ActiveGroup : WeightGroups)
 	{
-		if (StartingWeightGroup.LexicalLess(ActiveGroup) && this->DeactivatePassiveGameplayEffects(ActiveGroup))
+		if (WeightGroupRegistry.IsBefore(StartingWeightGroup, ActiveGroup) &&
+			this->DeactivatePassiveGameplayEffects(ActiveGroup))
 		{
 			DeactivatedGroups.Add(ActiveGroup);
 		}
@@ -399,14 +417,18 @@ bool UPF2AbilitySystemComponent::ActivatePassiveGameplayEffects(const FName Weig
 	}
 	else
 	{
-		const TMultiMap<FName, TSubclassOf<UGameplayEffect>> AllEffects   = this->GetPassiveGameplayEffectsToApply();
-		TArray<TSubclassOf<UGameplayEffect>>                 GroupEffects;
+		const FPF2PassiveGameplayEffectWeightGroup* Group = this->FindPassiveGameplayEffectsToApply(WeightGroup);
 
-		AllEffects.MultiFind(WeightGroup, GroupEffects, true);
-
-		for (const auto& GameplayEffect : GroupEffects)
+		if (Group != nullptr)
 		{
-			this->ActivatePassiveGameplayEffect(WeightGroup, GameplayEffect);
+			// Applying a passive GE can add or remove passive GEs, which discards the cache that Group points into, so
+			// iterate over a copy of the GEs in the group.
+			const TArray<TSubclassOf<UGameplayEffect>> GameplayEffects = Group->GameplayEffects;
+
+			for (const auto& GameplayEffect : GameplayEffects)
+			{
+				this->ActivatePassiveGameplayEffect(WeightGroup, GameplayEffect);
+			}
 		}
 
 		this->ActivatedWeightGroups.Add(WeightGroup);
@@ -443,7 +465,7 @@ bool UPF2AbilitySystemComponent::DeactivatePassiveGameplayEffects(const FName We
 
 void UPF2AbilitySystemComponent::AddDynamicTag(const FGameplayTag Tag)
 {
-	this->InvokeAndReapplyAllPassiveGEs([this, Tag]
+	this->InvokeAndReapplyPassiveGEsAffectedByTags(FGameplayTagContainer(Tag), [this, Tag]
 	{
 		UE_LOG(
 			LogPf2Core,
@@ -459,7 +481,7 @@ void UPF2AbilitySystemComponent::AddDynamicTag(const FGameplayTag Tag)
 
 void UPF2AbilitySystemComponent::AppendDynamicTags(const FGameplayTagContainer Tags)
 {
-	this->InvokeAndReapplyAllPassiveGEs([this, Tags]
+	this->InvokeAndReapplyPassiveGEsAffectedByTags(Tags, [this, Tags]
 	{
 		UE_LOG(
 			LogPf2Core,
@@ -475,7 +497,12 @@ void UPF2AbilitySystemComponent::AppendDynamicTags(const FGameplayTagContainer T
 
 void UPF2AbilitySystemComponent::SetDynamicTags(const FGameplayTagContainer Tags)
 {
-	this->InvokeAndReapplyAllPassiveGEs([this, Tags]
+	// Both the tags being replaced and the tags replacing them could affect passive GEs.
+	FGameplayTagContainer ChangedTags = this->DynamicTags;
+
+	ChangedTags.AppendTags(Tags);
+
+	this->InvokeAndReapplyPassiveGEsAffectedByTags(ChangedTags, [this, Tags]
 	{
 		UE_LOG(
 			LogPf2Core,
@@ -491,7 +518,7 @@ void UPF2AbilitySystemComponent::SetDynamicTags(const FGameplayTagContainer Tags
 
 void UPF2AbilitySystemComponent::RemoveDynamicTag(const FGameplayTag Tag)
 {
-	this->InvokeAndReapplyAllPassiveGEs([this, Tag]
+	this->InvokeAndReapplyPassiveGEsAffectedByTags(FGameplayTagContainer(Tag), [this, Tag]
 	{
 		UE_LOG(
 			LogPf2Core,
@@ -507,7 +534,7 @@ void UPF2AbilitySystemComponent::RemoveDynamicTag(const FGameplayTag Tag)
 
 void UPF2AbilitySystemComponent::RemoveDynamicTags(const FGameplayTagContainer Tags)
 {
-	this->InvokeAndReapplyAllPassiveGEs([this, Tags]
+	this->InvokeAndReapplyPassiveGEsAffectedByTags(Tags, [this, Tags]
 	{
 		UE_LOG(
 			LogPf2Core,
@@ -523,7 +550,7 @@ void UPF2AbilitySystemComponent::RemoveDynamicTags(const FGameplayTagContainer T
 
 void UPF2AbilitySystemComponent::RemoveAllDynamicTags()
 {
-	this->InvokeAndReapplyAllPassiveGEs([this]
+	this->InvokeAndReapplyPassiveGEsAffectedByTags(this->DynamicTags, [this]
 	{
 		UE_LOG(
 			LogPf2Core,
@@ -536,6 +563,33 @@ void UPF2AbilitySystemComponent::RemoveAllDynamicTags()
 	});
 }
 
+void UPF2AbilitySystemComponent::BeginDynamicTagBatch()
+{
+	++this->DynamicTagBatchDepth;
+}
+
+void UPF2AbilitySystemComponent::EndDynamicTagBatch()
+{
+	if (this->DynamicTagBatchDepth == 0)
+	{
+		UE_LOG(
+			LogPf2Core,
+			Error,
+			TEXT("EndDynamicTagBatch() was called on ASC on character ('%s') without a matching call to BeginDynamicTagBatch()."),
+			*(GetNameSafe(this->GetOwnerActor()))
+		);
+	}
+	else
+	{
+		--this->DynamicTagBatchDepth;
+
+		if (this->DynamicTagBatchDepth == 0)
+		{
+			this->CommitDynamicTagBatch();
+		}
+	}
+}
+
 TScriptInterface<IPF2CharacterInterface> UPF2AbilitySystemComponent::GetCharacter() const
 {
 	IPF2CharacterInterface* OwningCharacter = Cast<IPF2CharacterInterface>(this->GetOwnerActor());
@@ -744,7 +798,7 @@ void UPF2AbilitySystemComponent::OnRep_ActivateAbilities()
 	this->Native_OnAbilitiesAvailable();
 }
 
-TMultiMap<FName, TSubclassOf<UGameplayEffect>> UPF2AbilitySystemComponent::GetPassiveGameplayEffectsToApply()
+const TArray<FPF2PassiveGameplayEffectWeightGroup>& UPF2AbilitySystemComponent::GetPassiveGameplayEffectsToApply()
 {
 	if (this->CachedPassiveGameplayEffectsToApply.Num() == 0)
 	{
@@ -754,19 +808,234 @@ TMultiMap<FName, TSubclassOf<UGameplayEffect>> UPF2AbilitySystemComponent::GetPa
 	return this->CachedPassiveGameplayEffectsToApply;
 }
 
-TMultiMap<FName, TSubclassOf<UGameplayEffect>> UPF2AbilitySystemComponent::BuildPassiveGameplayEffectsToApply() const
+const FPF2PassiveGameplayEffectWeightGroup* UPF2AbilitySystemComponent::FindPassiveGameplayEffectsToApply(
+	const FName WeightGroup)
 {
-	TMultiMap<FName, TSubclassOf<UGameplayEffect>> EffectsToApply = this->PassiveGameplayEffects;
+	const FPF2WeightGroupRegistry&                      WeightGroupRegistry = FPF2WeightGroupRegistry::GetInstance();
+	const TArray<FPF2PassiveGameplayEffectWeightGroup>& Groups = this->GetPassiveGameplayEffectsToApply();
+	const FPF2PassiveGameplayEffectWeightGroup*         Result = nullptr;
+
+	const int32 GroupIndex =
+		Algo::LowerBoundBy(
+			Groups,
+			WeightGroup,
+			[](const FPF2PassiveGameplayEffectWeightGroup& Group)
+			{
+				return Group.WeightGroup;
+			},
+			[&WeightGroupRegistry](const FName& Left, const FName& Right)
+			{
+				return WeightGroupRegistry.IsBefore(Left, Right);
+			}
+		);
+
+	if (Groups.IsValidIndex(GroupIndex) && (Groups[GroupIndex].WeightGroup == WeightGroup))
+	{
+		Result = &Groups[GroupIndex];
+	}
+
+	return Result;
+}
+
+TArray<FPF2PassiveGameplayEffectWeightGroup> UPF2AbilitySystemComponent::BuildPassiveGameplayEffectsToApply() const
+{
+	const FPF2WeightGroupRegistry&               WeightGroupRegistry = FPF2WeightGroupRegistry::GetInstance();
+	TArray<FPF2PassiveGameplayEffectWeightGroup> EffectsToApply;
+	TMap<FName, int32>                           GroupIndices;
+
+	auto AddEffect = [&](const FName WeightGroup, const TSubclassOf<UGameplayEffect>& Effect)
+	{
+		const int32* GroupIndex = GroupIndices.Find(WeightGroup);
+
+		if (GroupIndex == nullptr)
+		{
+			FPF2PassiveGameplayEffectWeightGroup& NewGroup = EffectsToApply.AddDefaulted_GetRef();
+
+			NewGroup.WeightGroup = WeightGroup;
+			NewGroup.Priority    = WeightGroupRegistry.GetPriority(WeightGroup);
+
+			NewGroup.GameplayEffects.Add(Effect);
+
+			GroupIndices.Add(WeightGroup, EffectsToApply.Num() - 1);
+		}
+		else
+		{
+			EffectsToApply[*GroupIndex].GameplayEffects.Add(Effect);
+		}
+	};
+
+	for (const TPair<FName, TSubclassOf<UGameplayEffect>>& EffectInfo : this->PassiveGameplayEffects)
+	{
+		AddEffect(EffectInfo.Key, EffectInfo.Value);
+	}
 
 	// Add a pseudo-GE for the dynamic tags.
-	EffectsToApply.Add(PF2CharacterConstants::GeWeightGroups::InitializeBaseStats, this->DynamicTagsEffect);
+	AddEffect(PF2CharacterConstants::GeWeightGroups::InitializeBaseStats, this->DynamicTagsEffect);
+
+	// Ensure Passive GEs are always evaluated in weight order. Each group is sorted only once here, instead of every
+	// time that the groups are enumerated.
+	EffectsToApply.StableSort(
+		[&WeightGroupRegistry](const FPF2PassiveGameplayEffectWeightGroup& Left,
+		                       const FPF2PassiveGameplayEffectWeightGroup& Right)
+		{
+			bool Result;
 
-	// Ensure Passive GEs are always evaluated in weight order.
-	EffectsToApply.KeyStableSort(FNameLexicalLess());
+			if ((Left.Priority == INDEX_NONE) || (Right.Priority == INDEX_NONE))
+			{
+				Result = WeightGroupRegistry.IsBefore(Left.WeightGroup, Right.WeightGroup);
+			}
+			else
+			{
+				Result = (Left.Priority < Right.Priority);
+			}
+
+			return Result;
+		}
+	);
 
 	return EffectsToApply;
 }
 
+void UPF2AbilitySystemComponent::CommitDynamicTagBatch()
+{
+	const FGameplayTagContainer ChangedTags  = MoveTemp(this->BatchedChangedTags);
+	const TSet<FName>           AddedGroups  = MoveTemp(this->BatchedWeightGroups);
+	const bool                  bTagsChanged = !ChangedTags.IsEmpty();
+	FName                       FirstAffectedGroup;
+	bool                        bFoundGroup;
+
+	this->BatchedChangedTags.Reset();
+	this->BatchedWeightGroups.Reset();
+
+	// If passive GEs are not active, all changes made during the batch will take effect when they are next activated.
+	if (!this->ArePassiveGameplayEffectsActive() || (!bTagsChanged && (AddedGroups.Num() == 0)))
+	{
+		return;
+	}
+
+	if (this->bReapplyAllPassiveGEsOnTagChange)
+	{
+		this->InvokeAndReapplyAllPassiveGEs([]{});
+		return;
+	}
+
+	bFoundGroup = bTagsChanged && this->FindFirstWeightGroupAffectedByTags(ChangedTags, FirstAffectedGroup);
+
+	// Passive GEs added during the batch have not been applied yet, so the earliest active group that received one must
+	// also be re-applied.
+	for (const FName& AddedGroup : AddedGroups)
+	{
+		if (this->ActivatedWeightGroups.Contains(AddedGroup) &&
+			(!bFoundGroup || FPF2WeightGroupRegistry::GetInstance().IsBefore(AddedGroup, FirstAffectedGroup)))
+		{
+			FirstAffectedGroup = AddedGroup;
+			bFoundGroup        = true;
+		}
+	}
+
+	UE_LOG(
+		LogPf2Core,
+		VeryVerbose,
+		TEXT("Committing dynamic tag batch on ASC on character ('%s') for changed tags ('%s') and %d weight group(s) with added GEs."),
+		*(GetNameSafe(this->GetOwnerActor())),
+		*(ChangedTags.ToString()),
+		AddedGroups.Num()
+	);
+
+	if (bFoundGroup)
+	{
+		this->InvokeAndReapplyPassiveGEsStartingAt(FirstAffectedGroup, []{});
+	}
+	else if (bTagsChanged)
+	{
+		// No passive GE checks for any of the changed tags, so only the GE that grants the tags has to be refreshed.
+		this->ReapplyDynamicTagsEffect();
+	}
+}
+
+const FPF2WeightGroupTagDependencies& UPF2AbilitySystemComponent::GetWeightGroupTagDependencies(const FName WeightGroup)
+{
+	FPF2WeightGroupTagDependencies* Dependencies = this->CachedWeightGroupTagDependencies.Find(WeightGroup);
+
+	if (Dependencies == nullptr)
+	{
+		const FPF2PassiveGameplayEffectWeightGroup* Group = this->FindPassiveGameplayEffectsToApply(WeightGroup);
+
+		Dependencies = &this->CachedWeightGroupTagDependencies.Add(WeightGroup);
+
+		if (Group != nullptr)
+		{
+			// Copy the GEs, for consistency with ActivatePassiveGameplayEffects(); nothing should be held across calls
+			// into the cache.
+			const TArray<TSubclassOf<UGameplayEffect>> GameplayEffects = Group->GameplayEffects;
+
+			for (const TSubclassOf<UGameplayEffect>& GameplayEffect : GameplayEffects)
+			{
+				if (!PF2GameplayAbilityUtilities::GetTagsQueriedByGameplayEffect(GameplayEffect, Dependencies->QueriedTags))
+				{
+					UE_LOG(
+						LogPf2Core,
+						VeryVerbose,
+						TEXT("Passive GE ('%s') in weight group ('%s') does not declare which tags it depends on; assuming it depends on all tags."),
+						*(GetNameSafe(GameplayEffect)),
+						*(WeightGroup.ToString())
+					);
+
+					Dependencies->bDependsOnAllTags = true;
+				}
+			}
+		}
+	}
+
+	return *Dependencies;
+}
+
+bool UPF2AbilitySystemComponent::FindFirstWeightGroupAffectedByTags(const FGameplayTagContainer& ChangedTags,
+                                                                    FName&                       OutWeightGroup)
+{
+	bool                                               bFoundGroup = false;
+	const TArray<FPF2PassiveGameplayEffectWeightGroup> Groups      = this->GetPassiveGameplayEffectsToApply();
+
+	// Weight groups are already sorted in weight order.
+	for (const FPF2PassiveGameplayEffectWeightGroup& Group : Groups)
+	{
+		const FName WeightGroup = Group.WeightGroup;
+
+		// Inactive weight groups have nothing applied that could need to be refreshed.
+		if (this->ActivatedWeightGroups.Contains(WeightGroup))
+		{
+			const FPF2WeightGroupTagDependencies& Dependencies = this->GetWeightGroupTagDependencies(WeightGroup);
+
+			// HasAny() also matches the parents of each changed tag, so a dependency on "Skill.Acrobatics" matches a
+			// change to "Skill.Acrobatics.Trained".
+			if (Dependencies.bDependsOnAllTags || ChangedTags.HasAny(Dependencies.QueriedTags))
+			{
+				OutWeightGroup = WeightGroup;
+				bFoundGroup    = true;
+				break;
+			}
+		}
+	}
+
+	return bFoundGroup;
+}
+
+void UPF2AbilitySystemComponent::ReapplyDynamicTagsEffect()
+{
+	const FName DynamicTagsWeightGroup = PF2CharacterConstants::GeWeightGroups::InitializeBaseStats;
+
+	if (this->ActivatedWeightGroups.Contains(DynamicTagsWeightGroup))
+	{
+		FGameplayEffectQuery Query;
+
+		Query.EffectSource     = this;
+		Query.EffectDefinition = this->DynamicTagsEffect;
+
+		this->RemoveActiveEffects(Query);
+		this->ActivatePassiveGameplayEffect(DynamicTagsWeightGroup, this->DynamicTagsEffect);
+	}
+}
+
 void UPF2AbilitySystemComponent::ActivatePassiveGameplayEffect(
 	const FName                        WeightGroup,
 	const TSubclassOf<UGameplayEffect> GameplayEffect)
@@ -840,6 +1109,93 @@ void UPF2AbilitySystemComponent::InvokeAndReapplyAllPassiveGEs(const Func Callab
 	}
 }
 
+template <typename Func>
+void UPF2AbilitySystemComponent::InvokeAndReapplyPassiveGEsStartingAt(const FName FirstWeightGroup, const Func Callable)
+{
+	const FPF2WeightGroupRegistry&                     WeightGroupRegistry = FPF2WeightGroupRegistry::GetInstance();
+	const TArray<FPF2PassiveGameplayEffectWeightGroup> Groups              = this->GetPassiveGameplayEffectsToApply();
+	TArray<FName>                                      GroupsToReapply;
+
+	// Passive GEs are already sorted in weight order, so the groups to re-apply end up in weight order, too.
+	for (const FPF2PassiveGameplayEffectWeightGroup& Group : Groups)
+	{
+		const FName WeightGroup = Group.WeightGroup;
+
+		if (this->ActivatedWeightGroups.Contains(WeightGroup) &&
+			!WeightGroupRegistry.IsBefore(WeightGroup, FirstWeightGroup))
+		{
+			GroupsToReapply.Add(WeightGroup);
+		}
+	}
+
+	UE_LOG(
+		LogPf2Core,
+		VeryVerbose,
+		TEXT("Re-applying %d of %d weight groups (starting at '%s') on ASC on character ('%s')."),
+		GroupsToReapply.Num(),
+		this->ActivatedWeightGroups.Num(),
+		*(FirstWeightGroup.ToString()),
+		*(GetNameSafe(this->GetOwnerActor()))
+	);
+
+	for (const FName& WeightGroup : GroupsToReapply)
+	{
+		this->DeactivatePassiveGameplayEffects(WeightGroup);
+	}
+
+	Callable();
+
+	// The dynamic tags GE must grant the new tags before any affected GE is re-applied. If its weight group is not
+	// among the groups being re-applied, it has to be refreshed on its own.
+	if (!GroupsToReapply.Contains(PF2CharacterConstants::GeWeightGroups::InitializeBaseStats))
+	{
+		this->ReapplyDynamicTagsEffect();
+	}
+
+	for (const FName& WeightGroup : GroupsToReapply)
+	{
+		this->ActivatePassiveGameplayEffects(WeightGroup);
+	}
+}
+
+template <typename Func>
+void UPF2AbilitySystemComponent::InvokeAndReapplyPassiveGEsAffectedByTags(const FGameplayTagContainer ChangedTags,
+                                                                          const Func                  Callable)
+{
+	FName FirstAffectedGroup;
+
+	if (this->IsInDynamicTagBatch())
+	{
+		// Passive GEs get re-applied once, for all changes made during the batch, when the batch ends.
+		Callable();
+
+		this->BatchedChangedTags.AppendTags(ChangedTags);
+	}
+	else if (this->bReapplyAllPassiveGEsOnTagChange || !this->ArePassiveGameplayEffectsActive())
+	{
+		this->InvokeAndReapplyAllPassiveGEs(Callable);
+	}
+	else if (!this->FindFirstWeightGroupAffectedByTags(ChangedTags, FirstAffectedGroup))
+	{
+		// No passive GE checks for any of the changed tags, so only the GE that grants the tags has to be refreshed.
+		Callable();
+
+		this->ReapplyDynamicTagsEffect();
+	}
+	else
+	{
+		UE_LOG(
+			LogPf2Core,
+			VeryVerbose,
+			TEXT("Dynamic tags ('%s') changed on ASC on character ('%s')."),
+			*(ChangedTags.ToString()),
+			*(GetNameSafe(this->GetOwnerActor()))
+		);
+
+		this->InvokeAndReapplyPassiveGEsStartingAt(FirstAffectedGroup, Callable);
+	}
+}
+
 template<typename Func>
 void UPF2AbilitySystemComponent::InvokeAndReapplyPassiveGEsInSubsequentWeightGroups(
 	const TSubclassOf<UGameplayEffect> Effect,
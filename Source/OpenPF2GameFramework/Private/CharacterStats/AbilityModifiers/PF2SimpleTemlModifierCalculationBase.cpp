@@ -17,6 +17,15 @@
 #include "CharacterStats/PF2CharacterAttributeSet.h"
 #include "CharacterStats/PF2TemlCalculation.h"
 
+FGameplayTagContainer UPF2SimpleTemlModifierCalculationBase::GetQueriedTags() const
+{
+	FGameplayTagContainer QueriedTags = Super::GetQueriedTags();
+
+	QueriedTags.AddTag(this->ProficiencyRootTag);
+
+	return QueriedTags;
+}
+
 float UPF2SimpleTemlModifierCalculationBase::DoCalculation(
 	const FGameplayEffectSpec& Spec,
 	const FGameplayAttribute   AbilityAttribute,
@@ -41,6 +41,11 @@ float UPF2AbilityCalculationBase::CalculateBaseMagnitude_Implementation(const FG
 	return Value;
 }
 
+FGameplayTagContainer UPF2AbilityCalculationBase::GetQueriedTags() const
+{
+	return FGameplayTagContainer();
+}
+
 float UPF2AbilityCalculationBase::DoCalculation(const FGameplayEffectSpec& Spec) const
 {
 	const FGameplayEffectAttributeCaptureDefinition AbilityAttributeDef = this->RelevantAttributesToCapture[0];
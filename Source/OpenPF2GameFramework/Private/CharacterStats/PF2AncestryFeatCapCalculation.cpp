@@ -13,3 +13,9 @@ float UPF2AncestryFeatCapCalculation::CalculateBaseMagnitude_Implementation(cons
 
 	return UPF2CharacterStatLibrary::CalculateAncestryFeatCap(CharacterLevel);
 }
+
+FGameplayTagContainer UPF2AncestryFeatCapCalculation::GetQueriedTags() const
+{
+	// The cap only depends on the level of the character.
+	return FGameplayTagContainer();
+}
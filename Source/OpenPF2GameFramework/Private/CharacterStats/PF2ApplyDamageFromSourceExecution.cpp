@@ -20,18 +20,58 @@
 
 #include "Libraries/PF2AbilitySystemLibrary.h"
 
+#include "Utilities/PF2DamageCueUtilities.h"
 #include "Utilities/PF2GameplayAbilityUtilities.h"
 
-UPF2ApplyDamageFromSourceExecution::UPF2ApplyDamageFromSourceExecution()
+namespace
 {
-	const FPF2AttackAttributeStatics          AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
-	const FPF2TargetCharacterAttributeStatics TargetCaptures = FPF2TargetCharacterAttributeStatics::GetInstance();
+	/**
+	 * The damage of a single type that a source is attempting to inflict on a target.
+	 */
+	struct FPF2IncomingDamageOfType
+	{
+		/**
+		 * The index of the damage capture in FPF2AttackAttributeStatics::GetAllDamageCaptures().
+		 */
+		int32 DamageIndex;
+
+		/**
+		 * The amount of this type of damage that the source is attempting to inflict.
+		 */
+		float Amount;
+
+		/**
+		 * The amount of resistance that the target has to this type of damage.
+		 */
+		float Resistance;
+	};
+}
+
+UPF2ApplyDamageFromSourceExecution::UPF2ApplyDamageFromSourceExecution() : bCoalesceDamageCues(false)
+{
+	const FPF2AttackAttributeStatics&          AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+	const FPF2TargetCharacterAttributeStatics& TargetCaptures = FPF2TargetCharacterAttributeStatics::GetInstance();
+
+	const TArray<const FGameplayEffectAttributeCaptureDefinition*>& DamageCaptures =
+		AttackCaptures.GetAllDamageCaptures();
 
 	this->RelevantAttributesToCapture.Add(AttackCaptures.TmpAttackDegreeOfSuccessDef);
+	this->ResistanceCapturesByDamageIndex.Reserve(DamageCaptures.Num());
 
-	for (const FGameplayEffectAttributeCaptureDefinition* Capture : AttackCaptures.GetAllDamageCaptures())
+	for (const FGameplayEffectAttributeCaptureDefinition* Capture : DamageCaptures)
 	{
+		const FGameplayEffectAttributeCaptureDefinition* ResistanceCapture =
+			TargetCaptures.GetResistanceCaptureForDamageAttribute(Capture->AttributeToCapture);
+
 		this->RelevantAttributesToCapture.Add(*Capture);
+
+		// The resistance of the target can only be captured if it is declared as relevant to this execution.
+		if (ResistanceCapture != nullptr)
+		{
+			this->RelevantAttributesToCapture.AddUnique(*ResistanceCapture);
+		}
+
+		this->ResistanceCapturesByDamageIndex.Add(ResistanceCapture);
 	}
 
 	// Cache the tag to avoid lookup overhead.
@@ -44,11 +84,19 @@ void UPF2ApplyDamageFromSourceExecution::Execute_Implementation(
 	const FGameplayEffectCustomExecutionParameters& ExecutionParams,
 	FGameplayEffectCustomExecutionOutput&           OutExecutionOutput) const
 {
-	UAbilitySystemComponent*                  TargetAsc             = ExecutionParams.GetTargetAbilitySystemComponent();
-	const FPF2AttackAttributeStatics          AttackCaptures        = FPF2AttackAttributeStatics::GetInstance();
-	const FPF2TargetCharacterAttributeStatics TargetCaptures        = FPF2TargetCharacterAttributeStatics::GetInstance();
-	float                                     AttackDegreeOfSuccess = 0.0f;
-	bool                                      bHaveAnyDamage        = false;
+	UAbilitySystemComponent*                   TargetAsc             = ExecutionParams.GetTargetAbilitySystemComponent();
+	const FPF2AttackAttributeStatics&          AttackCaptures        = FPF2AttackAttributeStatics::GetInstance();
+	const FPF2TargetCharacterAttributeStatics& TargetCaptures        = FPF2TargetCharacterAttributeStatics::GetInstance();
+	const uint32                               DamageTypeMask        = GetDamageTypeMaskOfSpec(ExecutionParams);
+	float                                      AttackDegreeOfSuccess = 0.0f;
+	bool                                       bHaveAnyDamage        = false;
+
+	const TArray<const FGameplayEffectAttributeCaptureDefinition*>& DamageCaptures =
+		AttackCaptures.GetAllDamageCaptures();
+
+	// Most attacks inflict only one or two types of damage, so these should rarely need to allocate.
+	TArray<FPF2IncomingDamageOfType, TInlineAllocator<4>> IncomingDamages;
+	TArray<TPair<FGameplayTag, float>, TInlineAllocator<4>> InflictedDamages;
 
 	const FAggregatorEvaluateParameters EvaluationParameters =
 		UPF2AbilitySystemLibrary::BuildEvaluationParameters(ExecutionParams);
@@ -69,29 +117,45 @@ void UPF2ApplyDamageFromSourceExecution::Execute_Implementation(
 		)
 	);
 
-	for (const FGameplayEffectAttributeCaptureDefinition* Capture : AttackCaptures.GetAllDamageCaptures())
+	// Capture: Amount of each type of damage that the source has attempted against the target. Only types of damage in
+	// the mask are evaluated, and types that amount to no damage are dropped so that their resistances are never
+	// captured.
+	for (uint32 RemainingMask = DamageTypeMask; RemainingMask != 0; RemainingMask &= (RemainingMask - 1))
 	{
-		FString DamageAttributeName            = Capture->AttributeToCapture.AttributeName;
-		float   AmountFromDamageType           = 0.0f,
-		        AmountOfResistanceToDamageType = 0.0f,
-		        EffectiveDamage;
+		const int32 DamageIndex          = FMath::CountTrailingZeros(RemainingMask);
+		float       AmountFromDamageType = 0.0f;
 
-		const FGameplayEffectAttributeCaptureDefinition* ResistanceCapture =
-			TargetCaptures.GetResistanceCaptureForDamageAttribute(DamageAttributeName);
-
-		// Capture: Amount of this type of damage source has attempted against the target.
 		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-			*Capture,
+			*DamageCaptures[DamageIndex],
 			EvaluationParameters,
 			AmountFromDamageType
 		);
 
-		// Capture: Amount of resistance that the target has for this type of damage.
-		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-			*ResistanceCapture,
-			EvaluationParameters,
-			AmountOfResistanceToDamageType
-		);
+		if (AmountFromDamageType > 0.0f)
+		{
+			IncomingDamages.Add({DamageIndex, AmountFromDamageType, 0.0f});
+		}
+	}
+
+	// Capture: Amount of resistance that the target has for each type of damage that the source has inflicted.
+	for (FPF2IncomingDamageOfType& IncomingDamage : IncomingDamages)
+	{
+		const FGameplayEffectAttributeCaptureDefinition* ResistanceCapture =
+			this->ResistanceCapturesByDamageIndex[IncomingDamage.DamageIndex];
+
+		if (ResistanceCapture != nullptr)
+		{
+			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
+				*ResistanceCapture,
+				EvaluationParameters,
+				IncomingDamage.Resistance
+			);
+		}
+	}
+
+	for (const FPF2IncomingDamageOfType& IncomingDamage : IncomingDamages)
+	{
+		const FGameplayEffectAttributeCaptureDefinition* Capture = DamageCaptures[IncomingDamage.DamageIndex];
 
 		// Apply resistance to reduce damage, but don't allow resistance to make damage negative (i.e., damage can never
 		// heal, but it can become ineffectual).
@@ -99,22 +163,22 @@ void UPF2ApplyDamageFromSourceExecution::Execute_Implementation(
 		// From the Pathfinder 2E Core Rulebook, page 453, "Resistance":
 		// "If you have resistance to a type of damage, each time you take that type of damage, you reduce the amount of
 		// damage you take by the listed amount (to a minimum of 0 damage)."
-		EffectiveDamage = FMath::Max(0.0f, AmountFromDamageType - AmountOfResistanceToDamageType);
+		const float EffectiveDamage = FMath::Max(0.0f, IncomingDamage.Amount - IncomingDamage.Resistance);
 
 		UE_LOG(
 			LogPf2Stats,
 			VeryVerbose,
-			TEXT("Damage (%s: %f) - Resistance (%s: %f) = %f (CLAMPED >= 0)."),
-			*DamageAttributeName,
-			AmountFromDamageType,
-			*ResistanceCapture->AttributeToCapture.GetName(),
-			AmountOfResistanceToDamageType,
+			TEXT("Damage (%s: %f) - Resistance (%f) = %f (CLAMPED >= 0)."),
+			*(Capture->AttributeToCapture.GetName()),
+			IncomingDamage.Amount,
+			IncomingDamage.Resistance,
 			EffectiveDamage
 		);
 
 		if (EffectiveDamage > 0)
 		{
-			FGameplayCueParameters CueParams = PopulateGameplayCueParameters(ExecutionParams);
+			const FGameplayTag DamageType =
+				AttackCaptures.GetDamageTypeForDamageAttribute(Capture->AttributeToCapture);
 
 			// Apply: Damage, less resistance.
 			OutExecutionOutput.AddOutputModifier(
@@ -127,15 +191,22 @@ void UPF2ApplyDamageFromSourceExecution::Execute_Implementation(
 
 			bHaveAnyDamage = true;
 
+			if (this->bCoalesceDamageCues)
+			{
+				// Cues for all types of damage are emitted together, after all damage has been evaluated.
+				InflictedDamages.Add({DamageType, EffectiveDamage});
+				continue;
+			}
+
+			FGameplayCueParameters CueParams = PopulateGameplayCueParameters(ExecutionParams);
+
 			// For now, pass the damage type along as a source tag. These feels like a hack, but saves us from having to
 			// define a custom parameter object and/or context object to pass along inside the parameter object.
 			//
 			// An alternative would be to pass the damage type along in the OriginalTag field, but the intent of that
 			// field appears to be to capture what gameplay tag was emitted by a GE to locate the cue. The
 			// MatchedTagName field, meanwhile, appears to be for holding the name of the tag that the selected cue has.
-			CueParams.AggregatedSourceTags.AddTag(
-				AttackCaptures.GetDamageTypeForDamageAttribute(Capture->AttributeToCapture)
-			);
+			CueParams.AggregatedSourceTags.AddTag(DamageType);
 
 			CueParams.RawMagnitude = EffectiveDamage;
 
@@ -146,6 +217,11 @@ void UPF2ApplyDamageFromSourceExecution::Execute_Implementation(
 		}
 	}
 
+	if (!InflictedDamages.IsEmpty())
+	{
+		this->ExecuteCoalescedDamageCues(ExecutionParams, InflictedDamages);
+	}
+
 	if (!bHaveAnyDamage)
 	{
 		// Fire off a cue for a miss (no damage), so that the player can see a zero.
@@ -159,3 +235,41 @@ void UPF2ApplyDamageFromSourceExecution::Execute_Implementation(
 		);
 	}
 }
+
+uint32 UPF2ApplyDamageFromSourceExecution::GetDamageTypeMaskOfSpec(
+	const FGameplayEffectCustomExecutionParameters& ExecutionParams)
+{
+	const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+	uint32                            Result         =
+		AttackCaptures.GetDamageTypeMask(ExecutionParams.GetOwningSpec().GetDynamicAssetTags());
+
+	if (Result == 0)
+	{
+		// The spec does not indicate what types of damage it inflicts, so we have to evaluate all of them.
+		Result = AttackCaptures.GetAllDamageTypesMask();
+	}
+
+	return Result;
+}
+
+void UPF2ApplyDamageFromSourceExecution::ExecuteCoalescedDamageCues(
+	const FGameplayEffectCustomExecutionParameters&    ExecutionParams,
+	const TConstArrayView<TPair<FGameplayTag, float>>& DamageByType) const
+{
+	UAbilitySystemComponent* TargetAsc            = ExecutionParams.GetTargetAbilitySystemComponent();
+	const int32              MaxDamageTypesPerCue = PF2DamageCueUtilities::MaxDamageTypesPerCue;
+
+	// Each cue can only carry so many types of damage, so an unusually varied hit gets split across multiple cues.
+	for (int32 StartIndex = 0; StartIndex < DamageByType.Num(); StartIndex += MaxDamageTypesPerCue)
+	{
+		FGameplayCueParameters CueParams      = PopulateGameplayCueParameters(ExecutionParams);
+		const int32            NumDamageTypes = FMath::Min(MaxDamageTypesPerCue, DamageByType.Num() - StartIndex);
+
+		PF2DamageCueUtilities::PackDamageByType(DamageByType.Slice(StartIndex, NumDamageTypes), CueParams);
+
+		TargetAsc->ExecuteGameplayCue(
+			this->InflictDamageCueTag,
+			CueParams
+		);
+	}
+}
@@ -21,6 +21,18 @@
 
 #include "Utilities/PF2GameplayAbilityUtilities.h"
 
+UPF2ArmorClassCalculation::FArmorTypeTags::FArmorTypeTags() :
+	EquippedTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Equipped")))),
+	EquippedLightTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Equipped.Light")))),
+	EquippedMediumTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Equipped.Medium")))),
+	EquippedHeavyTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Equipped.Heavy")))),
+	CategoryUnarmoredTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Category.Unarmored")))),
+	CategoryLightTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Category.Light")))),
+	CategoryMediumTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Category.Medium")))),
+	CategoryHeavyTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Category.Heavy"))))
+{
+}
+
 UPF2ArmorClassCalculation::UPF2ArmorClassCalculation() :
 	DexterityModifierCaptureDefinition(FPF2TargetCharacterAttributeStatics::GetInstance().AbDexterityModifierDef)
 {
@@ -53,6 +65,16 @@ float UPF2ArmorClassCalculation::CalculateBaseMagnitude_Implementation(const FGa
 	return AbilityScore;
 }
 
+FGameplayTagContainer UPF2ArmorClassCalculation::GetQueriedTags() const
+{
+	FGameplayTagContainer QueriedTags;
+
+	QueriedTags.AddTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Equipped"))));
+	QueriedTags.AddTag(PF2GameplayAbilityUtilities::GetTag(FName(TEXT("Armor.Category"))));
+
+	return QueriedTags;
+}
+
 FORCEINLINE float UPF2ArmorClassCalculation::GetDexterityModifier(const FGameplayEffectSpec& Spec) const
 {
 	float DexterityModifier = 0.0f;
@@ -73,8 +95,7 @@ FORCEINLINE float UPF2ArmorClassCalculation::GetDexterityModifier(const FGamepla
 float UPF2ArmorClassCalculation::CalculateArmorTypeProficiencyBonus(const FGameplayEffectSpec& Spec) const
 {
 	const FGameplayTagContainer* SourceTags                 = Spec.CapturedSourceTags.GetAggregatedTags();
-	const FString                ArmorType                  = DetermineArmorType(SourceTags),
-	                             ArmorTypeProficiencyPrefix = "Armor.Category." + ArmorType;
+	const FGameplayTag           ArmorTypeProficiencyPrefix = DetermineArmorType(SourceTags);
 
 	const float ProficiencyBonus = FPF2TemlCalculation(ArmorTypeProficiencyPrefix, Spec).GetValue();
 
@@ -82,32 +103,35 @@ float UPF2ArmorClassCalculation::CalculateArmorTypeProficiencyBonus(const FGamep
 		LogPf2Stats,
 		VeryVerbose,
 		TEXT("Calculated armor proficiency bonus ('%s'): %f"),
-		*(ArmorType),
+		*(ArmorTypeProficiencyPrefix.ToString()),
 		ProficiencyBonus
 	);
 
 	return ProficiencyBonus;
 }
 
-FString UPF2ArmorClassCalculation::DetermineArmorType(const FGameplayTagContainer* SourceTags) const
+FGameplayTag UPF2ArmorClassCalculation::DetermineArmorType(const FGameplayTagContainer* SourceTags) const
 {
+	// Resolved once, rather than by name on every evaluation.
+	static const FArmorTypeTags ArmorTypeTags;
+
 	// Default to no armor.
-	FString ArmorType = "Unarmored";
+	FGameplayTag ArmorType = ArmorTypeTags.CategoryUnarmoredTag;
 
 	// Bypass additional checks if the character has no armor equipped, to avoid checking every armor type.
-	if (PF2GameplayAbilityUtilities::HasTag(SourceTags, FName("Armor.Equipped")))
+	if (SourceTags->HasTag(ArmorTypeTags.EquippedTag))
 	{
-		if (PF2GameplayAbilityUtilities::HasTag(SourceTags, FName("Armor.Equipped.Heavy")))
+		if (SourceTags->HasTag(ArmorTypeTags.EquippedHeavyTag))
 		{
-			ArmorType = "Heavy";
+			ArmorType = ArmorTypeTags.CategoryHeavyTag;
 		}
-		else if (PF2GameplayAbilityUtilities::HasTag(SourceTags, FName("Armor.Equipped.Medium")))
+		else if (SourceTags->HasTag(ArmorTypeTags.EquippedMediumTag))
 		{
-			ArmorType = "Medium";
+			ArmorType = ArmorTypeTags.CategoryMediumTag;
 		}
-		else if (PF2GameplayAbilityUtilities::HasTag(SourceTags, FName("Armor.Equipped.Light")))
+		else if (SourceTags->HasTag(ArmorTypeTags.EquippedLightTag))
 		{
-			ArmorType = "Light";
+			ArmorType = ArmorTypeTags.CategoryLightTag;
 		}
 	}
 
@@ -0,0 +1,228 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "CharacterStats/PF2AttributeSnapshot.h"
+
+#include <AbilitySystemComponent.h>
+#include <AttributeSet.h>
+
+#include "OpenPF2GameFramework.h"
+
+namespace
+{
+	/**
+	 * Serializes a single attribute value, as a 16-bit integer if it is a whole number that fits in 16 bits.
+	 *
+	 * @param Ar
+	 *	The archive being serialized to or from.
+	 * @param Value
+	 *	The value being serialized or deserialized.
+	 */
+	void SerializeQuantizedValue(FArchive& Ar, float& Value)
+	{
+		uint8 bIsQuantized   = 0;
+		int16 QuantizedValue = 0;
+
+		if (Ar.IsSaving())
+		{
+			const float RoundedValue = FMath::RoundToFloat(Value);
+
+			bIsQuantized =
+				(RoundedValue == Value) && (RoundedValue >= MIN_int16) && (RoundedValue <= MAX_int16) ? 1 : 0;
+
+			QuantizedValue = bIsQuantized ? static_cast<int16>(RoundedValue) : 0;
+		}
+
+		Ar.SerializeBits(&bIsQuantized, 1);
+
+		if (bIsQuantized)
+		{
+			Ar << QuantizedValue;
+
+			if (Ar.IsLoading())
+			{
+				Value = static_cast<float>(QuantizedValue);
+			}
+		}
+		else
+		{
+			Ar << Value;
+		}
+	}
+}
+
+bool FPF2AttributeSnapshotItem::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 bCurrentMatchesBase = (this->CurrentValue == this->BaseValue) ? 1 : 0;
+
+	Ar << this->AttributeIndex;
+
+	SerializeQuantizedValue(Ar, this->BaseValue);
+
+	// Most attributes have no active modifiers, so the current value is usually identical to the base value.
+	Ar.SerializeBits(&bCurrentMatchesBase, 1);
+
+	if (bCurrentMatchesBase)
+	{
+		this->CurrentValue = this->BaseValue;
+	}
+	else
+	{
+		SerializeQuantizedValue(Ar, this->CurrentValue);
+	}
+
+	bOutSuccess = !Ar.IsError();
+
+	return true;
+}
+
+void FPF2AttributeSnapshotItem::PostReplicatedAdd(const FPF2AttributeSnapshot& InArraySerializer)
+{
+	InArraySerializer.ApplyItem(*this);
+}
+
+void FPF2AttributeSnapshotItem::PostReplicatedChange(const FPF2AttributeSnapshot& InArraySerializer)
+{
+	InArraySerializer.ApplyItem(*this);
+}
+
+const TArray<FProperty*>& FPF2AttributeSnapshot::GetSnapshotAttributes(const UClass* AttributeSetClass)
+{
+	// Attribute tables are built once per class, on the game thread, the first time a snapshot of the class is used.
+	static TMap<const UClass*, TArray<FProperty*>> AttributesByClass;
+
+	TArray<FProperty*>* Attributes = AttributesByClass.Find(AttributeSetClass);
+
+	if (Attributes == nullptr)
+	{
+		Attributes = &AttributesByClass.Add(AttributeSetClass);
+
+		for (TFieldIterator<FStructProperty> PropertyIt(AttributeSetClass); PropertyIt; ++PropertyIt)
+		{
+			FStructProperty* Property = *PropertyIt;
+
+			if (Property->HasAnyPropertyFlags(CPF_Net) &&
+				Property->Struct->IsChildOf(FGameplayAttributeData::StaticStruct()))
+			{
+				Attributes->Add(Property);
+			}
+		}
+
+		checkf(
+			Attributes->Num() <= (MAX_uint8 + 1),
+			TEXT("Attribute set '%s' has too many attributes (%d) to replicate in a snapshot."),
+			*(AttributeSetClass->GetName()),
+			Attributes->Num()
+		);
+	}
+
+	return *Attributes;
+}
+
+int32 FPF2AttributeSnapshot::GetAttributeIndex(const UClass* AttributeSetClass, const FProperty* AttributeProperty)
+{
+	return GetSnapshotAttributes(AttributeSetClass).IndexOfByKey(AttributeProperty);
+}
+
+bool FPF2AttributeSnapshot::RecordAttribute(const FProperty* AttributeProperty)
+{
+	bool                 bChanged     = false;
+	const UAttributeSet* AttributeSet = this->OwningAttributeSet;
+
+	if ((AttributeSet != nullptr) && (AttributeProperty != nullptr))
+	{
+		const int32 AttributeIndex = GetAttributeIndex(AttributeSet->GetClass(), AttributeProperty);
+
+		if (AttributeIndex != INDEX_NONE)
+		{
+			const FGameplayAttributeData* AttributeData =
+				AttributeProperty->ContainerPtrToValuePtr<FGameplayAttributeData>(AttributeSet);
+
+			if (this->ItemPositionsByAttribute.Num() <= AttributeIndex)
+			{
+				this->ItemPositionsByAttribute.Init(INDEX_NONE, GetSnapshotAttributes(AttributeSet->GetClass()).Num());
+
+				for (int32 ItemPosition = 0; ItemPosition < this->Items.Num(); ++ItemPosition)
+				{
+					this->ItemPositionsByAttribute[this->Items[ItemPosition].AttributeIndex] = ItemPosition;
+				}
+			}
+
+			int32& ItemPosition = this->ItemPositionsByAttribute[AttributeIndex];
+
+			if (ItemPosition == INDEX_NONE)
+			{
+				ItemPosition = this->Items.AddDefaulted();
+
+				this->Items[ItemPosition].AttributeIndex = static_cast<uint8>(AttributeIndex);
+				this->Items[ItemPosition].BaseValue      = AttributeData->GetBaseValue();
+				this->Items[ItemPosition].CurrentValue   = AttributeData->GetCurrentValue();
+
+				this->MarkItemDirty(this->Items[ItemPosition]);
+
+				bChanged = true;
+			}
+			else
+			{
+				FPF2AttributeSnapshotItem& Item = this->Items[ItemPosition];
+
+				if ((Item.BaseValue != AttributeData->GetBaseValue()) ||
+					(Item.CurrentValue != AttributeData->GetCurrentValue()))
+				{
+					Item.BaseValue    = AttributeData->GetBaseValue();
+					Item.CurrentValue = AttributeData->GetCurrentValue();
+
+					this->MarkItemDirty(Item);
+
+					bChanged = true;
+				}
+			}
+		}
+	}
+
+	return bChanged;
+}
+
+void FPF2AttributeSnapshot::ApplyItem(const FPF2AttributeSnapshotItem& Item) const
+{
+	UAttributeSet* AttributeSet = this->OwningAttributeSet;
+
+	if (AttributeSet != nullptr)
+	{
+		const TArray<FProperty*>& Attributes = GetSnapshotAttributes(AttributeSet->GetClass());
+
+		if (Attributes.IsValidIndex(Item.AttributeIndex))
+		{
+			FProperty*                   AttributeProperty = Attributes[Item.AttributeIndex];
+			UAbilitySystemComponent*     OwningAsc         = AttributeSet->GetOwningAbilitySystemComponent();
+			FGameplayAttributeData*      AttributeData     =
+				AttributeProperty->ContainerPtrToValuePtr<FGameplayAttributeData>(AttributeSet);
+			const FGameplayAttributeData OldValue          = *AttributeData;
+
+			AttributeData->SetBaseValue(Item.BaseValue);
+			AttributeData->SetCurrentValue(Item.CurrentValue);
+
+			// This mirrors what GAMEPLAYATTRIBUTE_REPNOTIFY() does when an attribute is replicated as its own property.
+			if (OwningAsc != nullptr)
+			{
+				OwningAsc->SetBaseAttributeValueFromReplication(
+					FGameplayAttribute(AttributeProperty),
+					*AttributeData,
+					OldValue
+				);
+			}
+		}
+		else
+		{
+			UE_LOG(
+				LogPf2Stats,
+				Error,
+				TEXT("Attribute snapshot for '%s' references an attribute index (%d) that does not exist."),
+				*(AttributeSet->GetName()),
+				Item.AttributeIndex
+			);
+		}
+	}
+}
@@ -1,4 +1,4 @@
-// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
 //
 // Content from Pathfinder 2nd Edition is licensed under the Open Game License (OGL) v1.0a, subject to the following:
 //   - Open Game License v 1.0a, Copyright 2000, Wizards of the Coast, Inc.
@@ -18,6 +18,7 @@
 #include <GameFramework/Controller.h>
 
 #include <Net/UnrealNetwork.h>
+#include <Net/Core/PushModel/PushModel.h>
 
 #include "OpenPF2GameFramework.h"
 #include "PF2CharacterInterface.h"
@@ -26,6 +27,64 @@
 
 #include "Utilities/PF2InterfaceUtilities.h"
 
+namespace
+{
+	/**
+	 * Builds the replication parameters for an attribute that belongs to the given replication tier.
+	 *
+	 * Most attributes (e.g., ability scores, proficiency ranks, and resistances) change only a few times per session,
+	 * so attributes are push-based to spare the net driver from comparing every attribute on every net update.
+	 * Attributes are marked dirty whenever their base or current value changes (see
+	 * UPF2CharacterAttributeSet::MarkAttributeDirty()). If push-model replication is disabled for the project, the
+	 * engine falls back to comparing these properties as usual.
+	 *
+	 * @param Tier
+	 *	The tier of the attribute being registered for replication.
+	 * @param bReplicatedBySnapshot
+	 *	Whether attributes in the "Everyone" tier are replicated through the attribute snapshot of the set instead of
+	 *	as separate properties.
+	 *
+	 * @return
+	 *	The parameters with which to register the attribute.
+	 */
+	FDoRepLifetimeParams MakeAttributeReplicationParams(const EPF2AttributeReplicationTier Tier,
+	                                                    const bool                         bReplicatedBySnapshot)
+	{
+		FDoRepLifetimeParams Params;
+
+		Params.bIsPushBased = true;
+
+		switch (Tier)
+		{
+			default:
+			case EPF2AttributeReplicationTier::Everyone:
+				Params.Condition = bReplicatedBySnapshot ? COND_Never : COND_None;
+				break;
+
+			case EPF2AttributeReplicationTier::Owner:
+				Params.Condition = COND_OwnerOnly;
+				break;
+
+			case EPF2AttributeReplicationTier::ServerOnly:
+				Params.Condition = COND_Never;
+				break;
+		}
+
+		return Params;
+	}
+}
+
+// Registers an attribute of UPF2CharacterAttributeSet for replication according to its replication tier.
+#define DOREPLIFETIME_PF2_ATTRIBUTE(PropertyName) \
+	DOREPLIFETIME_WITH_PARAMS_FAST( \
+		UPF2CharacterAttributeSet, \
+		PropertyName, \
+		MakeAttributeReplicationParams( \
+			this->GetReplicationTierOfAttribute(GET_MEMBER_NAME_CHECKED(UPF2CharacterAttributeSet, PropertyName)), \
+			this->bReplicateAttributesAsSnapshot \
+		) \
+	)
+
 UPF2CharacterAttributeSet::UPF2CharacterAttributeSet() :
 	Experience(0.0f),
 	AbBoostCount(0.0f),
@@ -98,90 +157,176 @@ UPF2CharacterAttributeSet::UPF2CharacterAttributeSet() :
 	EncMaxActionPoints(0.0f),
 	EncReactionPoints(0.0f),
 	EncMaxReactionPoints(0.0f),
-	TmpDamageIncoming(0.0f)
+	TmpDamageIncoming(0.0f),
+	bReplicateAttributesAsSnapshot(false)
 {
 	// Cache the tags to avoid lookup overhead.
 	this->DamageReceivedEventTag   = PF2GameplayAbilityUtilities::GetTag(DamageReceivedEventTagName);
 	this->HitPointsChangedEventTag = PF2GameplayAbilityUtilities::GetTag(HitPointsChangedEventTagName);
+
+	this->RegisterAttributeExecutedHandler(
+		GetTmpDamageIncomingAttribute(),
+		FPF2AttributeExecutedDelegate::CreateWeakLambda(
+			this,
+			[this](const FGameplayEffectSpec& SourceEffectSpec, IPF2CharacterInterface* TargetCharacter, const float)
+			{
+				this->Native_OnDamageIncomingChanged(SourceEffectSpec, TargetCharacter);
+			}
+		)
+	);
+
+	this->RegisterAttributeExecutedHandler(
+		GetHitPointsAttribute(),
+		FPF2AttributeExecutedDelegate::CreateUObject(this, &UPF2CharacterAttributeSet::Native_OnHitPointsChanged)
+	);
+
+	this->RegisterAttributeExecutedHandler(
+		GetSpeedAttribute(),
+		FPF2AttributeExecutedDelegate::CreateUObject(this, &UPF2CharacterAttributeSet::Native_OnSpeedChanged)
+	);
+
+	this->RegisterAttributeExecutedHandler(
+		GetEncMultipleAttackPenaltyAttribute(),
+		FPF2AttributeExecutedDelegate::CreateWeakLambda(
+			this,
+			[this](const FGameplayEffectSpec& SourceEffectSpec,
+			       IPF2CharacterInterface*    TargetCharacter,
+			       const float                ValueDelta)
+			{
+				this->Native_OnMultipleAttackPenaltyChanged(SourceEffectSpec, TargetCharacter, ValueDelta);
+			}
+		)
+	);
+}
+
+void UPF2CharacterAttributeSet::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// This is done after properties have been initialized so that the snapshot cannot end up pointing at the archetype.
+	this->AttributeSnapshot.SetOwningAttributeSet(this);
 }
 
 void UPF2CharacterAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
+	FDoRepLifetimeParams SnapshotParams;
+
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(UPF2CharacterAttributeSet, Experience);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbBoostCount);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbBoostLimit);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbStrength);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbStrengthModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbDexterity);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbDexterityModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbConstitution);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbConstitutionModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbIntelligence);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbIntelligenceModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbWisdom);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbWisdomModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbCharisma);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, AbCharismaModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, ClassDifficultyClass);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, Speed);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, MaxSpeed);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, Reach);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, ArmorClass);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, StFortitudeModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, StReflexModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, StWillModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, HitPoints);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, MaxHitPoints);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstPhysicalBludgeoning);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstPhysicalPiercing);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstPhysicalSlashing);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyAcid);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyCold);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyElectricity);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyFire);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergySonic);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyPositive);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyNegative);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstEnergyForce);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstAlignmentChaotic);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstAlignmentEvil);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstAlignmentGood);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstAlignmentLawful);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstMental);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstPoison);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstBleed);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, RstPrecision);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, PerceptionModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkAcrobaticsModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkArcanaModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkAthleticsModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkCraftingModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkDeceptionModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkDiplomacyModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkIntimidationModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkLore1Modifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkLore2Modifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkMedicineModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkNatureModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkOccultismModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkPerformanceModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkReligionModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkSocietyModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkStealthModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkSurvivalModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SkThieveryModifier);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SpellAttackRoll);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, SpellDifficultyClass);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, FeAncestryFeatCount);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, FeAncestryFeatLimit);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, EncActionPoints);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, EncMaxActionPoints);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, EncReactionPoints);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, EncMaxReactionPoints);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, EncMultipleAttackPenalty);
-	DOREPLIFETIME(UPF2CharacterAttributeSet, EncMaxMultipleAttackPenalty);
+	SnapshotParams.bIsPushBased = true;
+	SnapshotParams.Condition    = this->bReplicateAttributesAsSnapshot ? COND_None : COND_Never;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UPF2CharacterAttributeSet, AttributeSnapshot, SnapshotParams);
+
+	DOREPLIFETIME_PF2_ATTRIBUTE(Experience);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbBoostCount);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbBoostLimit);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbStrength);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbStrengthModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbDexterity);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbDexterityModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbConstitution);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbConstitutionModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbIntelligence);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbIntelligenceModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbWisdom);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbWisdomModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbCharisma);
+	DOREPLIFETIME_PF2_ATTRIBUTE(AbCharismaModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(ClassDifficultyClass);
+	DOREPLIFETIME_PF2_ATTRIBUTE(Speed);
+	DOREPLIFETIME_PF2_ATTRIBUTE(MaxSpeed);
+	DOREPLIFETIME_PF2_ATTRIBUTE(Reach);
+	DOREPLIFETIME_PF2_ATTRIBUTE(ArmorClass);
+	DOREPLIFETIME_PF2_ATTRIBUTE(StFortitudeModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(StReflexModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(StWillModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(HitPoints);
+	DOREPLIFETIME_PF2_ATTRIBUTE(MaxHitPoints);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstPhysicalBludgeoning);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstPhysicalPiercing);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstPhysicalSlashing);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyAcid);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyCold);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyElectricity);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyFire);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergySonic);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyPositive);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyNegative);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstEnergyForce);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstAlignmentChaotic);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstAlignmentEvil);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstAlignmentGood);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstAlignmentLawful);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstMental);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstPoison);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstBleed);
+	DOREPLIFETIME_PF2_ATTRIBUTE(RstPrecision);
+	DOREPLIFETIME_PF2_ATTRIBUTE(PerceptionModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkAcrobaticsModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkArcanaModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkAthleticsModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkCraftingModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkDeceptionModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkDiplomacyModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkIntimidationModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkLore1Modifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkLore2Modifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkMedicineModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkNatureModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkOccultismModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkPerformanceModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkReligionModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkSocietyModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkStealthModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkSurvivalModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SkThieveryModifier);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SpellAttackRoll);
+	DOREPLIFETIME_PF2_ATTRIBUTE(SpellDifficultyClass);
+	DOREPLIFETIME_PF2_ATTRIBUTE(FeAncestryFeatCount);
+	DOREPLIFETIME_PF2_ATTRIBUTE(FeAncestryFeatLimit);
+	DOREPLIFETIME_PF2_ATTRIBUTE(EncActionPoints);
+	DOREPLIFETIME_PF2_ATTRIBUTE(EncMaxActionPoints);
+	DOREPLIFETIME_PF2_ATTRIBUTE(EncReactionPoints);
+	DOREPLIFETIME_PF2_ATTRIBUTE(EncMaxReactionPoints);
+	DOREPLIFETIME_PF2_ATTRIBUTE(EncMultipleAttackPenalty);
+	DOREPLIFETIME_PF2_ATTRIBUTE(EncMaxMultipleAttackPenalty);
+}
+
+EPF2AttributeReplicationTier UPF2CharacterAttributeSet::GetReplicationTierOfAttribute(const FName& AttributeName) const
+{
+	EPF2AttributeReplicationTier        Result       = EPF2AttributeReplicationTier::Everyone;
+	const EPF2AttributeReplicationTier* OverrideTier = this->ReplicationTierOverrides.Find(AttributeName);
+
+	if (OverrideTier != nullptr)
+	{
+		Result = *OverrideTier;
+	}
+	else
+	{
+		const EPF2AttributeReplicationTier* DefaultTier = DefaultReplicationTiers.Find(AttributeName);
+
+		if (DefaultTier != nullptr)
+		{
+			Result = *DefaultTier;
+		}
+	}
+
+	return Result;
+}
+
+void UPF2CharacterAttributeSet::RegisterAttributeExecutedHandler(const FGameplayAttribute&            Attribute,
+                                                                 const FPF2AttributeExecutedDelegate& Handler)
+{
+	const FProperty* AttributeProperty = Attribute.GetUProperty();
+
+	checkf(
+		(AttributeProperty != nullptr) && this->GetClass()->IsChildOf(AttributeProperty->GetOwnerClass()),
+		TEXT("Handlers can only be registered for attributes of this attribute set ('%s')."),
+		*(this->GetName())
+	);
+
+	this->AttributeExecutedHandlers.Add(AttributeProperty, Handler);
 }
 
 void UPF2CharacterAttributeSet::OnRep_Experience(const FGameplayAttributeData& OldValue)
@@ -554,15 +699,45 @@ void UPF2CharacterAttributeSet::PreAttributeChange(const FGameplayAttribute& Att
 	Super::PreAttributeChange(Attribute, NewValue);
 }
 
+void UPF2CharacterAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute,
+                                                    const float               OldValue,
+                                                    const float               NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	this->MarkAttributeDirty(Attribute);
+	this->RecordAttributeInSnapshot(Attribute);
+}
+
+void UPF2CharacterAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute,
+                                                        const float               OldValue,
+                                                        const float               NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// The base value is replicated along with the current value, so changes to it must also be pushed.
+	this->MarkAttributeDirty(Attribute);
+
+	// A change to only the base value (e.g., while an override modifier pins the current value) does not reach
+	// PostAttributeChange(), so it has to be recorded here. GAS declares this callback const, but the snapshot is
+	// replication state rather than attribute state.
+	const_cast<UPF2CharacterAttributeSet*>(this)->RecordAttributeInSnapshot(Attribute);
+}
+
 void UPF2CharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
-	const FGameplayEffectSpec& EffectSpec        = Data.EffectSpec;
-	const FGameplayAttribute   ModifiedAttribute = Data.EvaluatedData.Attribute;
-	IPF2CharacterInterface*    TargetCharacter   = PF2GameplayAbilityUtilities::GetEffectTarget(&Data);
-	float                      ValueDelta        = 0;
+	const FGameplayEffectSpec&           EffectSpec        = Data.EffectSpec;
+	const FGameplayAttribute             ModifiedAttribute = Data.EvaluatedData.Attribute;
+	IPF2CharacterInterface*              TargetCharacter   = PF2GameplayAbilityUtilities::GetEffectTarget(&Data);
+	const FPF2AttributeExecutedDelegate* Handler           =
+		this->AttributeExecutedHandlers.Find(ModifiedAttribute.GetUProperty());
+	float                                ValueDelta        = 0;
 
 	Super::PostGameplayEffectExecute(Data);
 
+	this->MarkAttributeDirty(ModifiedAttribute);
+	this->RecordAttributeInSnapshot(ModifiedAttribute);
+
 	checkf(
 		((TargetCharacter == nullptr) || (TargetCharacter->ToActor() == this->GetOwningActor())),
 		TEXT("The target of the effect should be the owner of the attribute set that is being modified.")
@@ -573,21 +748,39 @@ void UPF2CharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectM
 		ValueDelta = Data.EvaluatedData.Magnitude;
 	}
 
-	if (ModifiedAttribute == this->GetTmpDamageIncomingAttribute())
-	{
-		this->Native_OnDamageIncomingChanged(EffectSpec, TargetCharacter);
-	}
-	else if (ModifiedAttribute == this->GetHitPointsAttribute())
+	if (Handler != nullptr)
 	{
-		this->Native_OnHitPointsChanged(EffectSpec, TargetCharacter, ValueDelta);
+		Handler->ExecuteIfBound(EffectSpec, TargetCharacter, ValueDelta);
 	}
-	else if (ModifiedAttribute == this->GetSpeedAttribute())
+}
+
+void UPF2CharacterAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute) const
+{
+	const FProperty* AttributeProperty = Attribute.GetUProperty();
+
+	if ((AttributeProperty != nullptr) && (AttributeProperty->GetOwnerClass() == StaticClass()))
 	{
-		this->Native_OnSpeedChanged(EffectSpec, TargetCharacter, ValueDelta);
+		MARK_PROPERTY_DIRTY(this, AttributeProperty);
 	}
-	else if (ModifiedAttribute == this->GetEncMultipleAttackPenaltyAttribute())
+}
+
+void UPF2CharacterAttributeSet::RecordAttributeInSnapshot(const FGameplayAttribute& Attribute)
+{
+	const FProperty* AttributeProperty = Attribute.GetUProperty();
+	const AActor*    OwningActor       = this->GetOwningActor();
+
+	if (this->bReplicateAttributesAsSnapshot &&
+		(AttributeProperty != nullptr) &&
+		(OwningActor != nullptr) &&
+		OwningActor->HasAuthority())
 	{
-		this->Native_OnMultipleAttackPenaltyChanged(EffectSpec, TargetCharacter, ValueDelta);
+		const EPF2AttributeReplicationTier Tier = this->GetReplicationTierOfAttribute(AttributeProperty->GetFName());
+
+		if ((Tier == EPF2AttributeReplicationTier::Everyone) &&
+			this->AttributeSnapshot.RecordAttribute(AttributeProperty))
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(UPF2CharacterAttributeSet, AttributeSnapshot, this);
+		}
 	}
 }
 
@@ -14,10 +14,10 @@
 TArray<const FGameplayEffectAttributeCaptureDefinition*> FPF2CharacterAttributeStaticsBase::GetAllAbilityScoreCaptures() const
 {
 	return PF2ArrayUtilities::Map<const FGameplayEffectAttributeCaptureDefinition*>(
-		this->GetAbilityNames(),
-		[this](const FString& AbilityScoreAttributeName)
+		this->AbilityScoreSlots,
+		[this](const int32 AbilityScoreSlot)
 		{
-			return this->GetCaptureByAttributeName(AbilityScoreAttributeName);
+			return this->GetCaptureBySlot(AbilityScoreSlot);
 		}
 	);
 }
@@ -25,43 +25,19 @@ TArray<const FGameplayEffectAttributeCaptureDefinition*> FPF2CharacterAttributeS
 const FGameplayEffectAttributeCaptureDefinition* FPF2CharacterAttributeStaticsBase::GetResistanceCaptureForDamageType(
 	const FName& DamageTypeName) const
 {
-	const FGameplayEffectAttributeCaptureDefinition* Result = nullptr;
-
-	if (this->DamageTypeToResistanceAttributeMap.Contains(DamageTypeName))
-	{
-		const FName ResistanceAttributeName = this->DamageTypeToResistanceAttributeMap[DamageTypeName];
-
-		Result = this->GetCaptureByAttributeName(ResistanceAttributeName.ToString());
-	}
-	else
-	{
-		UE_LOG(
-			LogPf2Stats,
-			Error,
-			TEXT("No resistance attribute corresponds to damage type '%s'."),
-			*(DamageTypeName.ToString())
-		);
-	}
-
-	return Result;
+	return this->GetResistanceCaptureForDamageType(FGameplayTag::RequestGameplayTag(DamageTypeName, false));
 }
 
 TArray<const FGameplayEffectAttributeCaptureDefinition*> FPF2CharacterAttributeStaticsBase::GetAllResistanceCaptures() const
 {
-	TArray<FName> ResistanceAttributeNames;
+	TArray<const FGameplayEffectAttributeCaptureDefinition*> Captures;
 
-	this->DamageTypeToResistanceAttributeMap.GenerateValueArray(ResistanceAttributeNames);
-
-	return PF2ArrayUtilities::ReduceToArray<const FGameplayEffectAttributeCaptureDefinition*>(
-		ResistanceAttributeNames,
-		[this](TArray<const FGameplayEffectAttributeCaptureDefinition*> Captures, const FName& ResistanceAttributeName)
-		{
-			const FGameplayEffectAttributeCaptureDefinition* ResistanceCapture =
-				this->CaptureDefinitions[ResistanceAttributeName.ToString()];
+	for (const auto& [DamageType, ResistanceSlot] : this->ResistanceSlotsByDamageType)
+	{
+		Captures.Add(this->GetCaptureBySlot(ResistanceSlot));
+	}
 
-			Captures.Add(ResistanceCapture);
-		}
-	);
+	return Captures;
 }
 
 FPF2CharacterAttributeStaticsBase::FPF2CharacterAttributeStaticsBase():
@@ -125,3 +101,50 @@ FPF2CharacterAttributeStaticsBase::FPF2CharacterAttributeStaticsBase():
 	}
 #endif
 }
+
+void FPF2CharacterAttributeStaticsBase::IndexCaptureSlots()
+{
+	const UClass* AttributeSetClass = UPF2CharacterAttributeSet::StaticClass();
+
+	this->AbilityScoreSlots.Init(INDEX_NONE, static_cast<int32>(EPF2CharacterAbilityScoreType::Count));
+	this->AbilityModifierSlots.Init(INDEX_NONE, static_cast<int32>(EPF2CharacterAbilityScoreType::Count));
+
+	for (const EPF2CharacterAbilityScoreType AbilityScoreType : TEnumRange<EPF2CharacterAbilityScoreType>())
+	{
+		// The name of each ability score type exactly matches the name of its attribute.
+		const FString AbilityScoreName = PF2EnumUtilities::ToString(AbilityScoreType);
+		const int32   AbilityIndex     = static_cast<int32>(AbilityScoreType);
+
+		const FString ModifierName = AbilityScoreName + TEXT("Modifier");
+
+		const FProperty* AbilityScoreProperty = FindFProperty<FProperty>(AttributeSetClass, *AbilityScoreName);
+		const FProperty* ModifierProperty     = FindFProperty<FProperty>(AttributeSetClass, *ModifierName);
+
+		if (AbilityScoreProperty != nullptr)
+		{
+			this->AbilityScoreSlots[AbilityIndex] = this->GetSlotOfAttribute(FGameplayAttribute(AbilityScoreProperty));
+		}
+
+		if (ModifierProperty != nullptr)
+		{
+			this->AbilityModifierSlots[AbilityIndex] = this->GetSlotOfAttribute(FGameplayAttribute(ModifierProperty));
+		}
+	}
+
+	for (const auto& [DamageTypeName, ResistanceAttributeName] : this->DamageTypeToResistanceAttributeMap)
+	{
+		const FGameplayTag DamageType         = FGameplayTag::RequestGameplayTag(DamageTypeName, false);
+		const FProperty*   ResistanceProperty = FindFProperty<FProperty>(AttributeSetClass, ResistanceAttributeName);
+
+		// Missing damage type tags are reported by the constructor.
+		if (DamageType.IsValid() && (ResistanceProperty != nullptr))
+		{
+			const int32 ResistanceSlot = this->GetSlotOfAttribute(FGameplayAttribute(ResistanceProperty));
+
+			if (ResistanceSlot != INDEX_NONE)
+			{
+				this->ResistanceSlotsByDamageType.Add(DamageType, ResistanceSlot);
+			}
+		}
+	}
+}
@@ -113,6 +113,23 @@ float UPF2KeyAbilityTemlCalculationBase::CalculateBaseMagnitude_Implementation(c
 	return AbilityScore;
 }
 
+FGameplayTagContainer UPF2KeyAbilityTemlCalculationBase::GetQueriedTags() const
+{
+	FGameplayTagContainer QueriedTags;
+
+	if (!this->StatGameplayTagPrefix.IsEmpty())
+	{
+		QueriedTags.AddTag(PF2GameplayAbilityUtilities::GetTag(this->StatGameplayTagPrefix));
+	}
+
+	for (const auto& [KeyAbilityTagName, CaptureDefinition] : this->KeyAbilityCaptureDefinitions)
+	{
+		QueriedTags.AddTag(PF2GameplayAbilityUtilities::GetTag(KeyAbilityTagName));
+	}
+
+	return QueriedTags;
+}
+
 float UPF2KeyAbilityTemlCalculationBase::CalculateKeyAbilityModifier(const FGameplayEffectSpec& Spec) const
 {
 	float                        KeyAbilityModifier = 0.0f;
@@ -50,4 +50,6 @@ FPF2SourceCharacterAttributeStatics::FPF2SourceCharacterAttributeStatics()
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2CharacterAttributeSet, RstPrecision, Source, true);
 
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2CharacterAttributeSet, EncMultipleAttackPenalty, Source, true);
+
+	this->IndexCaptureSlots();
 }
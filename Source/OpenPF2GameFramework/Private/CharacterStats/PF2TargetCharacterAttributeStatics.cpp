@@ -7,30 +7,36 @@
 
 #include "OpenPF2GameFramework.h"
 
+#include "Abilities/Attacks/PF2AttackAttributeSet.h"
+
 const FGameplayEffectAttributeCaptureDefinition* FPF2TargetCharacterAttributeStatics::GetResistanceCaptureForDamageAttribute(
-	const FName& DamageAttributeName) const
+	const FGameplayAttribute& DamageAttribute) const
 {
-	const FGameplayEffectAttributeCaptureDefinition* Result = nullptr;
+	const FGameplayEffectAttributeCaptureDefinition* Result =
+		this->GetCaptureBySlot(this->GetResistanceSlotForDamageAttribute(DamageAttribute));
 
-	if (this->DamageAttributeToResistanceAttributeMap.Contains(DamageAttributeName))
-	{
-		const FName ResistanceAttributeName = this->DamageAttributeToResistanceAttributeMap[DamageAttributeName];
-
-		Result = this->GetCaptureByAttributeName(ResistanceAttributeName.ToString());
-	}
-	else
+	if (Result == nullptr)
 	{
 		UE_LOG(
 			LogPf2Stats,
 			Error,
 			TEXT("No resistance attribute corresponds to damage attribute '%s'."),
-			*(DamageAttributeName.ToString())
+			*(DamageAttribute.GetName())
 		);
 	}
 
 	return Result;
 }
 
+const FGameplayEffectAttributeCaptureDefinition* FPF2TargetCharacterAttributeStatics::GetResistanceCaptureForDamageAttribute(
+	const FName& DamageAttributeName) const
+{
+	const FProperty* DamageProperty =
+		FindFProperty<FProperty>(UPF2AttackAttributeSet::StaticClass(), DamageAttributeName);
+
+	return this->GetResistanceCaptureForDamageAttribute(FGameplayAttribute(DamageProperty));
+}
+
 FPF2TargetCharacterAttributeStatics::FPF2TargetCharacterAttributeStatics():
 	TmpDamageIncomingProperty(nullptr),
 	TmpLastIncomingAttackDegreeOfSuccessProperty(nullptr)
@@ -79,4 +85,23 @@ FPF2TargetCharacterAttributeStatics::FPF2TargetCharacterAttributeStatics():
 
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2CharacterAttributeSet, TmpDamageIncoming, Target, false);
 	DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(UPF2CharacterAttributeSet, TmpLastIncomingAttackDegreeOfSuccess, Target, false);
+
+	this->IndexCaptureSlots();
+
+	for (const auto& [DamageAttributeName, ResistanceAttributeName] : this->DamageAttributeToResistanceAttributeMap)
+	{
+		const FProperty* DamageProperty =
+			FindFProperty<FProperty>(UPF2AttackAttributeSet::StaticClass(), DamageAttributeName);
+
+		const FProperty* ResistanceProperty =
+			FindFProperty<FProperty>(UPF2CharacterAttributeSet::StaticClass(), ResistanceAttributeName);
+
+		if ((DamageProperty != nullptr) && (ResistanceProperty != nullptr))
+		{
+			this->ResistanceSlotsByDamageAttribute.Add(
+				FGameplayAttribute(DamageProperty),
+				this->GetSlotOfAttribute(FGameplayAttribute(ResistanceProperty))
+			);
+		}
+	}
 }
@@ -11,6 +11,7 @@
 // permission.
 
 #include "CharacterStats/PF2TemlCalculation.h"
+#include "CharacterStats/PF2TemlTagIndex.h"
 
 #include "Utilities/PF2GameplayAbilityUtilities.h"
 
@@ -39,7 +40,7 @@ FPF2TemlCalculation::FPF2TemlCalculation(const FGameplayTag TagPrefix,
 	// option.
 	if (CharacterTags->HasTag(TagPrefix))
 	{
-		const FString TagPrefixString = TagPrefix.GetTagName().GetPlainNameString();
+		const FPF2TemlRankTags RankTags = FPF2TemlTagIndex::GetInstance().GetRankTags(TagPrefix);
 
 		// "When attempting a check that involves something you have some training in, you will also add your
 		// proficiency bonus. This bonus depends on your proficiency rank: untrained, trained, expert, master, or
@@ -50,22 +51,22 @@ FPF2TemlCalculation::FPF2TemlCalculation(const FGameplayTag TagPrefix,
 		//
 		// Source: Pathfinder 2E Core Rulebook, page 444, "Step 1: Roll D20 and Identify The Modifiers, Bonuses, and
 		// Penalties That Apply".
-		if (PF2GameplayAbilityUtilities::HasTag(CharacterTags, TagPrefixString + ".Legendary"))
+		if (CharacterTags->HasTag(RankTags.LegendaryTag))
 		{
 			// Legendary -> Your level + 8
 			ProficiencyBonus = CharacterLevel + 8;
 		}
-		else if (PF2GameplayAbilityUtilities::HasTag(CharacterTags, TagPrefixString + ".Master"))
+		else if (CharacterTags->HasTag(RankTags.MasterTag))
 		{
 			// Master -> Your level + 6
 			ProficiencyBonus = CharacterLevel + 6;
 		}
-		else if (PF2GameplayAbilityUtilities::HasTag(CharacterTags, TagPrefixString + ".Expert"))
+		else if (CharacterTags->HasTag(RankTags.ExpertTag))
 		{
 			// Expert -> Your level + 4
 			ProficiencyBonus = CharacterLevel + 4;
 		}
-		else if (PF2GameplayAbilityUtilities::HasTag(CharacterTags, TagPrefixString + ".Trained"))
+		else if (CharacterTags->HasTag(RankTags.TrainedTag))
 		{
 			// Trained -> Your level + 2
 			ProficiencyBonus = CharacterLevel + 2;
@@ -0,0 +1,106 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "CharacterStats/PF2TemlTagIndex.h"
+
+#include <GameplayTagsManager.h>
+
+#include "OpenPF2GameFramework.h"
+
+FPF2TemlTagIndex::FPF2TemlTagIndex()
+{
+	const FName TrainedName   = FName(TEXT("Trained")),
+	            ExpertName    = FName(TEXT("Expert")),
+	            MasterName    = FName(TEXT("Master")),
+	            LegendaryName = FName(TEXT("Legendary"));
+
+	const UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+	FGameplayTagContainer       AllTags;
+
+	TagsManager.RequestAllGameplayTags(AllTags, false);
+
+	for (const FGameplayTag& Tag : AllTags)
+	{
+		const TSharedPtr<FGameplayTagNode> TagNode = TagsManager.FindTagNode(Tag);
+
+		if (!TagNode.IsValid())
+		{
+			continue;
+		}
+
+		const FName        SimpleTagName = TagNode->GetSimpleTagName();
+		const FGameplayTag ParentTag     = Tag.RequestDirectParent();
+		FGameplayTag*      RankTag;
+
+		if (!ParentTag.IsValid())
+		{
+			continue;
+		}
+
+		if (SimpleTagName == TrainedName)
+		{
+			RankTag = &this->RankTagsByPrefix.FindOrAdd(ParentTag).TrainedTag;
+		}
+		else if (SimpleTagName == ExpertName)
+		{
+			RankTag = &this->RankTagsByPrefix.FindOrAdd(ParentTag).ExpertTag;
+		}
+		else if (SimpleTagName == MasterName)
+		{
+			RankTag = &this->RankTagsByPrefix.FindOrAdd(ParentTag).MasterTag;
+		}
+		else if (SimpleTagName == LegendaryName)
+		{
+			RankTag = &this->RankTagsByPrefix.FindOrAdd(ParentTag).LegendaryTag;
+		}
+		else
+		{
+			continue;
+		}
+
+		*RankTag = Tag;
+	}
+
+	UE_LOG(
+		LogPf2Stats,
+		Verbose,
+		TEXT("Indexed the TEML rank tags of %d proficiencies."),
+		this->RankTagsByPrefix.Num()
+	);
+}
+
+FPF2TemlRankTags FPF2TemlTagIndex::GetRankTags(const FGameplayTag TagPrefix) const
+{
+	FPF2TemlRankTags        Result;
+	const FPF2TemlRankTags* IndexedRankTags = this->RankTagsByPrefix.Find(TagPrefix);
+
+	if (IndexedRankTags == nullptr)
+	{
+		Result = LookupRankTags(TagPrefix);
+	}
+	else
+	{
+		Result = *IndexedRankTags;
+	}
+
+	return Result;
+}
+
+FPF2TemlRankTags FPF2TemlTagIndex::LookupRankTags(const FGameplayTag TagPrefix)
+{
+	FPF2TemlRankTags Result;
+
+	if (TagPrefix.IsValid())
+	{
+		const FString TagPrefixString = TagPrefix.GetTagName().ToString();
+
+		Result.TrainedTag   = FGameplayTag::RequestGameplayTag(FName(TagPrefixString + TEXT(".Trained")), false);
+		Result.ExpertTag    = FGameplayTag::RequestGameplayTag(FName(TagPrefixString + TEXT(".Expert")), false);
+		Result.MasterTag    = FGameplayTag::RequestGameplayTag(FName(TagPrefixString + TEXT(".Master")), false);
+		Result.LegendaryTag = FGameplayTag::RequestGameplayTag(FName(TagPrefixString + TEXT(".Legendary")), false);
+	}
+
+	return Result;
+}
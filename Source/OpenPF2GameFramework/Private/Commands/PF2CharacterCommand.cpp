@@ -19,6 +19,9 @@
 
 #include "Actors/Components/PF2AbilitySystemInterface.h"
 
+#include "Commands/PF2CharacterCommandPoolSubsystem.h"
+#include "Commands/PF2QueuedCommandList.h"
+
 #include "Utilities/PF2EnumUtilities.h"
 #include "Utilities/PF2InterfaceUtilities.h"
 #include "Utilities/PF2LogUtilities.h"
@@ -28,14 +31,48 @@ IPF2CharacterCommandInterface* APF2CharacterCommand::Create(AActor*
                                                             const FGameplayEventData&        AbilityPayload,
                                                             const EPF2CommandQueuePosition   QueuePositionPreference)
 {
-	UWorld*               World   = OwningCharacterActor->GetWorld();
-	APF2CharacterCommand* Command;
+	UPF2CharacterCommandPoolSubsystem* CommandPool = UPF2CharacterCommandPoolSubsystem::Get(OwningCharacterActor);
+	APF2CharacterCommand*              Command;
 
 	check(OwningCharacterActor->Implements<UPF2CharacterInterface>());
 
-	Command = World->SpawnActorDeferred<APF2CharacterCommand>(StaticClass(), FTransform(), OwningCharacterActor);
+	if (CommandPool == nullptr)
+	{
+		UWorld* World = OwningCharacterActor->GetWorld();
+
+		Command = World->SpawnActorDeferred<APF2CharacterCommand>(StaticClass(), FTransform(), OwningCharacterActor);
 
-	Command->FinalizeConstruction(OwningCharacterActor, AbilitySpecHandle, AbilityPayload, QueuePositionPreference);
+		Command->FinalizeConstruction(OwningCharacterActor, AbilitySpecHandle, AbilityPayload, QueuePositionPreference);
+	}
+	else
+	{
+		Command = CommandPool->AcquireCommand(
+			OwningCharacterActor,
+			AbilitySpecHandle,
+			AbilityPayload,
+			QueuePositionPreference
+		);
+	}
+
+	return Command;
+}
+
+APF2CharacterCommand* APF2CharacterCommand::CreateFromQueuedCommand(AActor*                  OwningCharacterActor,
+                                                                    const FPF2QueuedCommand& QueuedCommand)
+{
+	APF2CharacterCommand* Command =
+		Cast<APF2CharacterCommand>(
+			Create(
+				OwningCharacterActor,
+				QueuedCommand.AbilitySpecHandle,
+				QueuedCommand.AbilityPayload,
+				QueuedCommand.QueuePositionPreference
+			)->ToActor()
+		);
+
+	// The copy only exists on this machine; the server has the original.
+	Command->SetReplicates(false);
+	Command->QueuedCommandId = QueuedCommand.CommandId;
 
 	return Command;
 }
@@ -48,6 +85,7 @@ void APF2CharacterCommand::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME(APF2CharacterCommand, AbilitySpecHandle);
 	DOREPLIFETIME(APF2CharacterCommand, AbilityPayload);
 	DOREPLIFETIME(APF2CharacterCommand, QueuePositionPreference);
+	DOREPLIFETIME(APF2CharacterCommand, Generation);
 }
 
 TScriptInterface<IPF2CharacterInterface> APF2CharacterCommand::GetOwningCharacter() const
@@ -276,6 +314,48 @@ void APF2CharacterCommand::FinalizeConstruction(AActor*
 	UGameplayStatics::FinishSpawningActor(this, FTransform());
 }
 
+void APF2CharacterCommand::Reinitialize(AActor*                          InOwningCharacterActor,
+                                        const FGameplayAbilitySpecHandle InAbilitySpecHandle,
+                                        const FGameplayEventData&        InAbilityPayload,
+                                        const EPF2CommandQueuePosition   InQueuePositionPreference)
+{
+	// The command may have been a local copy of a queued command, or may have been queued in a queue that uses
+	// lightweight replication; either way, commands on the server replicate by default.
+	if (!this->GetIsReplicated() && (this->GetNetMode() != NM_Client))
+	{
+		this->SetReplicates(true);
+	}
+
+	if (this->GetIsReplicated())
+	{
+		this->SetNetDormancy(DORM_Awake);
+	}
+
+	this->SetOwner(InOwningCharacterActor);
+
+	this->OwningCharacterActor    = InOwningCharacterActor;
+	this->AbilitySpecHandle       = InAbilitySpecHandle;
+	this->AbilityPayload          = InAbilityPayload;
+	this->QueuePositionPreference = InQueuePositionPreference;
+}
+
+void APF2CharacterCommand::OnReleasedToPool()
+{
+	// Replicated state is left as-is until the command is reused, since clients may still be holding on to the command
+	// (e.g., in a UI that has not yet processed the removal of the command from a queue).
+	this->CachedAbility   = nullptr;
+	this->QueuedCommandId = INDEX_NONE;
+
+	// Any request that clients send about the previous use of this command from now on is stale.
+	++this->Generation;
+
+	// Stop considering the command for replication until it is reused.
+	if (this->GetIsReplicated())
+	{
+		this->SetNetDormancy(DORM_DormantAll);
+	}
+}
+
 void APF2CharacterCommand::Cancel_WithRemoteServer()
 {
 	const TScriptInterface<IPF2CharacterInterface>        Character        = this->GetOwningCharacter();
@@ -291,9 +371,14 @@ void APF2CharacterCommand::Cancel_WithRemoteServer()
 			*(this->GetIdForLogs())
 		);
 	}
+	else if (this->QueuedCommandId == INDEX_NONE)
+	{
+		PlayerController->Server_CancelCharacterCommand(this, this->Generation);
+	}
 	else
 	{
-		PlayerController->Server_CancelCharacterCommand(this);
+		// This command is a local copy that the server does not know about, so the original has to be identified by ID.
+		PlayerController->Server_CancelQueuedCharacterCommand(this->OwningCharacterActor, this->QueuedCommandId);
 	}
 }
 
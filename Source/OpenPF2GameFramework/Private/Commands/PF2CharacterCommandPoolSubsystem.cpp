@@ -0,0 +1,109 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Commands/PF2CharacterCommandPoolSubsystem.h"
+
+#include <Engine/World.h>
+
+#include "OpenPF2GameFramework.h"
+
+#include "Commands/PF2CharacterCommand.h"
+
+#include "Utilities/PF2LogUtilities.h"
+
+const int32 UPF2CharacterCommandPoolSubsystem::MaxPooledCommands = 128;
+
+UPF2CharacterCommandPoolSubsystem* UPF2CharacterCommandPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	UPF2CharacterCommandPoolSubsystem* Result = nullptr;
+
+	if (WorldContextObject != nullptr)
+	{
+		if (const UWorld* World = WorldContextObject->GetWorld(); World != nullptr)
+		{
+			Result = World->GetSubsystem<UPF2CharacterCommandPoolSubsystem>();
+		}
+	}
+
+	return Result;
+}
+
+void UPF2CharacterCommandPoolSubsystem::Deinitialize()
+{
+	// The commands themselves are destroyed along with the world.
+	this->AvailableCommands.Empty();
+
+	Super::Deinitialize();
+}
+
+APF2CharacterCommand* UPF2CharacterCommandPoolSubsystem::AcquireCommand(
+	AActor*                          OwningCharacterActor,
+	const FGameplayAbilitySpecHandle AbilitySpecHandle,
+	const FGameplayEventData&        AbilityPayload,
+	const EPF2CommandQueuePosition   QueuePositionPreference)
+{
+	APF2CharacterCommand* Command = nullptr;
+
+	check(IsInGameThread());
+
+	while ((Command == nullptr) && !this->AvailableCommands.IsEmpty())
+	{
+		// Commands can be destroyed out from under the pool (e.g., during level transitions), so skip any that were.
+		Command = this->AvailableCommands.Pop(false);
+
+		if (!IsValid(Command))
+		{
+			Command = nullptr;
+		}
+	}
+
+	if (Command == nullptr)
+	{
+		UWorld* World = this->GetWorld();
+
+		Command = World->SpawnActorDeferred<APF2CharacterCommand>(
+			APF2CharacterCommand::StaticClass(),
+			FTransform(),
+			OwningCharacterActor
+		);
+
+		Command->FinalizeConstruction(OwningCharacterActor, AbilitySpecHandle, AbilityPayload, QueuePositionPreference);
+	}
+	else
+	{
+		UE_LOG(
+			LogPf2Abilities,
+			VeryVerbose,
+			TEXT("[%s] Reusing pooled command actor ('%s')."),
+			*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+			*(Command->GetName())
+		);
+
+		Command->Reinitialize(OwningCharacterActor, AbilitySpecHandle, AbilityPayload, QueuePositionPreference);
+	}
+
+	return Command;
+}
+
+void UPF2CharacterCommandPoolSubsystem::ReleaseCommand(APF2CharacterCommand* Command)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(Command) || this->AvailableCommands.Contains(Command))
+	{
+		return;
+	}
+
+	if (this->AvailableCommands.Num() >= MaxPooledCommands)
+	{
+		Command->Destroy();
+	}
+	else
+	{
+		Command->OnReleasedToPool();
+
+		this->AvailableCommands.Add(Command);
+	}
+}
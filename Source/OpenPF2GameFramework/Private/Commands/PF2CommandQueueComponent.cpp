@@ -11,23 +11,42 @@
 
 #include "OpenPF2GameFramework.h"
 
+#include "Commands/PF2CharacterCommand.h"
 #include "Commands/PF2CharacterCommandInterface.h"
 
+#include "Libraries/PF2CharacterCommandLibrary.h"
+
 #include "Utilities/PF2InterfaceUtilities.h"
 #include "Utilities/PF2LogUtilities.h"
 
 const uint8 UPF2CommandQueueComponent::CommandLimitNone = 0;
 
-UPF2CommandQueueComponent::UPF2CommandQueueComponent(): Events(nullptr), SizeLimit(CommandLimitNone)
+UPF2CommandQueueComponent::UPF2CommandQueueComponent():
+	Events(nullptr),
+	bHaveQueuedCommandsChanged(false),
+	SizeLimit(CommandLimitNone),
+	bUseLightweightReplication(false)
 {
 	this->SetIsReplicatedByDefault(true);
 }
 
+void UPF2CommandQueueComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// This cannot be done in the constructor because properties get copied from the archetype after construction.
+	this->QueuedCommands.SetOwningComponent(this);
+}
+
 void UPF2CommandQueueComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	// This is only evaluated for the CDO, but bUseLightweightReplication can be overridden on component templates, so
+	// both representations of the queue are always replicated. Only one of them is ever populated; the other stays
+	// empty and costs nothing to replicate.
 	DOREPLIFETIME(UPF2CommandQueueComponent, Queue);
+	DOREPLIFETIME(UPF2CommandQueueComponent, QueuedCommands);
 }
 
 UObject* UPF2CommandQueueComponent::GetGenericEventsObject() const
@@ -56,7 +75,7 @@ void UPF2CommandQueueComponent::Enqueue(const TScriptInterface<IPF2CharacterComm
 {
 	AInfo* CommandActor = Command->ToActor();
 
-	if ((this->SizeLimit != CommandLimitNone) && (this->Queue.Num() == this->SizeLimit))
+	if ((this->SizeLimit != CommandLimitNone) && (this->Count() == this->SizeLimit))
 	{
 		UE_LOG(
 			LogPf2Abilities,
@@ -69,7 +88,7 @@ void UPF2CommandQueueComponent::Enqueue(const TScriptInterface<IPF2CharacterComm
 	}
 	else
 	{
-		checkf(!this->Queue.Contains(CommandActor), TEXT("The same command can only exist in the queue once."));
+		checkf(!this->ContainsCommand(CommandActor), TEXT("The same command can only exist in the queue once."));
 
 		UE_LOG(
 			LogPf2Abilities,
@@ -79,7 +98,7 @@ void UPF2CommandQueueComponent::Enqueue(const TScriptInterface<IPF2CharacterComm
 			*(this->GetIdForLogs())
 		);
 
-		this->Queue.Add(CommandActor);
+		this->InsertCommand(CommandActor, this->Count());
 
 		this->Native_OnCommandAdded(Command);
 		this->Native_OnCommandsChanged();
@@ -104,7 +123,7 @@ void UPF2CommandQueueComponent::EnqueueAt(const TScriptInterface<IPF2CharacterCo
 		return;
 	}
 
-	if (Position > this->Queue.Num())
+	if (Position > this->Count())
 	{
 		UE_LOG(
 			LogPf2Abilities,
@@ -113,12 +132,12 @@ void UPF2CommandQueueComponent::EnqueueAt(const TScriptInterface<IPF2CharacterCo
 			*(Command->GetIdForLogs()),
 			*(this->GetIdForLogs()),
 			Position,
-			this->Queue.Num()
+			this->Count()
 		);
 		return;
 	}
 
-	checkf(!this->Queue.Contains(CommandActor), TEXT("The same command can only exist in the queue once."));
+	checkf(!this->ContainsCommand(CommandActor), TEXT("The same command can only exist in the queue once."));
 
 	UE_LOG(
 		LogPf2Abilities,
@@ -131,12 +150,12 @@ void UPF2CommandQueueComponent::EnqueueAt(const TScriptInterface<IPF2CharacterCo
 
 	// Insert the new command before enforcing limits (in case we are inserting this new command at the end of the
 	// queue).
-	this->Queue.Insert(CommandActor, Position);
+	this->InsertCommand(CommandActor, Position);
 
 	// Now, if necessary, drop the last command.
-	if ((this->SizeLimit != CommandLimitNone) && (this->Queue.Num() == this->SizeLimit))
+	if ((this->SizeLimit != CommandLimitNone) && (this->Count() > this->SizeLimit))
 	{
-		AInfo* RemovedElement = this->Queue.Pop(false);
+		AInfo* RemovedElement = this->RemoveCommandAt(this->Count() - 1);
 
 		UE_LOG(
 			LogPf2Abilities,
@@ -146,6 +165,8 @@ void UPF2CommandQueueComponent::EnqueueAt(const TScriptInterface<IPF2CharacterCo
 			this->SizeLimit,
 			*(IPF2LogIdentifiableInterface::GetIdForLogs(RemovedElement))
 		);
+
+		UPF2CharacterCommandLibrary::ReleaseCommand(RemovedElement);
 	}
 
 	this->Native_OnCommandAdded(Command);
@@ -156,7 +177,7 @@ void UPF2CommandQueueComponent::PeekNext(TScriptInterface<IPF2CharacterCommandIn
 {
 	if (this->Count() != 0)
 	{
-		IPF2CharacterCommandInterface* NextCommandPtr = Cast<IPF2CharacterCommandInterface>(this->Queue[0]);
+		IPF2CharacterCommandInterface* NextCommandPtr = Cast<IPF2CharacterCommandInterface>(this->GetCommandAt(0));
 
 		NextCommand = PF2InterfaceUtilities::ToScriptInterface(NextCommandPtr);
 	}
@@ -176,7 +197,7 @@ void UPF2CommandQueueComponent::PopNext(TScriptInterface<IPF2CharacterCommandInt
 			*(this->GetIdForLogs())
 		);
 
-		this->Queue.RemoveAt(0, 1, false);
+		this->RemoveCommandAt(0);
 
 		this->Native_OnCommandRemoved(NextCommand);
 		this->Native_OnCommandsChanged();
@@ -199,10 +220,12 @@ void UPF2CommandQueueComponent::DropNext()
 			*(this->GetIdForLogs())
 		);
 
-		this->Queue.RemoveAt(0, 1, false);
+		this->RemoveCommandAt(0);
 
 		this->Native_OnCommandRemoved(NextCommand);
 		this->Native_OnCommandsChanged();
+
+		UPF2CharacterCommandLibrary::ReleaseCommand(NextCommand);
 	}
 }
 
@@ -252,8 +275,11 @@ EPF2CommandExecuteImmediatelyResult UPF2CommandQueueComponent::PopAndExecuteNext
 		}
 		else
 		{
-			// Now it's safe to drop the command.
-			this->Remove(NextCommand);
+			// Now it's safe to drop the command. It has been executed or cancelled, so it is no longer needed.
+			if (this->Remove(NextCommand))
+			{
+				UPF2CharacterCommandLibrary::ReleaseCommand(NextCommand);
+			}
 		}
 	}
 
@@ -262,9 +288,8 @@ EPF2CommandExecuteImmediatelyResult UPF2CommandQueueComponent::PopAndExecuteNext
 
 bool UPF2CommandQueueComponent::Remove(const TScriptInterface<IPF2CharacterCommandInterface>& Command)
 {
-	AInfo*      CommandActor       = Command->ToActor();
-	const int32 CountOfRemoved     = this->Queue.Remove(CommandActor);
-	const bool  bWasCommandRemoved = (CountOfRemoved > 0);
+	AInfo*     CommandActor       = Command->ToActor();
+	const bool bWasCommandRemoved = this->RemoveCommand(CommandActor);
 
 	if (bWasCommandRemoved)
 	{
@@ -277,19 +302,45 @@ bool UPF2CommandQueueComponent::Remove(const TScriptInterface<IPF2CharacterComma
 
 int UPF2CommandQueueComponent::Count()
 {
-	return this->Queue.Num();
+	int Count;
+
+	if (this->bUseLightweightReplication)
+	{
+		Count = this->QueuedCommands.Num();
+	}
+	else
+	{
+		Count = this->Queue.Num();
+	}
+
+	return Count;
 }
 
 void UPF2CommandQueueComponent::Clear()
 {
-	this->Queue.Empty(this->SizeLimit);
+	const TArray<AInfo*> ClearedCommands = this->GetCommands();
+
+	if (this->bUseLightweightReplication)
+	{
+		this->QueuedCommands.Reset();
+	}
+	else
+	{
+		this->Queue.Empty(this->SizeLimit);
+	}
+
 	this->Native_OnCommandsChanged();
+
+	for (AInfo* ClearedCommand : ClearedCommands)
+	{
+		UPF2CharacterCommandLibrary::ReleaseCommand(ClearedCommand);
+	}
 }
 
 TArray<TScriptInterface<IPF2CharacterCommandInterface>> UPF2CommandQueueComponent::ToArray() const
 {
 	return PF2ArrayUtilities::ReduceToArray<TScriptInterface<IPF2CharacterCommandInterface>>(
-		this->Queue,
+		this->GetCommands(),
 		[](TArray<TScriptInterface<IPF2CharacterCommandInterface>>& Commands,
 		   const TWeakInterfacePtr<IPF2CharacterCommandInterface>&  CurrentCommand)
 		{
@@ -300,11 +351,197 @@ TArray<TScriptInterface<IPF2CharacterCommandInterface>> UPF2CommandQueueComponen
 		});
 }
 
+TScriptInterface<IPF2CharacterCommandInterface> UPF2CommandQueueComponent::FindCommandById(const int32 CommandId) const
+{
+	TScriptInterface<IPF2CharacterCommandInterface> Command;
+
+	if (this->bUseLightweightReplication)
+	{
+		IPF2CharacterCommandInterface* CommandIntf =
+			Cast<IPF2CharacterCommandInterface>(this->QueuedCommands.FindCommandById(CommandId));
+
+		Command = PF2InterfaceUtilities::ToScriptInterface(CommandIntf);
+	}
+
+	return Command;
+}
+
 UActorComponent* UPF2CommandQueueComponent::ToActorComponent()
 {
 	return this;
 }
 
+void UPF2CommandQueueComponent::OnRep_QueuedCommandAdded(FPF2QueuedCommand& QueuedCommand)
+{
+	APF2CharacterCommand* Command = APF2CharacterCommand::CreateFromQueuedCommand(this->GetOwner(), QueuedCommand);
+
+	QueuedCommand.Command = Command;
+
+	this->bHaveQueuedCommandsChanged = true;
+
+	this->Native_OnCommandAdded(PF2InterfaceUtilities::ToScriptInterface<IPF2CharacterCommandInterface>(Command));
+}
+
+void UPF2CommandQueueComponent::OnRep_QueuedCommandChanged(const FPF2QueuedCommand& QueuedCommand)
+{
+	UE_LOG(
+		LogPf2Abilities,
+		VeryVerbose,
+		TEXT("[%s] Command ('%d') in queue ('%s') moved to sort key ('%d')."),
+		*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+		QueuedCommand.CommandId,
+		*(this->GetIdForLogs()),
+		QueuedCommand.SortKey
+	);
+
+	// The server only changes items to re-order them, which listeners learn about from the queue-changed event.
+	this->bHaveQueuedCommandsChanged = true;
+}
+
+void UPF2CommandQueueComponent::OnRep_QueuedCommandRemoved(FPF2QueuedCommand& QueuedCommand)
+{
+	AInfo* Command = QueuedCommand.Command;
+
+	this->bHaveQueuedCommandsChanged = true;
+
+	if (Command != nullptr)
+	{
+		this->Native_OnCommandRemoved(
+			PF2InterfaceUtilities::ToScriptInterface<IPF2CharacterCommandInterface>(
+				Cast<IPF2CharacterCommandInterface>(Command)
+			)
+		);
+
+		// The local copy is not referenced by anything else once it has left the queue.
+		UPF2CharacterCommandLibrary::ReleaseCommand(Command);
+
+		QueuedCommand.Command = nullptr;
+	}
+}
+
+void UPF2CommandQueueComponent::OnRep_QueuedCommands()
+{
+	// Notify listeners once per update, no matter how many items were added, removed, or re-ordered in the update.
+	if (this->bHaveQueuedCommandsChanged)
+	{
+		this->bHaveQueuedCommandsChanged = false;
+
+		this->Native_OnCommandsChanged();
+	}
+}
+
+AInfo* UPF2CommandQueueComponent::GetCommandAt(const int32 Position) const
+{
+	AInfo* Command;
+
+	if (this->bUseLightweightReplication)
+	{
+		Command = this->QueuedCommands.GetCommandAt(Position);
+	}
+	else if (this->Queue.IsValidIndex(Position))
+	{
+		Command = this->Queue[Position];
+	}
+	else
+	{
+		Command = nullptr;
+	}
+
+	return Command;
+}
+
+TArray<AInfo*> UPF2CommandQueueComponent::GetCommands() const
+{
+	TArray<AInfo*> Commands;
+
+	if (this->bUseLightweightReplication)
+	{
+		Commands = this->QueuedCommands.GetCommandsInOrder();
+	}
+	else
+	{
+		Commands = this->Queue;
+	}
+
+	return Commands;
+}
+
+bool UPF2CommandQueueComponent::ContainsCommand(const AInfo* CommandActor) const
+{
+	bool bContainsCommand;
+
+	if (this->bUseLightweightReplication)
+	{
+		bContainsCommand = this->QueuedCommands.Contains(CommandActor);
+	}
+	else
+	{
+		bContainsCommand = this->Queue.Contains(CommandActor);
+	}
+
+	return bContainsCommand;
+}
+
+void UPF2CommandQueueComponent::InsertCommand(AInfo* CommandActor, const int32 Position)
+{
+	if (this->bUseLightweightReplication)
+	{
+		APF2CharacterCommand* Command = Cast<APF2CharacterCommand>(CommandActor);
+
+		checkf(
+			Command != nullptr,
+			TEXT("Only commands of type APF2CharacterCommand can be queued when lightweight replication is enabled.")
+		);
+
+		// Clients receive the details of the command through the queue instead of from the command itself.
+		Command->SetReplicates(false);
+
+		this->QueuedCommands.Insert(Command, Position);
+	}
+	else
+	{
+		this->Queue.Insert(CommandActor, Position);
+	}
+}
+
+AInfo* UPF2CommandQueueComponent::RemoveCommandAt(const int32 Position)
+{
+	AInfo* RemovedCommand;
+
+	if (this->bUseLightweightReplication)
+	{
+		RemovedCommand = this->QueuedCommands.RemoveAt(Position);
+	}
+	else if (this->Queue.IsValidIndex(Position))
+	{
+		RemovedCommand = this->Queue[Position];
+
+		this->Queue.RemoveAt(Position, 1, false);
+	}
+	else
+	{
+		RemovedCommand = nullptr;
+	}
+
+	return RemovedCommand;
+}
+
+bool UPF2CommandQueueComponent::RemoveCommand(AInfo* CommandActor)
+{
+	bool bWasCommandRemoved;
+
+	if (this->bUseLightweightReplication)
+	{
+		bWasCommandRemoved = this->QueuedCommands.Remove(CommandActor);
+	}
+	else
+	{
+		bWasCommandRemoved = (this->Queue.Remove(CommandActor) > 0);
+	}
+
+	return bWasCommandRemoved;
+}
+
 void UPF2CommandQueueComponent::OnRep_Queue(const TArray<AInfo*>& OldQueue)
 {
 	const UPF2CommandQueueInterfaceEvents* InterfaceEvents = this->GetEvents();
@@ -343,7 +580,7 @@ void UPF2CommandQueueComponent::Native_OnCommandsChanged()
 	{
 		TArray<TScriptInterface<IPF2CharacterCommandInterface>> NewCommands;
 
-		for (AInfo* NewCommand : this->Queue)
+		for (AInfo* NewCommand : this->GetCommands())
 		{
 			// BUGBUG: By the time we're here, this should definitely be an OpenPF2 command, but UE will sometimes
 			// replicate entries in this->Queue as NULL.
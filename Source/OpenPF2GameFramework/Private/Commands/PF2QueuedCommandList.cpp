@@ -0,0 +1,328 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Commands/PF2QueuedCommandList.h"
+
+#include "Commands/PF2CharacterCommand.h"
+#include "Commands/PF2CommandQueueComponent.h"
+
+const int32 FPF2QueuedCommandList::SortKeySpacing = 1 << 10;
+
+void FPF2QueuedCommand::PreReplicatedRemove(const FPF2QueuedCommandList& InArraySerializer)
+{
+	UPF2CommandQueueComponent* OwningComponent = InArraySerializer.GetOwningComponent();
+
+	if (OwningComponent != nullptr)
+	{
+		OwningComponent->OnRep_QueuedCommandRemoved(*this);
+	}
+}
+
+void FPF2QueuedCommand::PostReplicatedAdd(const FPF2QueuedCommandList& InArraySerializer)
+{
+	UPF2CommandQueueComponent* OwningComponent = InArraySerializer.GetOwningComponent();
+
+	if (OwningComponent != nullptr)
+	{
+		OwningComponent->OnRep_QueuedCommandAdded(*this);
+	}
+}
+
+void FPF2QueuedCommand::PostReplicatedChange(const FPF2QueuedCommandList& InArraySerializer)
+{
+	UPF2CommandQueueComponent* OwningComponent = InArraySerializer.GetOwningComponent();
+
+	if (OwningComponent != nullptr)
+	{
+		OwningComponent->OnRep_QueuedCommandChanged(*this);
+	}
+}
+
+AInfo* FPF2QueuedCommandList::GetCommandAt(const int32 Position) const
+{
+	AInfo* Command = nullptr;
+
+	if (this->OrderedCommandIds.Num() == this->Items.Num())
+	{
+		// On the server, the ring buffer tracks the order of commands.
+		if ((Position >= 0) && (Position < this->OrderedCommandIds.Num()))
+		{
+			Command = this->FindCommandById(this->OrderedCommandIds[Position]);
+		}
+	}
+	else
+	{
+		// On clients, the order of commands has to be reconstructed from their sort keys.
+		const TArray<AInfo*> Commands = this->GetCommandsInOrder();
+
+		if (Commands.IsValidIndex(Position))
+		{
+			Command = Commands[Position];
+		}
+	}
+
+	return Command;
+}
+
+AInfo* FPF2QueuedCommandList::FindCommandById(const int32 CommandId) const
+{
+	AInfo*                   Command      = nullptr;
+	const int32*             ItemPosition = this->ItemPositionsByCommandId.Find(CommandId);
+	const FPF2QueuedCommand* Item;
+
+	if (ItemPosition == nullptr)
+	{
+		// Clients do not maintain an index of items, so we have to search for the command.
+		Item = this->Items.FindByPredicate(
+			[CommandId](const FPF2QueuedCommand& CurrentItem)
+			{
+				return CurrentItem.CommandId == CommandId;
+			});
+	}
+	else
+	{
+		Item = &this->Items[*ItemPosition];
+	}
+
+	if (Item != nullptr)
+	{
+		Command = Item->Command;
+	}
+
+	return Command;
+}
+
+TArray<AInfo*> FPF2QueuedCommandList::GetCommandsInOrder() const
+{
+	TArray<AInfo*> Commands;
+
+	Commands.Reserve(this->Items.Num());
+
+	if (this->OrderedCommandIds.Num() == this->Items.Num())
+	{
+		for (int32 Position = 0; Position < this->OrderedCommandIds.Num(); ++Position)
+		{
+			Commands.Add(this->FindCommandById(this->OrderedCommandIds[Position]));
+		}
+	}
+	else
+	{
+		TArray<const FPF2QueuedCommand*> SortedItems;
+
+		SortedItems.Reserve(this->Items.Num());
+
+		for (const FPF2QueuedCommand& Item : this->Items)
+		{
+			SortedItems.Add(&Item);
+		}
+
+		SortedItems.Sort(
+			[](const FPF2QueuedCommand& Item1, const FPF2QueuedCommand& Item2)
+			{
+				return Item1.SortKey < Item2.SortKey;
+			});
+
+		for (const FPF2QueuedCommand* Item : SortedItems)
+		{
+			// Skip items for which a local copy of the command could not be created.
+			if (Item->Command != nullptr)
+			{
+				Commands.Add(Item->Command);
+			}
+		}
+	}
+
+	return Commands;
+}
+
+void FPF2QueuedCommandList::Insert(APF2CharacterCommand* Command, const int32 Position)
+{
+	const int32 NumCommands       = this->OrderedCommandIds.Num();
+	const int32 CommandId         = this->NextCommandId++;
+	bool        bNeedsNewSortKeys = false;
+	int32       SortKey;
+	int32       ItemPosition;
+
+	check((Position >= 0) && (Position <= NumCommands));
+	checkf(!this->Contains(Command), TEXT("The same command can only exist in the queue once."));
+
+	if (NumCommands == 0)
+	{
+		SortKey = 0;
+	}
+	else if (Position == 0)
+	{
+		SortKey = this->GetItemByCommandId(this->OrderedCommandIds.First()).SortKey - SortKeySpacing;
+	}
+	else if (Position == NumCommands)
+	{
+		SortKey = this->GetItemByCommandId(this->OrderedCommandIds.Last()).SortKey + SortKeySpacing;
+	}
+	else
+	{
+		const int32 PreviousSortKey = this->GetItemByCommandId(this->OrderedCommandIds[Position - 1]).SortKey,
+		            NextSortKey     = this->GetItemByCommandId(this->OrderedCommandIds[Position]).SortKey;
+
+		if ((NextSortKey - PreviousSortKey) > 1)
+		{
+			SortKey = PreviousSortKey + ((NextSortKey - PreviousSortKey) / 2);
+		}
+		else
+		{
+			// There is no room between the adjacent commands, so every command will need a new sort key.
+			SortKey           = 0;
+			bNeedsNewSortKeys = true;
+		}
+	}
+
+	// Commands are nearly always added to the front or back of the queue, which the ring buffer handles without moving
+	// any other elements. Inserting elsewhere requires temporarily removing the commands ahead of the new command.
+	if (Position == NumCommands)
+	{
+		this->OrderedCommandIds.Add(CommandId);
+	}
+	else
+	{
+		TArray<int32, TInlineAllocator<4>> CommandIdsAhead;
+
+		CommandIdsAhead.Reserve(Position);
+
+		for (int32 Index = 0; Index < Position; ++Index)
+		{
+			CommandIdsAhead.Add(this->OrderedCommandIds.PopFrontValue());
+		}
+
+		this->OrderedCommandIds.AddFront(CommandId);
+
+		for (int32 Index = CommandIdsAhead.Num() - 1; Index >= 0; --Index)
+		{
+			this->OrderedCommandIds.AddFront(CommandIdsAhead[Index]);
+		}
+	}
+
+	ItemPosition = this->Items.AddDefaulted();
+
+	FPF2QueuedCommand& Item = this->Items[ItemPosition];
+
+	Item.CommandId               = CommandId;
+	Item.SortKey                 = SortKey;
+	Item.AbilitySpecHandle       = Command->GetAbilitySpecHandle();
+	Item.AbilityPayload          = Command->GetAbilityPayload();
+	Item.QueuePositionPreference = Command->GetQueuePositionPreference();
+	Item.Command                 = Command;
+
+	this->ItemPositionsByCommandId.Add(CommandId, ItemPosition);
+	this->CommandIdsByCommand.Add(Command, CommandId);
+
+	if (bNeedsNewSortKeys)
+	{
+		this->ReassignSortKeys();
+	}
+	else
+	{
+		this->MarkItemDirty(Item);
+	}
+}
+
+AInfo* FPF2QueuedCommandList::RemoveAt(const int32 Position)
+{
+	AInfo* Command = nullptr;
+
+	if ((Position >= 0) && (Position < this->OrderedCommandIds.Num()))
+	{
+		const int32 CommandId = this->OrderedCommandIds[Position];
+
+		if (Position == 0)
+		{
+			this->OrderedCommandIds.PopFront();
+		}
+		else
+		{
+			this->OrderedCommandIds.RemoveAt(Position);
+		}
+
+		Command = this->RemoveItemByCommandId(CommandId);
+	}
+
+	return Command;
+}
+
+bool FPF2QueuedCommandList::Remove(const AInfo* Command)
+{
+	bool         bWasRemoved = false;
+	const int32* CommandId   = this->CommandIdsByCommand.Find(Command);
+
+	if (CommandId != nullptr)
+	{
+		for (int32 Position = 0; Position < this->OrderedCommandIds.Num(); ++Position)
+		{
+			if (this->OrderedCommandIds[Position] == *CommandId)
+			{
+				this->RemoveAt(Position);
+
+				bWasRemoved = true;
+				break;
+			}
+		}
+	}
+
+	return bWasRemoved;
+}
+
+void FPF2QueuedCommandList::Reset()
+{
+	this->Items.Reset();
+	this->OrderedCommandIds.Reset();
+	this->ItemPositionsByCommandId.Reset();
+	this->CommandIdsByCommand.Reset();
+
+	this->MarkArrayDirty();
+}
+
+void FPF2QueuedCommandList::PostReplicatedReceive(
+	const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters) const
+{
+	if (this->OwningComponent != nullptr)
+	{
+		this->OwningComponent->OnRep_QueuedCommands();
+	}
+}
+
+FPF2QueuedCommand& FPF2QueuedCommandList::GetItemByCommandId(const int32 CommandId)
+{
+	return this->Items[this->ItemPositionsByCommandId.FindChecked(CommandId)];
+}
+
+AInfo* FPF2QueuedCommandList::RemoveItemByCommandId(const int32 CommandId)
+{
+	const int32 ItemPosition = this->ItemPositionsByCommandId.FindAndRemoveChecked(CommandId);
+	AInfo*      Command      = this->Items[ItemPosition].Command;
+
+	this->CommandIdsByCommand.Remove(Command);
+
+	// Items are not kept in queue order, so the last item can be moved into the vacated slot.
+	this->Items.RemoveAtSwap(ItemPosition, 1, false);
+
+	if (ItemPosition < this->Items.Num())
+	{
+		this->ItemPositionsByCommandId[this->Items[ItemPosition].CommandId] = ItemPosition;
+	}
+
+	this->MarkArrayDirty();
+
+	return Command;
+}
+
+void FPF2QueuedCommandList::ReassignSortKeys()
+{
+	for (int32 Position = 0; Position < this->OrderedCommandIds.Num(); ++Position)
+	{
+		FPF2QueuedCommand& Item = this->GetItemByCommandId(this->OrderedCommandIds[Position]);
+
+		Item.SortKey = Position * SortKeySpacing;
+
+		this->MarkItemDirty(Item);
+	}
+}
@@ -0,0 +1,174 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Dice/PF2BatchRoller.h"
+
+#include "OpenPF2GameFramework.h"
+
+namespace
+{
+	/**
+	 * The multiplier of the linear congruential generator (LCG) used for each lane.
+	 *
+	 * These are the constants from "Numerical Recipes", which give a full period of 2^32.
+	 */
+	constexpr uint32 LaneMultiplier = 1664525u;
+
+	/**
+	 * The increment of the linear congruential generator (LCG) used for each lane.
+	 */
+	constexpr uint32 LaneIncrement = 1013904223u;
+
+	/**
+	 * The largest histogram (in number of distinct sums) that RollHistogram() will allocate.
+	 */
+	constexpr int64 MaxHistogramSize = 1 << 24;
+
+	static_assert(
+		(FPF2BatchRoller::BlockSize % FPF2BatchRoller::LaneCount) == 0,
+		"The block size of the batch roller must be a multiple of its lane count."
+	);
+}
+
+FPF2BatchRoller::FPF2BatchRoller(const int32 Seed)
+{
+	FRandomStream SeedSource(Seed);
+
+	for (uint32& LaneState : this->LaneStates)
+	{
+		LaneState = SeedSource.GetUnsignedInt();
+	}
+}
+
+FPF2BatchRoller::FPF2BatchRoller(FRandomStream& SeedSource)
+{
+	for (uint32& LaneState : this->LaneStates)
+	{
+		LaneState = SeedSource.GetUnsignedInt();
+	}
+}
+
+void FPF2BatchRoller::RollSums(const FPF2DiceExpression& Expression, TArrayView<int32> OutSums)
+{
+	const int32 NumSums = OutSums.Num();
+	int32*      Sums    = OutSums.GetData();
+
+	if (!Expression.bIsValid)
+	{
+		FMemory::Memzero(Sums, NumSums * sizeof(int32));
+		return;
+	}
+
+	for (int32 StartIndex = 0; StartIndex < NumSums; StartIndex += BlockSize)
+	{
+		this->RollBlock(Expression, Sums + StartIndex, FMath::Min(BlockSize, NumSums - StartIndex));
+	}
+}
+
+void FPF2BatchRoller::RollHistogram(const FPF2DiceExpression& Expression,
+                                    const int64               NumRolls,
+                                    TArray<int64>&            OutHistogram)
+{
+	OutHistogram.Reset();
+
+	if (!Expression.bIsValid)
+	{
+		return;
+	}
+
+	const int32 MinSum        = Expression.GetMinSum();
+	const int64 HistogramSize = static_cast<int64>(Expression.GetMaxSum()) - MinSum + 1;
+
+	if (HistogramSize <= 0)
+	{
+		UE_LOG(
+			LogPf2Core,
+			Error,
+			TEXT("Cannot build a histogram for '%s' because its maximum sum is less than its minimum sum."),
+			*Expression.ToString()
+		);
+
+		return;
+	}
+
+	if (HistogramSize > MaxHistogramSize)
+	{
+		UE_LOG(
+			LogPf2Core,
+			Error,
+			TEXT("Cannot build a histogram for '%s' because it has too many distinct sums (%lld)."),
+			*Expression.ToString(),
+			HistogramSize
+		);
+
+		return;
+	}
+
+	int32 Sums[BlockSize];
+
+	OutHistogram.SetNumZeroed(HistogramSize);
+
+	for (int64 RollsRemaining = NumRolls; RollsRemaining > 0; RollsRemaining -= BlockSize)
+	{
+		const int32 Count = static_cast<int32>(FMath::Min<int64>(BlockSize, RollsRemaining));
+
+		this->RollBlock(Expression, Sums, Count);
+
+		for (int32 SumIndex = 0; SumIndex < Count; ++SumIndex)
+		{
+			++OutHistogram[Sums[SumIndex] - MinSum];
+		}
+	}
+}
+
+void FPF2BatchRoller::FillRandomBlock(uint32* OutBlock)
+{
+	// Working on a local copy of the lane states lets the compiler keep them in vector registers, since it can then
+	// prove that writes to the output block do not alias them.
+	alignas(32) uint32 States[LaneCount];
+
+	FMemory::Memcpy(States, this->LaneStates, sizeof(States));
+
+	for (int32 BlockIndex = 0; BlockIndex < BlockSize; BlockIndex += LaneCount)
+	{
+		for (int32 LaneIndex = 0; LaneIndex < LaneCount; ++LaneIndex)
+		{
+			States[LaneIndex] = (States[LaneIndex] * LaneMultiplier) + LaneIncrement;
+
+			OutBlock[BlockIndex + LaneIndex] = States[LaneIndex];
+		}
+	}
+
+	FMemory::Memcpy(this->LaneStates, States, sizeof(States));
+}
+
+void FPF2BatchRoller::RollBlock(const FPF2DiceExpression& Expression, int32* OutSums, const int32 Count)
+{
+	check(Count <= BlockSize);
+
+	alignas(32) uint32 RandomBlock[BlockSize];
+
+	const int32  Modifier  = Expression.Modifier;
+	const uint64 DieSize   = static_cast<uint64>(FMath::Max(0, Expression.DieSize));
+	const int32  RollCount = (DieSize == 0) ? 0 : Expression.RollCount;
+
+	for (int32 SumIndex = 0; SumIndex < Count; ++SumIndex)
+	{
+		OutSums[SumIndex] = Modifier;
+	}
+
+	// A zero-sided die always rolls 0 (see UPF2DiceLibrary::Roll()), so there is nothing to add in that case.
+	for (int32 DieIndex = 0; DieIndex < RollCount; ++DieIndex)
+	{
+		this->FillRandomBlock(RandomBlock);
+
+		// Scale each 32-bit random number into the range [0, DieSize) by taking the high half of a 64-bit product. This
+		// uses the high bits of each LCG output (which are the most random) and avoids a per-element division.
+		for (int32 SumIndex = 0; SumIndex < Count; ++SumIndex)
+		{
+			OutSums[SumIndex] += static_cast<int32>((static_cast<uint64>(RandomBlock[SumIndex]) * DieSize) >> 32) + 1;
+		}
+	}
+}
@@ -0,0 +1,148 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Dice/PF2DiceExpression.h"
+
+namespace
+{
+	/**
+	 * Consumes a run of decimal digits from the given position in an expression.
+	 *
+	 * @param [in] Expression
+	 *	The expression being parsed.
+	 * @param [in,out] Position
+	 *	The position at which to begin reading. Receives the position immediately after the last digit consumed.
+	 * @param [out] OutValue
+	 *	A reference to the variable to receive the parsed value.
+	 *
+	 * @return
+	 *	Whether at least one (and no more than the maximum allowed number of) digits were consumed.
+	 */
+	bool ConsumeNumber(const FString& Expression, int32& Position, int32& OutValue)
+	{
+		const int32 StartPosition = Position;
+		int32       Value         = 0;
+
+		while ((Position < Expression.Len()) && FChar::IsDigit(Expression[Position]))
+		{
+			Value = (Value * 10) + (Expression[Position] - TEXT('0'));
+			++Position;
+
+			if ((Position - StartPosition) > FPF2DiceExpression::MaxDigitsPerComponent)
+			{
+				return false;
+			}
+		}
+
+		OutValue = Value;
+
+		return (Position != StartPosition);
+	}
+}
+
+FRWLock                         FPF2DiceExpressionCache::CacheLock;
+TMap<FName, FPF2DiceExpression> FPF2DiceExpressionCache::CompiledExpressions;
+
+FPF2DiceExpression FPF2DiceExpression::Parse(const FString& RollExpression)
+{
+	int32 Position = 0,
+	      RollCount,
+	      DieSize,
+	      Modifier = 0;
+
+	if (!ConsumeNumber(RollExpression, Position, RollCount))
+	{
+		return FPF2DiceExpression();
+	}
+
+	if ((Position >= RollExpression.Len()) || (FChar::ToLower(RollExpression[Position]) != TEXT('d')))
+	{
+		return FPF2DiceExpression();
+	}
+
+	++Position;
+
+	if (!ConsumeNumber(RollExpression, Position, DieSize))
+	{
+		return FPF2DiceExpression();
+	}
+
+	if (Position < RollExpression.Len())
+	{
+		const TCHAR Sign = RollExpression[Position];
+
+		if ((Sign != TEXT('+')) && (Sign != TEXT('-')))
+		{
+			return FPF2DiceExpression();
+		}
+
+		++Position;
+
+		if (!ConsumeNumber(RollExpression, Position, Modifier) || (Position != RollExpression.Len()))
+		{
+			return FPF2DiceExpression();
+		}
+
+		if (Sign == TEXT('-'))
+		{
+			Modifier = -Modifier;
+		}
+	}
+
+	return FPF2DiceExpression(RollCount, DieSize, Modifier);
+}
+
+FString FPF2DiceExpression::ToString() const
+{
+	if (!this->bIsValid)
+	{
+		return TEXT("0d0");
+	}
+	else if (this->Modifier > 0)
+	{
+		return FString::Printf(TEXT("%dd%d+%d"), this->RollCount, this->DieSize, this->Modifier);
+	}
+	else if (this->Modifier < 0)
+	{
+		return FString::Printf(TEXT("%dd%d-%d"), this->RollCount, this->DieSize, -this->Modifier);
+	}
+	else
+	{
+		return FString::Printf(TEXT("%dd%d"), this->RollCount, this->DieSize);
+	}
+}
+
+FPF2DiceExpression FPF2DiceExpressionCache::Get(const FName RollExpression)
+{
+	FPF2DiceExpression Result;
+
+	{
+		FReadScopeLock ReadLock(CacheLock);
+
+		if (const FPF2DiceExpression* CachedExpression = CompiledExpressions.Find(RollExpression))
+		{
+			return *CachedExpression;
+		}
+	}
+
+	Result = FPF2DiceExpression::Parse(RollExpression.ToString());
+
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+
+		// Another thread may have compiled the same expression while we were parsing it; both results are identical, so
+		// it does not matter which one wins.
+		CompiledExpressions.Add(RollExpression, Result);
+	}
+
+	return Result;
+}
+
+void FPF2DiceExpressionCache::Reset()
+{
+	FWriteScopeLock WriteLock(CacheLock);
+
+	CompiledExpressions.Empty();
+}
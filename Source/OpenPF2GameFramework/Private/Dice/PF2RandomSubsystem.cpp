@@ -0,0 +1,202 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Dice/PF2RandomSubsystem.h"
+
+#include <Engine/World.h>
+
+#include <GameFramework/Actor.h>
+
+#include <Misc/CommandLine.h>
+
+#include "OpenPF2GameFramework.h"
+
+#include "Libraries/PF2DiceLibrary.h"
+
+namespace
+{
+	/**
+	 * Value mixed into the key of each worker stream, so that worker streams do not share seeds with character streams.
+	 */
+	const uint32 WorkerStreamKeySalt = 0x5046574B;
+}
+
+UPF2RandomSubsystem* UPF2RandomSubsystem::Get(const UObject* WorldContextObject)
+{
+	UPF2RandomSubsystem* Result = nullptr;
+
+	if (WorldContextObject != nullptr)
+	{
+		if (const UWorld* World = WorldContextObject->GetWorld(); World != nullptr)
+		{
+			Result = World->GetSubsystem<UPF2RandomSubsystem>();
+		}
+	}
+
+	return Result;
+}
+
+void UPF2RandomSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	int32 Seed;
+
+	Super::Initialize(Collection);
+
+	if (FParse::Value(FCommandLine::Get(), TEXT("PF2RandomSeed="), Seed))
+	{
+		UE_LOG(LogPf2Core, Log, TEXT("Seeding dice rolls for world ('%s') with '%d'."), *GetWorld()->GetName(), Seed);
+
+		this->SetRandomSeed(Seed);
+	}
+	else
+	{
+		// NAME_None forces the RNG to initialize itself with a random seed.
+		this->WorldStream = FRandomStream(NAME_None);
+	}
+
+	this->WorldTickStartHandle =
+		FWorldDelegates::OnWorldTickStart.AddUObject(this, &UPF2RandomSubsystem::OnWorldTickStart);
+
+	this->WorldTickEndHandle =
+		FWorldDelegates::OnWorldTickEnd.AddUObject(this, &UPF2RandomSubsystem::OnWorldTickEnd);
+}
+
+void UPF2RandomSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(this->WorldTickStartHandle);
+	FWorldDelegates::OnWorldTickEnd.Remove(this->WorldTickEndHandle);
+
+	// Should only happen if the world is torn down mid-tick, but we must not leave a dangling stream bound.
+	if (UPF2DiceLibrary::GetActiveRandomStream() == &this->WorldStream)
+	{
+		UPF2DiceLibrary::SetActiveRandomStream(this->PreviousActiveStream);
+	}
+
+	this->PreviousActiveStream = nullptr;
+
+	{
+		FWriteScopeLock WriteLock(this->WorkerStreamsLock);
+
+		this->WorkerStreams.Empty();
+	}
+
+	{
+		FWriteScopeLock WriteLock(this->CharacterStreamsLock);
+
+		this->CharacterStreams.Empty();
+	}
+
+	Super::Deinitialize();
+}
+
+int32 UPF2RandomSubsystem::GetRandomSeed() const
+{
+	return this->WorldStream.GetInitialSeed();
+}
+
+void UPF2RandomSubsystem::SetRandomSeed(const int32 Seed)
+{
+	check(IsInGameThread());
+
+	this->WorldStream.Initialize(Seed);
+
+	{
+		FWriteScopeLock WriteLock(this->WorkerStreamsLock);
+
+		this->WorkerStreams.Empty();
+	}
+
+	{
+		FWriteScopeLock WriteLock(this->CharacterStreamsLock);
+
+		this->CharacterStreams.Empty();
+	}
+}
+
+FRandomStream& UPF2RandomSubsystem::GetWorkerStream(const int32 WorkerIndex)
+{
+	{
+		FReadScopeLock ReadLock(this->WorkerStreamsLock);
+
+		if (const TUniquePtr<FRandomStream>* Stream = this->WorkerStreams.Find(WorkerIndex))
+		{
+			return **Stream;
+		}
+	}
+
+	{
+		FWriteScopeLock WriteLock(this->WorkerStreamsLock);
+
+		TUniquePtr<FRandomStream>& Stream = this->WorkerStreams.FindOrAdd(WorkerIndex);
+
+		// Another thread may have created the stream between our read lock and our write lock.
+		if (!Stream.IsValid())
+		{
+			Stream = MakeUnique<FRandomStream>(
+				this->DeriveChildSeed(HashCombine(WorkerStreamKeySalt, GetTypeHash(WorkerIndex)))
+			);
+		}
+
+		return *Stream;
+	}
+}
+
+FRandomStream& UPF2RandomSubsystem::GetCharacterStream(const AActor* Character)
+{
+	check(Character != nullptr);
+
+	const FName CharacterName = Character->GetFName();
+
+	{
+		FReadScopeLock ReadLock(this->CharacterStreamsLock);
+
+		if (const TUniquePtr<FRandomStream>* Stream = this->CharacterStreams.Find(CharacterName))
+		{
+			return **Stream;
+		}
+	}
+
+	{
+		FWriteScopeLock WriteLock(this->CharacterStreamsLock);
+
+		TUniquePtr<FRandomStream>& Stream = this->CharacterStreams.FindOrAdd(CharacterName);
+
+		// Another thread may have created the stream between our read lock and our write lock.
+		if (!Stream.IsValid())
+		{
+			Stream = MakeUnique<FRandomStream>(this->DeriveChildSeed(GetTypeHash(CharacterName.ToString())));
+		}
+
+		return *Stream;
+	}
+}
+
+FRandomStream UPF2RandomSubsystem::CreateChildStream(const uint32 StreamKey) const
+{
+	return FRandomStream(this->DeriveChildSeed(StreamKey));
+}
+
+void UPF2RandomSubsystem::OnWorldTickStart(UWorld* TickingWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (TickingWorld == this->GetWorld())
+	{
+		this->PreviousActiveStream = UPF2DiceLibrary::SetActiveRandomStream(&this->WorldStream);
+	}
+}
+
+void UPF2RandomSubsystem::OnWorldTickEnd(UWorld* TickingWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (TickingWorld == this->GetWorld())
+	{
+		UPF2DiceLibrary::SetActiveRandomStream(this->PreviousActiveStream);
+
+		this->PreviousActiveStream = nullptr;
+	}
+}
+
+int32 UPF2RandomSubsystem::DeriveChildSeed(const uint32 StreamKey) const
+{
+	return static_cast<int32>(HashCombine(static_cast<uint32>(this->WorldStream.GetInitialSeed()), StreamKey));
+}
@@ -5,6 +5,24 @@
 
 #include "GameplayEffects/Components/PF2ConditionalGameplayEffect.h"
 
+FGameplayTagContainer FPF2ConditionalGameplayEffect::GetQueriedTags() const
+{
+	FGameplayTagContainer QueriedTags;
+	TArray<FGameplayTag>  QueryTags;
+
+	QueriedTags.AppendTags(this->SourceRequiredTags);
+	QueriedTags.AppendTags(this->SourceIgnoredTags);
+	QueriedTags.AppendTags(this->TargetRequiredTags);
+	QueriedTags.AppendTags(this->TargetIgnoredTags);
+
+	this->SourceTagQuery.GetGameplayTagArray(QueryTags);
+	this->TargetTagQuery.GetGameplayTagArray(QueryTags);
+
+	QueriedTags.AppendTags(FGameplayTagContainer::CreateFromArray(QueryTags));
+
+	return QueriedTags;
+}
+
 bool FPF2ConditionalGameplayEffect::CanApply(const float                  EffectLevel,
                                              const FGameplayTagContainer& SourceTags,
                                              const FGameplayTagContainer& TargetTags) const
@@ -0,0 +1,124 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "GameplayEffects/PF2WeightGroupRegistry.h"
+
+#include <GameplayTagsManager.h>
+
+#include "OpenPF2GameFramework.h"
+
+#include "Utilities/PF2GameplayAbilityUtilities.h"
+
+namespace
+{
+	/**
+	 * The name of the parent tag of all weight group tags.
+	 */
+	const FName WeightGroupParentTagName = FName(TEXT("GameplayEffect.WeightGroup"));
+}
+
+FPF2WeightGroupRegistry::FPF2WeightGroupRegistry()
+{
+	const FGameplayTag    WeightTagParent = FGameplayTag::RequestGameplayTag(WeightGroupParentTagName, false);
+	FGameplayTagContainer WeightTags;
+	TArray<FName>         WeightGroups;
+
+	if (WeightTagParent.IsValid())
+	{
+		WeightTags = UGameplayTagsManager::Get().RequestGameplayTagChildren(WeightTagParent);
+	}
+
+	for (const FGameplayTag& WeightTag : WeightTags)
+	{
+		WeightGroups.Add(WeightTag.GetTagName());
+	}
+
+	WeightGroups.Sort(FNameLexicalLess());
+
+	for (int32 Priority = 0; Priority < WeightGroups.Num(); ++Priority)
+	{
+		this->PrioritiesByWeightGroup.Add(WeightGroups[Priority], Priority);
+	}
+
+	UE_LOG(
+		LogPf2Core,
+		Verbose,
+		TEXT("Registered the priorities of %d passive GE weight groups."),
+		this->PrioritiesByWeightGroup.Num()
+	);
+}
+
+FName FPF2WeightGroupRegistry::GetWeightGroupOfGameplayEffect(const TSubclassOf<UGameplayEffect> GameplayEffect,
+                                                              const FName                        DefaultWeight)
+{
+	const FObjectKey EffectKey(GameplayEffect.Get());
+	FName            WeightGroup;
+	bool             bIsCached;
+
+	{
+		FReadScopeLock ReadLock(this->EffectCacheLock);
+
+		const FName* CachedWeightGroup = this->WeightGroupsByEffect.Find(EffectKey);
+
+		bIsCached = (CachedWeightGroup != nullptr);
+
+		if (bIsCached)
+		{
+			WeightGroup = *CachedWeightGroup;
+		}
+	}
+
+	if (!bIsCached)
+	{
+		WeightGroup = LookupWeightGroupOfGameplayEffect(GameplayEffect);
+
+		{
+			FWriteScopeLock WriteLock(this->EffectCacheLock);
+
+			this->WeightGroupsByEffect.Add(EffectKey, WeightGroup);
+		}
+	}
+
+	if (WeightGroup.IsNone())
+	{
+		WeightGroup = DefaultWeight;
+	}
+
+	return WeightGroup;
+}
+
+FName FPF2WeightGroupRegistry::LookupWeightGroupOfGameplayEffect(const TSubclassOf<UGameplayEffect> GameplayEffect)
+{
+	FName                  WeightGroup;
+	const FGameplayTag     WeightTagParent = PF2GameplayAbilityUtilities::GetTag(WeightGroupParentTagName);
+	const UGameplayEffect* Effect          = GameplayEffect.GetDefaultObject();
+
+	const FGameplayTagContainer WeightTags = Effect->GetAssetTags().Filter(FGameplayTagContainer(WeightTagParent));
+
+	if (WeightTags.IsEmpty())
+	{
+		WeightGroup = NAME_None;
+	}
+	else
+	{
+		const FGameplayTag WeightTag = WeightTags.First();
+
+		checkf(
+			WeightTags.Num() < 2,
+			TEXT("A Gameplay Effect can only have a single weight group assigned (this GE has been assigned '%d' weight groups)."),
+			WeightTags.Num()
+		);
+
+		checkf(
+			WeightTag != WeightTagParent,
+			TEXT("Parent tag of weight groups ('%s') cannot be used as a weight group "),
+			*WeightTagParent.ToString()
+		);
+
+		WeightGroup = WeightTag.GetTagName();
+	}
+
+	return WeightGroup;
+}
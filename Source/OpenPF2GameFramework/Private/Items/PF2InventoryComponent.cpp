@@ -11,26 +11,31 @@
 
 #include <Net/UnrealNetwork.h>
 
-#include <UObject/WeakInterfacePtr.h>
-
 #include "OpenPF2GameFramework.h"
 
 #include "Items/PF2ItemInterface.h"
 
-#include "Utilities/PF2ArrayUtilities.h"
 #include "Utilities/PF2InterfaceUtilities.h"
 #include "Utilities/PF2LogUtilities.h"
 
-UPF2InventoryComponent::UPF2InventoryComponent() : Events(nullptr)
+UPF2InventoryComponent::UPF2InventoryComponent() : Events(nullptr), bHaveItemsBeenRemoved(false)
 {
 	this->SetIsReplicatedByDefault(true);
 }
 
+void UPF2InventoryComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// This cannot be done in the constructor because properties get copied from the archetype after construction.
+	this->InventoryItems.SetOwningComponent(this);
+}
+
 void UPF2InventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(UPF2InventoryComponent, InventoryItemIds);
+	DOREPLIFETIME(UPF2InventoryComponent, InventoryItems);
 }
 
 UObject* UPF2InventoryComponent::GetGenericEventsObject() const
@@ -58,21 +63,21 @@ UPF2InventoryInterfaceEvents* UPF2InventoryComponent::GetEvents() const
 
 TArray<TScriptInterface<IPF2ItemInterface>> UPF2InventoryComponent::GetContents() const
 {
-	return PF2InterfaceUtilities::ToScriptInterfaces(this->InventoryItemsLoaded);
+	return this->InventoryItems.GetLoadedItems();
 }
 
 void UPF2InventoryComponent::AddItem(const TScriptInterface<IPF2ItemInterface>& ItemToAdd)
 {
-	this->InventoryItemIds.AddUnique(ItemToAdd->GetPrimaryAssetId());
-
-	this->Native_OnItemAddedToInventory(ItemToAdd);
-	this->Native_OnInventoryChanged();
+	if (this->InventoryItems.Add(ItemToAdd->GetPrimaryAssetId(), ItemToAdd))
+	{
+		this->Native_OnItemAddedToInventory(ItemToAdd);
+		this->Native_OnInventoryChanged();
+	}
 }
 
 bool UPF2InventoryComponent::RemoveItem(const TScriptInterface<IPF2ItemInterface>& ItemToRemove)
 {
-	const int32 CountOfRemoved  = this->InventoryItemIds.Remove(ItemToRemove->GetPrimaryAssetId());
-	const bool  bWasItemRemoved = (CountOfRemoved > 0);
+	const bool bWasItemRemoved = this->InventoryItems.Remove(ItemToRemove->GetPrimaryAssetId());
 
 	if (bWasItemRemoved)
 	{
@@ -85,7 +90,19 @@ bool UPF2InventoryComponent::RemoveItem(const TScriptInterface<IPF2ItemInterface
 
 void UPF2InventoryComponent::ClearItems()
 {
-	this->InventoryItemIds.Empty();
+	const TArray<TScriptInterface<IPF2ItemInterface>> RemovedItems = this->InventoryItems.GetLoadedItems();
+
+	this->InventoryItems.Reset();
+
+	for (const TScriptInterface<IPF2ItemInterface>& RemovedItem : RemovedItems)
+	{
+		this->Native_OnItemRemovedFromInventory(RemovedItem);
+	}
+
+	if (RemovedItems.Num() != 0)
+	{
+		this->Native_OnInventoryChanged();
+	}
 }
 
 UActorComponent* UPF2InventoryComponent::ToActorComponent()
@@ -125,57 +142,140 @@ void UPF2InventoryComponent::LoadItemsById(const TArray<FPrimaryAssetId>& ItemAs
 	}
 }
 
-void UPF2InventoryComponent::OnRep_InventoryItemIds()
+TScriptInterface<IPF2ItemInterface> UPF2InventoryComponent::GetLoadedItemById(const FPrimaryAssetId& ItemAssetId) const
 {
-	this->LoadItemsById(this->InventoryItemIds, [this](const TArray<IPF2ItemInterface*>& LoadedItems)
+	const UAssetManager*                AssetManager = GetAssetManager();
+	TScriptInterface<IPF2ItemInterface> Item;
+
+	if (AssetManager != nullptr)
 	{
-		this->Native_OnInventoryItemsLoaded(LoadedItems);
-	});
+		IPF2ItemInterface* ItemIntf = Cast<IPF2ItemInterface>(AssetManager->GetPrimaryAssetObject(ItemAssetId));
+
+		if (ItemIntf != nullptr)
+		{
+			Item = PF2InterfaceUtilities::ToScriptInterface(ItemIntf);
+		}
+	}
+
+	return Item;
 }
 
-void UPF2InventoryComponent::Native_OnInventoryItemsLoaded(const TArray<IPF2ItemInterface*>& NewInventory)
+void UPF2InventoryComponent::OnRep_InventoryItemAdded(FPF2InventoryItemEntry& Entry)
 {
-	const TArray<IPF2ItemInterface*>& OldInventory = this->InventoryItemsLoaded;
-	TArray<IPF2ItemInterface*>        RemovedItems,
-	                                  AddedItems;
+	this->PendingItemLoads.Add(Entry.ReplicationID);
+}
 
-	PF2ArrayUtilities::CapturePtrDeltasWithCast(OldInventory, NewInventory, RemovedItems, AddedItems);
+void UPF2InventoryComponent::OnRep_InventoryItemChanged(FPF2InventoryItemEntry& Entry)
+{
+	const TScriptInterface<IPF2ItemInterface> OldItem = Entry.Item;
 
-	// We execute this logic even if we have no registered listeners because we still need to do internal bookkeeping
-	// when the queue changes.
-	for (IPF2ItemInterface* const& RemovedItem : RemovedItems)
+	if ((OldItem.GetObject() != nullptr) && (OldItem->GetPrimaryAssetId() != Entry.ItemId))
 	{
-		this->Native_OnItemRemovedFromInventory(PF2InterfaceUtilities::ToScriptInterface(RemovedItem));
+		Entry.Item = nullptr;
+
+		this->Native_OnItemRemovedFromInventory(OldItem);
+
+		this->bHaveItemsBeenRemoved = true;
 	}
 
-	for (IPF2ItemInterface* const& AddedItem : AddedItems)
+	if (Entry.Item.GetObject() == nullptr)
 	{
-		this->Native_OnItemAddedToInventory(PF2InterfaceUtilities::ToScriptInterface(AddedItem));
+		this->PendingItemLoads.Add(Entry.ReplicationID);
 	}
+}
+
+void UPF2InventoryComponent::OnRep_InventoryItemRemoved(FPF2InventoryItemEntry& Entry)
+{
+	// If the item is still loading, listeners were never told it was added, so there is nothing to notify them about.
+	this->PendingItemLoads.Remove(Entry.ReplicationID);
 
-	if ((RemovedItems.Num() != 0) || (AddedItems.Num() != 0))
+	if (Entry.Item.GetObject() != nullptr)
 	{
-		this->Native_OnInventoryChanged();
+		this->Native_OnItemRemovedFromInventory(Entry.Item);
+
+		this->bHaveItemsBeenRemoved = true;
 	}
 }
 
-void UPF2InventoryComponent::Native_OnInventoryChanged()
+void UPF2InventoryComponent::OnRep_InventoryItems()
 {
-	const FPF2InventoryComponentInventoryChangedDelegate InventoryChangedDelegate = this->GetEvents()->OnInventoryChanged;
+	if (this->bHaveItemsBeenRemoved)
+	{
+		this->bHaveItemsBeenRemoved = false;
 
-	if (InventoryChangedDelegate.IsBound())
+		this->Native_OnInventoryChanged();
+	}
+
+	if (!this->PendingItemLoads.IsEmpty())
 	{
-		TArray<TScriptInterface<IPF2ItemInterface>> InventoryItems;
+		const TSet<int32>               ReplicationIds = MoveTemp(this->PendingItemLoads);
+		TArray<FPrimaryAssetId>         ItemIdsToLoad;
+		TArray<FPF2InventoryItemEntry*> Entries        = this->InventoryItems.FindItemsByReplicationId(ReplicationIds);
 
-		for (IPF2ItemInterface* Item : this->InventoryItemsLoaded)
+		ItemIdsToLoad.Reserve(Entries.Num());
+
+		for (const FPF2InventoryItemEntry* Entry : Entries)
 		{
-			// BUGBUG: By the time we're here, this should definitely be an OpenPF2 item, but UE will sometimes
-			// replicate entries in this->InventoryItems as NULL.
-			if (Item != nullptr)
+			ItemIdsToLoad.AddUnique(Entry->ItemId);
+		}
+
+		UE_LOG(
+			LogPf2Inventory,
+			VeryVerbose,
+			TEXT("[%s] Loading %d replicated item(s) for character inventory ('%s')."),
+			*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+			ItemIdsToLoad.Num(),
+			*(this->GetIdForLogs())
+		);
+
+		// Entries can be removed or replaced while their assets are loading, so they are looked up again (by
+		// replication ID) once the load completes rather than being captured here.
+		this->LoadItemsById(
+			ItemIdsToLoad,
+			FStreamableDelegate::CreateUObject(
+				this,
+				&UPF2InventoryComponent::Native_OnInventoryItemsLoaded,
+				ReplicationIds
+			)
+		);
+	}
+}
+
+void UPF2InventoryComponent::Native_OnInventoryItemsLoaded(const TSet<int32> ReplicationIds)
+{
+	bool bWereItemsAdded = false;
+
+	for (FPF2InventoryItemEntry* Entry : this->InventoryItems.FindItemsByReplicationId(ReplicationIds))
+	{
+		// Skip entries that were already loaded by a later update.
+		if (Entry->Item.GetObject() == nullptr)
+		{
+			const TScriptInterface<IPF2ItemInterface> Item = this->GetLoadedItemById(Entry->ItemId);
+
+			if (Item.GetObject() != nullptr)
 			{
-				InventoryItems.Add(PF2InterfaceUtilities::ToScriptInterface(Item));
+				Entry->Item = Item;
+
+				this->Native_OnItemAddedToInventory(Entry->Item);
+
+				bWereItemsAdded = true;
 			}
 		}
+	}
+
+	if (bWereItemsAdded)
+	{
+		this->Native_OnInventoryChanged();
+	}
+}
+
+void UPF2InventoryComponent::Native_OnInventoryChanged()
+{
+	const FPF2InventoryComponentInventoryChangedDelegate InventoryChangedDelegate = this->GetEvents()->OnInventoryChanged;
+
+	if (InventoryChangedDelegate.IsBound())
+	{
+		const TArray<TScriptInterface<IPF2ItemInterface>> InventoryContents = this->GetContents();
 
 		UE_LOG(
 			LogPf2Inventory,
@@ -183,7 +283,7 @@ void UPF2InventoryComponent::Native_OnInventoryChanged()
 			TEXT("[%s] Character inventory changed ('%s') - %d elements."),
 			*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
 			*(this->GetIdForLogs()),
-			InventoryItems.Num()
+			InventoryContents.Num()
 		);
 
 		InventoryChangedDelegate.Broadcast(this);
@@ -0,0 +1,150 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Items/PF2InventoryItemList.h"
+
+#include "Items/PF2InventoryComponent.h"
+
+void FPF2InventoryItemEntry::PreReplicatedRemove(const FPF2InventoryItemList& InArraySerializer)
+{
+	UPF2InventoryComponent* OwningComponent = InArraySerializer.GetOwningComponent();
+
+	if (OwningComponent != nullptr)
+	{
+		OwningComponent->OnRep_InventoryItemRemoved(*this);
+	}
+}
+
+void FPF2InventoryItemEntry::PostReplicatedAdd(const FPF2InventoryItemList& InArraySerializer)
+{
+	UPF2InventoryComponent* OwningComponent = InArraySerializer.GetOwningComponent();
+
+	if (OwningComponent != nullptr)
+	{
+		OwningComponent->OnRep_InventoryItemAdded(*this);
+	}
+}
+
+void FPF2InventoryItemEntry::PostReplicatedChange(const FPF2InventoryItemList& InArraySerializer)
+{
+	UPF2InventoryComponent* OwningComponent = InArraySerializer.GetOwningComponent();
+
+	if (OwningComponent != nullptr)
+	{
+		OwningComponent->OnRep_InventoryItemChanged(*this);
+	}
+}
+
+bool FPF2InventoryItemList::Contains(const FPrimaryAssetId& ItemId) const
+{
+	return this->Items.ContainsByPredicate(
+		[&ItemId](const FPF2InventoryItemEntry& Entry)
+		{
+			return Entry.ItemId == ItemId;
+		});
+}
+
+TArray<FPrimaryAssetId> FPF2InventoryItemList::GetItemIds() const
+{
+	TArray<FPrimaryAssetId> ItemIds;
+
+	ItemIds.Reserve(this->Items.Num());
+
+	for (const FPF2InventoryItemEntry& Entry : this->Items)
+	{
+		ItemIds.Add(Entry.ItemId);
+	}
+
+	return ItemIds;
+}
+
+TArray<TScriptInterface<IPF2ItemInterface>> FPF2InventoryItemList::GetLoadedItems() const
+{
+	TArray<TScriptInterface<IPF2ItemInterface>> LoadedItems;
+
+	LoadedItems.Reserve(this->Items.Num());
+
+	for (const FPF2InventoryItemEntry& Entry : this->Items)
+	{
+		// Skip items that clients are still waiting on the asset manager to load.
+		if (Entry.Item.GetObject() != nullptr)
+		{
+			LoadedItems.Add(Entry.Item);
+		}
+	}
+
+	return LoadedItems;
+}
+
+TArray<FPF2InventoryItemEntry*> FPF2InventoryItemList::FindItemsByReplicationId(const TSet<int32>& ReplicationIds)
+{
+	TArray<FPF2InventoryItemEntry*> Entries;
+
+	Entries.Reserve(ReplicationIds.Num());
+
+	for (FPF2InventoryItemEntry& Entry : this->Items)
+	{
+		if (ReplicationIds.Contains(Entry.ReplicationID))
+		{
+			Entries.Add(&Entry);
+		}
+	}
+
+	return Entries;
+}
+
+bool FPF2InventoryItemList::Add(const FPrimaryAssetId& ItemId, const TScriptInterface<IPF2ItemInterface>& Item)
+{
+	const bool bWasAdded = !this->Contains(ItemId);
+
+	if (bWasAdded)
+	{
+		FPF2InventoryItemEntry& Entry = this->Items.AddDefaulted_GetRef();
+
+		Entry.ItemId = ItemId;
+		Entry.Item   = Item;
+
+		this->MarkItemDirty(Entry);
+	}
+
+	return bWasAdded;
+}
+
+bool FPF2InventoryItemList::Remove(const FPrimaryAssetId& ItemId)
+{
+	const int32 ItemPosition = this->Items.IndexOfByPredicate(
+		[&ItemId](const FPF2InventoryItemEntry& Entry)
+		{
+			return Entry.ItemId == ItemId;
+		});
+
+	const bool bWasRemoved = (ItemPosition != INDEX_NONE);
+
+	if (bWasRemoved)
+	{
+		// Inventory is not ordered, so the last item can be moved into the vacated slot.
+		this->Items.RemoveAtSwap(ItemPosition, 1, false);
+
+		this->MarkArrayDirty();
+	}
+
+	return bWasRemoved;
+}
+
+void FPF2InventoryItemList::Reset()
+{
+	this->Items.Reset();
+
+	this->MarkArrayDirty();
+}
+
+void FPF2InventoryItemList::PostReplicatedReceive(
+	const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters) const
+{
+	if (this->OwningComponent != nullptr)
+	{
+		this->OwningComponent->OnRep_InventoryItems();
+	}
+}
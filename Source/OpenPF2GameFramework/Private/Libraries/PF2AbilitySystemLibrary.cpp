@@ -16,6 +16,8 @@
 
 #include "Items/Weapons/PF2WeaponInterface.h"
 
+#include "Utilities/PF2DamageCueUtilities.h"
+
 bool UPF2AbilitySystemLibrary::WasEventTriggeredByAbility(const FGameplayEventData& EventData)
 {
 	const FGameplayEffectContextHandle ContextHandle = EventData.ContextHandle;
@@ -180,6 +182,8 @@ FGameplayEffectSpecHandle UPF2AbilitySystemLibrary::MakeGameplayEffectSpecForWea
 		const FGameplayAbilityActorInfo& AbilityOwnerInfo = AttackAbility->GetActorInfo();
 		AActor*                          OwningActor      = AbilityOwnerInfo.OwnerActor.Get();
 
+		// The spec is deliberately not flagged with the damage type of the weapon. Other GEs on the attacker (e.g.,
+		// runes or passive boosts) can add damage of other types, so damage executions have to consider every type.
 		return MakeGameplayEffectSpecFromAbilityForInstigatorAndCauser(
 			AttackAbility,
 			GameplayEffectClass,
@@ -269,6 +273,35 @@ FGameplayEffectSpecHandle UPF2AbilitySystemLibrary::MakeGameplayEffectSpecFromAb
 	}
 }
 
+FGameplayEffectSpecHandle UPF2AbilitySystemLibrary::AddDamageTypesToGameplayEffectSpec(
+	const FGameplayEffectSpecHandle& GameplayEffectSpec,
+	const FGameplayTagContainer&     DamageTypes)
+{
+	FGameplayEffectSpec* EffectSpec = GameplayEffectSpec.Data.Get();
+
+	if (EffectSpec == nullptr)
+	{
+		UE_LOG(
+			LogPf2Abilities,
+			Error,
+			TEXT("Cannot add damage types (%s) to a gameplay effect spec handle that is not valid."),
+			*(DamageTypes.ToStringSimple())
+		);
+	}
+	else
+	{
+		EffectSpec->AppendDynamicAssetTags(DamageTypes);
+	}
+
+	return GameplayEffectSpec;
+}
+
+TMap<FGameplayTag, float> UPF2AbilitySystemLibrary::GetDamageByTypeFromGameplayCue(
+	const FGameplayCueParameters& Parameters)
+{
+	return PF2DamageCueUtilities::UnpackDamageByType(Parameters);
+}
+
 FGameplayEffectContextHandle UPF2AbilitySystemLibrary::MakeEffectContextFromAbilityForInstigatorAndCauser(
 	const UGameplayAbility* InvokingAbility,
 	AActor*                 Instigator,
@@ -12,6 +12,8 @@
 
 #include "Libraries/PF2AttackStatLibrary.h"
 
+#include <Containers/StaticArray.h>
+
 #include "OpenPF2GameFramework.h"
 
 #include "CharacterStats/PF2TemlCalculation.h"
@@ -31,7 +33,8 @@ EPF2DegreeOfSuccess UPF2AttackStatLibrary::CalculateAttackRoll(const int32
 {
 	EPF2DegreeOfSuccess Result;
 	const int32         DiceRoll               = UPF2DiceLibrary::RollSum(RollCount, RollSize);
-	const bool          bIsNatural20           = (DiceRoll == RollSize);
+	const bool          bIsNatural20           = (DiceRoll == RollSize),
+	                    bIsNatural1            = (DiceRoll == 1);
 	float               WeaponProficiencyBonus = 0,
 	                    AttackRoll;
 
@@ -67,19 +70,25 @@ EPF2DegreeOfSuccess UPF2AttackStatLibrary::CalculateAttackRoll(const int32
 	AttackRoll = DiceRoll + AttackAbilityModifier + WeaponProficiencyBonus + MultipleAttackPenalty;
 	Result     = DetermineDegreeOfSuccessForCheck(AttackRoll, TargetArmorClass);
 
-	// If you rolled a 20 on the die (a “natural 20”), your result is one degree of success better than it would be by
-	// numbers alone."
+	// "If you rolled a 20 on the die (a 'natural 20'), your result is one degree of success better than it would be by
+	// numbers alone. If you roll a 1 on the d20 (a 'natural 1'), your result is one degree worse."
+	//
+	// Source: Pathfinder 2E Core Rulebook, Chapter 9, page 445, "Step 4: Determine the Degree of Success and Effect"
 	if (bIsNatural20 && (Result != EPF2DegreeOfSuccess::CriticalSuccess))
 	{
 		Result = IncreaseDegreeOfSuccess(Result);
 	}
+	else if (bIsNatural1 && (Result != EPF2DegreeOfSuccess::CriticalFailure))
+	{
+		Result = DecreaseDegreeOfSuccess(Result);
+	}
 
 	UE_LOG(
 		LogPf2Stats,
 		VeryVerbose,
 		TEXT("Attack Roll (%d%s) + Attack Ability Modifier (%f) + Weapon Proficiency Bonus (%f) + Multiple Attack Penalty (%f) = %f vs. AC %f: %s."),
 		DiceRoll,
-		bIsNatural20 ? TEXT(" [CRIT]") : TEXT(""),
+		bIsNatural20 ? TEXT(" [CRIT]") : (bIsNatural1 ? TEXT(" [FUMBLE]") : TEXT("")),
 		AttackAbilityModifier,
 		WeaponProficiencyBonus,
 		MultipleAttackPenalty,
@@ -143,12 +152,14 @@ float UPF2AttackStatLibrary::DegreeOfSuccessStatFromEnum(const EPF2DegreeOfSucce
 
 float UPF2AttackStatLibrary::CalculateDamageRoll(const FName DamageDie, const float DamageAbilityModifier)
 {
-	int RollCount = 0,
-	    RollSize  = 0;
+	const FPF2DiceExpression DamageExpression = FPF2DiceExpressionCache::Get(DamageDie);
 
-	UPF2DiceLibrary::ParseRollExpression(DamageDie, RollCount, RollSize);
-
-	return CalculateDamageRoll(RollCount, RollSize, DamageAbilityModifier);
+	// Any constant modifier in the damage die expression (e.g., the "+4" in "2d8+4") is a bonus or penalty on the roll.
+	return CalculateDamageRoll(
+		DamageExpression.RollCount,
+		DamageExpression.DieSize,
+		DamageAbilityModifier + DamageExpression.Modifier
+	);
 }
 
 float UPF2AttackStatLibrary::CalculateDamageRoll(const int RollCount,
@@ -178,6 +189,24 @@ float UPF2AttackStatLibrary::CalculateDamageRoll(const int RollCount,
 	return DamageRoll;
 }
 
+float UPF2AttackStatLibrary::CalculateExpectedDamageRoll(const FName DamageDie, const float DamageAbilityModifier)
+{
+	return FPF2DiceExpressionCache::Get(DamageDie).GetExpectedSum() + DamageAbilityModifier;
+}
+
+float UPF2AttackStatLibrary::CalculateExpectedStrikeDamage(const FPF2DegreeOfSuccessDistribution& AttackDistribution,
+                                                           const FName                            DamageDie,
+                                                           const float                            DamageAbilityModifier)
+{
+	const float ExpectedDamageRoll = CalculateExpectedDamageRoll(DamageDie, DamageAbilityModifier);
+
+	// "If you critically succeed at a Strike, your attack deals double damage."
+	//
+	// Source: Pathfinder 2E Core Rulebook, Chapter 6, page 278, "Critical Hits".
+	return (AttackDistribution.Success * ExpectedDamageRoll) +
+		(AttackDistribution.CriticalSuccess * ExpectedDamageRoll * 2.0f);
+}
+
 uint8 UPF2AttackStatLibrary::CalculateRecoveryCheck(const uint8 DyingConditionLevel, int32& DyingConditionDelta)
 {
 	// "... DC equal to 10 + your current dying value ..."
@@ -305,6 +334,65 @@ EPF2DegreeOfSuccess UPF2AttackStatLibrary::DetermineDegreeOfSuccessForCheck(cons
 	return Result;
 }
 
+FPF2DegreeOfSuccessDistribution UPF2AttackStatLibrary::GetDegreeOfSuccessDistribution(const float Modifier,
+                                                                                      const float DifficultyClass)
+{
+	constexpr int32 TableSize = MaxTabulatedCheckMargin - MinTabulatedCheckMargin + 1;
+
+	// Each entry holds the number of d20 faces (out of 20) that produce each degree of success at a given margin,
+	// indexed by the integer value of EPF2DegreeOfSuccess.
+	static const TStaticArray<TStaticArray<uint8, 5>, TableSize> OutcomeCountsByMargin = []
+	{
+		TStaticArray<TStaticArray<uint8, 5>, TableSize> Table;
+
+		for (int32 TableIndex = 0; TableIndex < TableSize; ++TableIndex)
+		{
+			const int32              Margin = MinTabulatedCheckMargin + TableIndex;
+			TStaticArray<uint8, 5>& Counts = Table[TableIndex];
+
+			for (uint8& Count : Counts)
+			{
+				Count = 0;
+			}
+
+			for (int32 DieRoll = 1; DieRoll <= 20; ++DieRoll)
+			{
+				EPF2DegreeOfSuccess Result = DetermineDegreeOfSuccessForCheck(DieRoll + Margin, 0.0f);
+
+				// Same adjustments as CalculateFlatCheck().
+				if ((DieRoll == 20) && (Result != EPF2DegreeOfSuccess::CriticalSuccess))
+				{
+					Result = IncreaseDegreeOfSuccess(Result);
+				}
+				else if ((DieRoll == 1) && (Result != EPF2DegreeOfSuccess::CriticalFailure))
+				{
+					Result = DecreaseDegreeOfSuccess(Result);
+				}
+
+				++Counts[static_cast<int32>(Result)];
+			}
+		}
+
+		return Table;
+	}();
+
+	// "When you get a fractional result, you always round down unless otherwise noted." A fractional margin (e.g., from
+	// an averaged modifier) must not be rounded up into the next band of success.
+	//
+	// Source: Pathfinder 2E Core Rulebook, Chapter 1, page 12, "Rounding".
+	const int32 Margin =
+		FMath::Clamp(FMath::FloorToInt(Modifier - DifficultyClass), MinTabulatedCheckMargin, MaxTabulatedCheckMargin);
+
+	const TStaticArray<uint8, 5>& Counts = OutcomeCountsByMargin[Margin - MinTabulatedCheckMargin];
+
+	return FPF2DegreeOfSuccessDistribution(
+		Counts[static_cast<int32>(EPF2DegreeOfSuccess::CriticalSuccess)] / 20.0f,
+		Counts[static_cast<int32>(EPF2DegreeOfSuccess::Success)]         / 20.0f,
+		Counts[static_cast<int32>(EPF2DegreeOfSuccess::Failure)]         / 20.0f,
+		Counts[static_cast<int32>(EPF2DegreeOfSuccess::CriticalFailure)] / 20.0f
+	);
+}
+
 EPF2DegreeOfSuccess UPF2AttackStatLibrary::IncreaseDegreeOfSuccess(const EPF2DegreeOfSuccess Value)
 {
 	const int32 MaxAllowedResult = static_cast<int32>(EPF2DegreeOfSuccess::CriticalSuccess),
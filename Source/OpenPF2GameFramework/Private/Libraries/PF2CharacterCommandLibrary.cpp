@@ -5,6 +5,9 @@
 
 #include "Libraries/PF2CharacterCommandLibrary.h"
 
+#include "Commands/PF2CharacterCommand.h"
+#include "Commands/PF2CharacterCommandPoolSubsystem.h"
+
 EPF2CommandExecuteOrQueueResult UPF2CharacterCommandLibrary::ImmediateResultToExecuteOrQueueResult(
 	const EPF2CommandExecuteImmediatelyResult ImmediateResult)
 {
@@ -24,3 +27,14 @@ EPF2CommandExecuteOrQueueResult UPF2CharacterCommandLibrary::ImmediateResultToEx
 			return EPF2CommandExecuteOrQueueResult::Refused;
 	}
 }
+
+void UPF2CharacterCommandLibrary::ReleaseCommand(const TScriptInterface<IPF2CharacterCommandInterface>& Command)
+{
+	APF2CharacterCommand*              CommandActor = Cast<APF2CharacterCommand>(Command.GetObject());
+	UPF2CharacterCommandPoolSubsystem* CommandPool  = UPF2CharacterCommandPoolSubsystem::Get(CommandActor);
+
+	if (CommandPool != nullptr)
+	{
+		CommandPool->ReleaseCommand(CommandActor);
+	}
+}
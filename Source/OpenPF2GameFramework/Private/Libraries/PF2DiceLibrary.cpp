@@ -5,44 +5,64 @@
 
 #include "Libraries/PF2DiceLibrary.h"
 
-#include "Utilities/PF2ArrayUtilities.h"
-
-const FRegexPattern UPF2DiceLibrary::DiceRollPattern = FRegexPattern(TEXT("^(\\d{1,})d(\\d{1,})$"));
+namespace
+{
+	/**
+	 * The stream that has been bound as the source of dice rolls on the current thread, if any.
+	 */
+	thread_local FRandomStream* ActiveDiceRng = nullptr;
+}
 
 // NAME_None forces the RNG to initialize itself with a random seed.
 FRandomStream UPF2DiceLibrary::DiceRng = FRandomStream(NAME_None);
 
 int32 UPF2DiceLibrary::RollStringSum(const FName RollExpression)
 {
-	return PF2ArrayUtilities::Reduce(
-		RollString(RollExpression),
-		0,
-		[](const int32 PreviousValue, const int32 CurrentValue)
-		{
-			return PreviousValue + CurrentValue;
-		});
+	return RollExpressionSum(FPF2DiceExpressionCache::Get(RollExpression));
 }
 
 int32 UPF2DiceLibrary::RollSum(const int32 RollCount, const int32 DieSize)
 {
-	return PF2ArrayUtilities::Reduce(
-		Roll(RollCount, DieSize),
-		0,
-		[](const int32 PreviousValue, const int32 CurrentValue)
-		{
-			return PreviousValue + CurrentValue;
-		});
+	FRandomStream& Rng = GetDiceRng();
+	int32          Sum = 0;
+
+	for (int32 RollIndex = 0; RollIndex < RollCount; ++RollIndex)
+	{
+		Sum += RollDie(Rng, DieSize);
+	}
+
+	return Sum;
+}
+
+int32 UPF2DiceLibrary::RollExpressionSum(const FPF2DiceExpression& Expression)
+{
+	int32 Result;
+
+	if (Expression.bIsValid)
+	{
+		Result = RollSum(Expression.RollCount, Expression.DieSize) + Expression.Modifier;
+	}
+	else
+	{
+		Result = 0;
+	}
+
+	return Result;
+}
+
+float UPF2DiceLibrary::GetExpectedRollStringSum(const FName RollExpression)
+{
+	return FPF2DiceExpressionCache::Get(RollExpression).GetExpectedSum();
 }
 
 TArray<int32> UPF2DiceLibrary::RollString(const FName RollExpression)
 {
-	TArray<int32> Result;
-	int32         RollCount,
-	              DieSize;
+	TArray<int32>            Result;
+	const FPF2DiceExpression Expression = FPF2DiceExpressionCache::Get(RollExpression);
 
-	if (ParseRollExpression(RollExpression, RollCount, DieSize))
+	if (Expression.bIsValid)
 	{
-		Result = Roll(RollCount, DieSize);
+		Result = Roll(Expression.RollCount, Expression.DieSize);
 	}
 
 	return Result;
@@ -50,55 +70,41 @@ TArray<int32> UPF2DiceLibrary::RollString(const FName RollExpression)
 
 TArray<int32> UPF2DiceLibrary::Roll(const int32 RollCount, const int32 DieSize)
 {
-	TArray<int32> Rolls;
+	FRandomStream& Rng = GetDiceRng();
+	TArray<int32>  Rolls;
+
+	Rolls.Reserve(RollCount);
 
 	for (int32 RollIndex = 0; RollIndex < RollCount; ++RollIndex)
 	{
-		int32 Roll;
-
-		if (DieSize == 0)
-		{
-			// Edge case: Unlikely to happen, but just in case, we need to make sure that rolling a zero-sided die does
-			// not return 1. Could happen if the die size is passed in dynamically.
-			Roll = 0;
-		}
-		else
-		{
-			Roll = GetDiceRng().RandRange(1, DieSize);
-		}
-
-		Rolls.Add(Roll);
+		Rolls.Add(RollDie(Rng, DieSize));
 	}
 
 	return Rolls;
 }
 
-FName UPF2DiceLibrary::NextSizeString(const FName RollExpression)
+void UPF2DiceLibrary::RollInline(const int32 RollCount, const int32 DieSize, FPF2InlineDiceRolls& OutRolls)
 {
-	FName Result;
-	int32 RollCount,
-	      DieSize;
+	FRandomStream& Rng = GetDiceRng();
 
-	if (ParseRollExpression(RollExpression, RollCount, DieSize))
+	OutRolls.Reset(RollCount);
+
+	for (int32 RollIndex = 0; RollIndex < RollCount; ++RollIndex)
 	{
-		const int32 NextDieSize = NextSize(DieSize);
-
-		Result = FName(
-			FString::Format(
-				TEXT("{0}d{1}"),
-				{
-					FString::FormatAsNumber(RollCount),
-					FString::FormatAsNumber(NextDieSize)
-				}
-			)
-		);
+		OutRolls.Add(RollDie(Rng, DieSize));
 	}
-	else
+}
+
+FName UPF2DiceLibrary::NextSizeString(const FName RollExpression)
+{
+	FPF2DiceExpression Expression = FPF2DiceExpressionCache::Get(RollExpression);
+
+	if (Expression.bIsValid)
 	{
-		Result = FName(TEXT("0d0"));
+		Expression.DieSize = NextSize(Expression.DieSize);
 	}
 
-	return Result;
+	return FName(Expression.ToString());
 }
 
 int32 UPF2DiceLibrary::NextSize(const int32 DieSize)
@@ -106,18 +112,20 @@ int32 UPF2DiceLibrary::NextSize(const int32 DieSize)
 	return DieSize + 2;
 }
 
+FPF2DiceExpression UPF2DiceLibrary::CompileRollExpression(const FName RollExpression)
+{
+	return FPF2DiceExpressionCache::Get(RollExpression);
+}
+
 bool UPF2DiceLibrary::ParseRollExpression(const FName RollExpression, int32& RollCount, int32& DieSize)
 {
-	bool          bResult;
-	FRegexMatcher ExpressionMatcher = FRegexMatcher(DiceRollPattern, RollExpression.ToString().ToLower());
+	bool                     bResult;
+	const FPF2DiceExpression Expression = FPF2DiceExpressionCache::Get(RollExpression);
 
-	if (ExpressionMatcher.FindNext())
+	if (Expression.bIsValid && !Expression.HasModifier())
 	{
-		const FString RollCountString = ExpressionMatcher.GetCaptureGroup(1),
-		              DieSizeString   = ExpressionMatcher.GetCaptureGroup(2);
-
-		RollCount = FCString::Atoi(*RollCountString);
-		DieSize   = FCString::Atoi(*DieSizeString);
+		RollCount = Expression.RollCount;
+		DieSize   = Expression.DieSize;
 		bResult   = true;
 	}
 	else
@@ -132,10 +140,46 @@ bool UPF2DiceLibrary::ParseRollExpression(const FName RollExpression, int32& Rol
 
 int32 UPF2DiceLibrary::GetRandomSeed()
 {
-	return DiceRng.GetInitialSeed();
+	return GetDiceRng().GetInitialSeed();
 }
 
 void UPF2DiceLibrary::SetRandomSeed(const int32 Seed)
 {
-	DiceRng.Initialize(Seed);
+	GetDiceRng().Initialize(Seed);
+}
+
+FRandomStream* UPF2DiceLibrary::GetActiveRandomStream()
+{
+	return ActiveDiceRng;
+}
+
+FRandomStream* UPF2DiceLibrary::SetActiveRandomStream(FRandomStream* Stream)
+{
+	FRandomStream* PreviousStream = ActiveDiceRng;
+
+	ActiveDiceRng = Stream;
+
+	return PreviousStream;
+}
+
+FRandomStream& UPF2DiceLibrary::GetDiceRng()
+{
+	if (ActiveDiceRng != nullptr)
+	{
+		return *ActiveDiceRng;
+	}
+	else if (IsInGameThread())
+	{
+		check(DiceRng.GetInitialSeed() != 0);
+
+		return DiceRng;
+	}
+	else
+	{
+		// NAME_None forces the RNG to initialize itself with a random seed. The fallback stream of the game thread is not
+		// safe to share with other threads, so each thread gets its own.
+		thread_local FRandomStream ThreadDiceRng = FRandomStream(NAME_None);
+
+		return ThreadDiceRng;
+	}
 }
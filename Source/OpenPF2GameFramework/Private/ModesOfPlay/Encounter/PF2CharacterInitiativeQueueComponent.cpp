@@ -5,6 +5,8 @@
 
 #include "ModesOfPlay/Encounter/PF2CharacterInitiativeQueueComponent.h"
 
+#include <Algo/BinarySearch.h>
+
 #include "OpenPF2GameFramework.h"
 #include "PF2CharacterInterface.h"
 #include "PF2PlayerControllerInterface.h"
@@ -13,7 +15,6 @@
 
 #include "Utilities/PF2InterfaceUtilities.h"
 #include "Utilities/PF2LogUtilities.h"
-#include "Utilities/PF2MapUtilities.h"
 
 bool UPF2CharacterInitiativeQueueComponent::IsEmpty()
 {
@@ -24,17 +25,17 @@ bool UPF2CharacterInitiativeQueueComponent::IsEmpty()
 int32 UPF2CharacterInitiativeQueueComponent::GetCharacterInitiative(
 	const TScriptInterface<IPF2CharacterInterface>& Character) const
 {
-	int32                   Result;
-	IPF2CharacterInterface* Pf2Character    = PF2InterfaceUtilities::FromScriptInterface(Character);
-	const int32*            FoundInitiative = CharactersByInitiatives.FindKey(Pf2Character);
+	int32                                    Result;
+	const IPF2CharacterInterface*            Pf2Character = PF2InterfaceUtilities::FromScriptInterface(Character);
+	const FPF2CharacterInitiativeQueueEntry* FoundEntry   = this->EntriesByCharacter.Find(Pf2Character);
 
-	if (FoundInitiative == nullptr)
+	if (FoundEntry == nullptr)
 	{
 		Result = INDEX_NONE;
 	}
 	else
 	{
-		Result = *FoundInitiative;
+		Result = FoundEntry->Initiative;
 	}
 
     return Result;
@@ -80,10 +81,123 @@ void UPF2CharacterInitiativeQueueComponent::SetCharacterInitiative(
 		);
 
 		// Ensure any existing initiative for this character is cleared.
-		this->RemoveCharacterFromInitiativeMap(Pf2Character);
+		this->RemoveCharacterFromSequence(Pf2Character);
+
+		this->AddCharacterToSequence(Pf2Character, Initiative, this->IsPlayableCharacter(Pf2Character));
+		this->FixUpPreviousCharacterIndex();
+	}
+}
+
+void UPF2CharacterInitiativeQueueComponent::SetCharacterInitiatives(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters,
+	const TArray<int32>&                                     Initiatives)
+{
+	if (Characters.Num() != Initiatives.Num())
+	{
+		UE_LOG(
+			LogPf2Initiative,
+			Error,
+			TEXT("[%s] Number of characters ('%d') must match number of initiatives ('%d')."),
+			*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+			Characters.Num(),
+			Initiatives.Num()
+		);
+	}
+	else
+	{
+		bool                                 bSequenceChanged = false;
+		TMap<IPF2CharacterInterface*, int32> LastValidEntryIndices;
+
+		const TArray<IPF2CharacterInterface*> PlayableCharacters =
+			PF2InterfaceUtilities::FromScriptInterfaces<IPF2CharacterInterface>(this->GetPlayerControlledCharacters());
+
+		// A character can appear more than once, in which case the last valid initiative for it wins, just as if
+		// SetCharacterInitiative() had been called once per entry. Collapse duplicates up front so that each character
+		// is only removed from and re-added to the sequence once.
+		for (int32 CharacterIndex = 0; CharacterIndex < Characters.Num(); ++CharacterIndex)
+		{
+			const TScriptInterface<IPF2CharacterInterface>& Character  = Characters[CharacterIndex];
+			const int32                                     Initiative = Initiatives[CharacterIndex];
+
+			if (Initiative <= 0)
+			{
+				UE_LOG(
+					LogPf2Initiative,
+					Error,
+					TEXT("[%s] Initiative for character ('%s') must be greater than 0; attempted to set it to '%d'."),
+					*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+					*(Character->GetIdForLogs()),
+					Initiative
+				);
+			}
+			else
+			{
+				LastValidEntryIndices.Add(PF2InterfaceUtilities::FromScriptInterface(Character), CharacterIndex);
+			}
+		}
+
+		for (int32 CharacterIndex = 0; CharacterIndex < Characters.Num(); ++CharacterIndex)
+		{
+			const TScriptInterface<IPF2CharacterInterface>& Character    = Characters[CharacterIndex];
+			const int32                                     Initiative   = Initiatives[CharacterIndex];
+			IPF2CharacterInterface*                         Pf2Character =
+				PF2InterfaceUtilities::FromScriptInterface(Character);
+			const int32*                                    LastIndex    = LastValidEntryIndices.Find(Pf2Character);
+
+			if ((LastIndex == nullptr) || (*LastIndex != CharacterIndex))
+			{
+				// Either the initiative is invalid (already reported above) or a later entry supersedes this one.
+				continue;
+			}
 
-		this->CharactersByInitiatives.Add(Initiative, Pf2Character);
-		this->RebuildCharacterSequence();
+			if (this->GetCharacterInitiative(Character) != Initiative)
+			{
+				UE_LOG(
+					LogPf2Initiative,
+					VeryVerbose,
+					TEXT("[%s] Initiative ('%d') set for character ('%s')."),
+					*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+					Initiative,
+					*(Character->GetIdForLogs())
+				);
+
+				// As with SetCharacterInitiative(), remove any existing entry for the character so that, if it is the
+				// character whose turn it is to act, the turns of other characters are not affected by its new position.
+				// The sequence gets rebuilt from scratch below, so the new entry only has to be added to the map.
+				this->RemoveCharacterFromSequence(Pf2Character);
+
+				this->EntriesByCharacter.Add(
+					Pf2Character,
+					FPF2CharacterInitiativeQueueEntry{
+						Pf2Character,
+						Initiative,
+						PlayableCharacters.Contains(Pf2Character),
+						this->NextInsertionSequence++
+					}
+				);
+
+				bSequenceChanged = true;
+			}
+		}
+
+		if (bSequenceChanged)
+		{
+			this->CurrentCharacterSequence.Reset(this->EntriesByCharacter.Num());
+
+			for (const auto& [EntryCharacter, Entry] : this->EntriesByCharacter)
+			{
+				this->CurrentCharacterSequence.Add(Entry);
+			}
+
+			this->CurrentCharacterSequence.Sort(
+				[](const FPF2CharacterInitiativeQueueEntry& A, const FPF2CharacterInitiativeQueueEntry& B)
+				{
+					return A.ComesBefore(B);
+				}
+			);
+
+			this->FixUpPreviousCharacterIndex();
+		}
 	}
 }
 
@@ -92,7 +206,7 @@ bool UPF2CharacterInitiativeQueueComponent::IsInitiativeSetForCharacter(
 {
 	const IPF2CharacterInterface* Pf2Character = PF2InterfaceUtilities::FromScriptInterface(Character);
 
-	return this->CurrentCharacterSequence.Contains(Pf2Character);
+	return this->EntriesByCharacter.Contains(Pf2Character);
 }
 
 void UPF2CharacterInitiativeQueueComponent::InsertCharacterAtOrAboveInitiative(
@@ -140,8 +254,8 @@ void UPF2CharacterInitiativeQueueComponent::ClearInitiativeForCharacter(
 		*(Character->GetIdForLogs())
 	);
 
-	this->RemoveCharacterFromInitiativeMap(Pf2Character);
-	this->RebuildCharacterSequence();
+	this->RemoveCharacterFromSequence(Pf2Character);
+	this->FixUpPreviousCharacterIndex();
 }
 
 void UPF2CharacterInitiativeQueueComponent::ClearInitiativeForAllCharacters()
@@ -153,7 +267,7 @@ void UPF2CharacterInitiativeQueueComponent::ClearInitiativeForAllCharacters()
 		*(PF2LogUtilities::GetHostNetId(this->GetWorld()))
 	);
 
-	this->CharactersByInitiatives.Empty();
+	this->EntriesByCharacter.Empty();
 	this->CurrentCharacterSequence.Empty();
 
 	this->PreviousCharacter      = nullptr;
@@ -193,7 +307,7 @@ TScriptInterface<IPF2CharacterInterface> UPF2CharacterInitiativeQueueComponent::
 			NextCharacterIndex = this->PreviousCharacterIndex + 1;
 		}
 
-		NextCharacter = this->CurrentCharacterSequence[NextCharacterIndex];
+		NextCharacter = this->CurrentCharacterSequence[NextCharacterIndex].Character;
 
 		this->PreviousCharacterIndex = NextCharacterIndex;
 		this->PreviousCharacter      = NextCharacter;
@@ -206,7 +320,16 @@ TScriptInterface<IPF2CharacterInterface> UPF2CharacterInitiativeQueueComponent::
 
 TArray<TScriptInterface<IPF2CharacterInterface>> UPF2CharacterInitiativeQueueComponent::GetCharactersInInitiativeOrder() const
 {
-	return PF2InterfaceUtilities::ToScriptInterfaces<IPF2CharacterInterface>(this->CurrentCharacterSequence);
+	TArray<TScriptInterface<IPF2CharacterInterface>> Result;
+
+	Result.Reserve(this->CurrentCharacterSequence.Num());
+
+	for (const FPF2CharacterInitiativeQueueEntry& Entry : this->CurrentCharacterSequence)
+	{
+		Result.Add(PF2InterfaceUtilities::ToScriptInterface(Entry.Character));
+	}
+
+	return Result;
 }
 
 UActorComponent* UPF2CharacterInitiativeQueueComponent::ToActorComponent()
@@ -224,76 +347,71 @@ TArray<TScriptInterface<IPF2CharacterInterface>> UPF2CharacterInitiativeQueueCom
 	return UPF2CharacterLibrary::GetPlayerControlledCharacters(this->GetWorld());
 }
 
-void UPF2CharacterInitiativeQueueComponent::RebuildCharacterSequence()
+bool UPF2CharacterInitiativeQueueComponent::IsPlayableCharacter(const IPF2CharacterInterface* Character) const
 {
-	TArray<int32>                   Initiatives;
-	TArray<IPF2CharacterInterface*> NewCharacterSequence;
-
 	const TArray<IPF2CharacterInterface*> PlayableCharacters =
 		PF2InterfaceUtilities::FromScriptInterfaces<IPF2CharacterInterface>(this->GetPlayerControlledCharacters());
 
-	this->CharactersByInitiatives.KeyStableSort(TGreater<int32>());
-	this->CharactersByInitiatives.GetKeys(Initiatives);
-
-	for (const int32 Initiative : Initiatives)
-	{
-		TArray<IPF2CharacterInterface*> CharactersForInitiative;
-
-		this->CharactersByInitiatives.MultiFind(Initiative, CharactersForInitiative, true);
+	return PlayableCharacters.Contains(Character);
+}
 
-		CharactersForInitiative.StableSort(
-			[PlayableCharacters](IPF2CharacterInterface& A, IPF2CharacterInterface& B)
+bool UPF2CharacterInitiativeQueueComponent::IsInitiativeOccupied(const int32 Initiative) const
+{
+	// The sequence is ordered from highest to lowest initiative, so this finds the first entry at or below the
+	// initiative.
+	const int32 Position =
+		Algo::LowerBoundBy(
+			this->CurrentCharacterSequence,
+			Initiative,
+			[](const FPF2CharacterInitiativeQueueEntry& Entry)
 			{
-				bool       bCharacterAComesFirst = false;
-				const bool bIsCharacterAPlayable = PlayableCharacters.Contains(&A),
-				           bIsCharacterBPlayable = PlayableCharacters.Contains(&B);
-
-				if (bIsCharacterAPlayable && !bIsCharacterBPlayable)
-				{
-					// PCs come after NPCs.
-					bCharacterAComesFirst = false;
-				}
-				else if (bIsCharacterAPlayable == bIsCharacterBPlayable)
-				{
-					// Characters of the same type (either both NPCs or both PCs) retain their positions based on
-					// insertion order.
-					bCharacterAComesFirst = false;
-				}
-				else if (!bIsCharacterAPlayable && bIsCharacterBPlayable)
-				{
-					// NPCs come before PCs.
-					bCharacterAComesFirst = true;
-				}
-
-				return bCharacterAComesFirst;
-			}
+				return Entry.Initiative;
+			},
+			TGreater<int32>()
 		);
 
-		NewCharacterSequence.Append(CharactersForInitiative);
-	}
-
-	this->CurrentCharacterSequence = NewCharacterSequence;
+	return this->CurrentCharacterSequence.IsValidIndex(Position) &&
+		(this->CurrentCharacterSequence[Position].Initiative == Initiative);
+}
 
-	// Fix-up our iterator so that we maintain where we're pointing in the sequence after everything shuffled around.
-	if (this->PreviousCharacter != nullptr)
-	{
-		for (int CharacterIndex = 0; CharacterIndex < NewCharacterSequence.Num(); ++CharacterIndex)
+int32 UPF2CharacterInitiativeQueueComponent::FindPositionInSequence(
+	const FPF2CharacterInitiativeQueueEntry& Entry) const
+{
+	return Algo::LowerBound(
+		this->CurrentCharacterSequence,
+		Entry,
+		[](const FPF2CharacterInitiativeQueueEntry& A, const FPF2CharacterInitiativeQueueEntry& B)
 		{
-			if (this->PreviousCharacter == NewCharacterSequence[CharacterIndex])
-			{
-				this->PreviousCharacterIndex = CharacterIndex;
-				break;
-			}
+			return A.ComesBefore(B);
 		}
-	}
+	);
+}
+
+void UPF2CharacterInitiativeQueueComponent::AddCharacterToSequence(IPF2CharacterInterface* Character,
+                                                                   const int32             Initiative,
+                                                                   const bool              bIsPlayable)
+{
+	const FPF2CharacterInitiativeQueueEntry NewEntry = {
+		Character,
+		Initiative,
+		bIsPlayable,
+		this->NextInsertionSequence++
+	};
+
+	check(!this->EntriesByCharacter.Contains(Character));
+
+	this->EntriesByCharacter.Add(Character, NewEntry);
+	this->CurrentCharacterSequence.Insert(NewEntry, this->FindPositionInSequence(NewEntry));
 }
 
-void UPF2CharacterInitiativeQueueComponent::RemoveCharacterFromInitiativeMap(const IPF2CharacterInterface* Character)
+void UPF2CharacterInitiativeQueueComponent::RemoveCharacterFromSequence(const IPF2CharacterInterface* Character)
 {
+	FPF2CharacterInitiativeQueueEntry RemovedEntry;
+
 	// If the character being removed is the character whose turn it is to act, we need to update which character is
 	// active so that we don't inadvertently affect the turns of other characters after the character's previous
 	// or new position.
-	if (this->PreviousCharacter == Character)
+	if ((this->PreviousCharacter == Character) && (this->CurrentCharacterSequence.Num() != 0))
 	{
 		int32 NewPreviousCharacterIndex;
 
@@ -312,17 +430,44 @@ void UPF2CharacterInitiativeQueueComponent::RemoveCharacterFromInitiativeMap(con
 		}
 
 		// We do not update PreviousCharacterIndex here; it will get updated during the call to
-		// RebuildCharacterSequence().
-		this->PreviousCharacter = this->CurrentCharacterSequence[NewPreviousCharacterIndex];
+		// FixUpPreviousCharacterIndex().
+		this->PreviousCharacter = this->CurrentCharacterSequence[NewPreviousCharacterIndex].Character;
+	}
+
+	if (this->EntriesByCharacter.RemoveAndCopyValue(Character, RemovedEntry))
+	{
+		const int32 Position = this->FindPositionInSequence(RemovedEntry);
+
+		check(this->CurrentCharacterSequence[Position].Character == Character);
+
+		this->CurrentCharacterSequence.RemoveAt(Position);
+	}
+}
+
+void UPF2CharacterInitiativeQueueComponent::ScaleAllInitiatives(const int32 Factor)
+{
+	check(Factor > 0);
+
+	for (FPF2CharacterInitiativeQueueEntry& Entry : this->CurrentCharacterSequence)
+	{
+		Entry.Initiative *= Factor;
+	}
+
+	for (auto& [Character, Entry] : this->EntriesByCharacter)
+	{
+		Entry.Initiative *= Factor;
 	}
+}
 
-	for (auto It = this->CharactersByInitiatives.CreateIterator(); It; ++It)
+void UPF2CharacterInitiativeQueueComponent::FixUpPreviousCharacterIndex()
+{
+	if (this->PreviousCharacter != nullptr)
 	{
-		if (It.Value() == Character)
+		const FPF2CharacterInitiativeQueueEntry* PreviousEntry = this->EntriesByCharacter.Find(this->PreviousCharacter);
+
+		if (PreviousEntry != nullptr)
 		{
-			// Remove existing initiative for this character.
-			It.RemoveCurrent();
-			break;
+			this->PreviousCharacterIndex = this->FindPositionInSequence(*PreviousEntry);
 		}
 	}
 }
@@ -362,7 +507,7 @@ void UPF2CharacterInitiativeQueueComponent::InsertCharacterAtOrRelativeToInitiat
 
 		// Step 2: If no character in the queue has the target initiative score, set the initiative of the target
 		// character to the specified initiative score.
-		if (this->CharactersByInitiatives.Contains(TargetInitiative))
+		if (this->IsInitiativeOccupied(TargetInitiative))
 		{
 			// Step 3: If at least one character in the queue has the target initiative score:
 			// Step 3a: Increment the target initiative score by the offset.
@@ -370,25 +515,11 @@ void UPF2CharacterInitiativeQueueComponent::InsertCharacterAtOrRelativeToInitiat
 
 			// Step 3b: If there is at least one character in the queue that has an initiative equal to the new
 			// initiative score OR we have the special case of a new initiative score equal to 0:
-			if ((NewInitiative == 0) || this->CharactersByInitiatives.Contains(NewInitiative))
+			if ((NewInitiative == 0) || this->IsInitiativeOccupied(NewInitiative))
 			{
 				// Step 3b I: All initiative scores are scaled up by 10, to ensure gaps between the existing initiative
 				// scores.
-				this->CharactersByInitiatives = PF2MapUtilities::Reduce(
-					this->CharactersByInitiatives,
-					TMultiMap<int, IPF2CharacterInterface*>(),
-					[this](
-						TMultiMap<int, IPF2CharacterInterface*>    ResultMap,
-						const TPair<int, IPF2CharacterInterface*>& Pair)
-					{
-						const int               Key   = Pair.Key;
-						IPF2CharacterInterface* Value = Pair.Value;
-
-						ResultMap.Add(Key * 10, Value);
-
-						return ResultMap;
-					}
-				);
+				this->ScaleAllInitiatives(10);
 
 				// Step 3b II: Set the target initiative score to: <Original passed-in value> * 10 + Offset.
 				NewInitiative = TargetInitiative * 10 + Offset;
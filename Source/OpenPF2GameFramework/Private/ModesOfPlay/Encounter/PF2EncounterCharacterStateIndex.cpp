@@ -0,0 +1,87 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ModesOfPlay/Encounter/PF2EncounterCharacterStateIndex.h"
+
+void FPF2EncounterCharacterStateIndex::SetCharacterStates(const IPF2CharacterInterface*       Character,
+                                                          const FPF2EncounterCharacterStates& States)
+{
+	FPF2EncounterCharacterStates* ExistingStates = this->StatesByCharacter.Find(Character);
+
+	check(Character != nullptr);
+
+	if (ExistingStates == nullptr)
+	{
+		this->StatesByCharacter.Add(Character, States);
+	}
+	else
+	{
+		this->AdjustCounts(*ExistingStates, -1);
+
+		*ExistingStates = States;
+	}
+
+	this->AdjustCounts(States, 1);
+}
+
+bool FPF2EncounterCharacterStateIndex::RemoveCharacter(const IPF2CharacterInterface* Character)
+{
+	bool                         bWasRemoved = false;
+	FPF2EncounterCharacterStates ExistingStates;
+
+	if (this->StatesByCharacter.RemoveAndCopyValue(Character, ExistingStates))
+	{
+		this->AdjustCounts(ExistingStates, -1);
+
+		bWasRemoved = true;
+	}
+
+	return bWasRemoved;
+}
+
+void FPF2EncounterCharacterStateIndex::Reset()
+{
+	this->StatesByCharacter.Reset();
+
+	this->NumAlive                 = 0;
+	this->NumDying                 = 0;
+	this->NumUnconscious           = 0;
+	this->NumDead                  = 0;
+	this->NumPlayerControlled      = 0;
+	this->NumAlivePlayerControlled = 0;
+}
+
+void FPF2EncounterCharacterStateIndex::AdjustCounts(const FPF2EncounterCharacterStates& States, const int32 Delta)
+{
+	if (States.bIsAlive)
+	{
+		this->NumAlive += Delta;
+	}
+
+	if (States.bIsDying)
+	{
+		this->NumDying += Delta;
+	}
+
+	if (States.bIsUnconscious)
+	{
+		this->NumUnconscious += Delta;
+	}
+
+	if (States.bIsDead)
+	{
+		this->NumDead += Delta;
+	}
+
+	if (States.bIsPlayerControlled)
+	{
+		this->NumPlayerControlled += Delta;
+
+		if (States.bIsAlive)
+		{
+			this->NumAlivePlayerControlled += Delta;
+		}
+	}
+}
@@ -5,19 +5,32 @@
 
 #include "ModesOfPlay/Encounter/PF2EncounterModeOfPlayRuleSetBase.h"
 
+#include <AbilitySystemComponent.h>
+
+#include <Async/ParallelFor.h>
+
+#include <GameFramework/Pawn.h>
+
 #include "OpenPF2GameFramework.h"
+#include "PF2AIControllerBase.h"
 #include "PF2CharacterInterface.h"
 #include "PF2PlayerControllerInterface.h"
 
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
 #include "Commands/PF2CharacterCommandInterface.h"
 #include "Commands/PF2CommandQueueInterface.h"
 
 #include "ModesOfPlay/Encounter/PF2CharacterInitiativeQueueComponent.h"
 
 #include "Utilities/PF2EnumUtilities.h"
+#include "Utilities/PF2InterfaceUtilities.h"
 #include "Utilities/PF2LogUtilities.h"
 
-APF2EncounterModeOfPlayRuleSetBase::APF2EncounterModeOfPlayRuleSetBase()
+APF2EncounterModeOfPlayRuleSetBase::APF2EncounterModeOfPlayRuleSetBase() :
+	bPlanNonPlayerTurnsInAdvance(false),
+	PlannedTurnsMovementTolerance(1.0f),
+	bArePlannedTurnsCurrent(false)
 {
 	this->CharacterInitiativeQueue =
 		this->CreateDefaultSubobject<UPF2CharacterInitiativeQueueComponent>(TEXT("CharacterInitiativeQueue"));
@@ -29,25 +42,31 @@ void APF2EncounterModeOfPlayRuleSetBase::OnModeOfPlayEnd(const EPF2ModeOfPlayTyp
 
 	// Be sure to cleanly stop any encounter-specific behavior for each character still in the encounter.
 	this->RemoveAllCharactersFromEncounter();
+
+	// Characters who were added to the encounter without initiative are not removed above, so drop them as well.
+	this->UnregisterAllHitPointsCallbacks();
+	this->CharacterStates.Reset();
+	this->InvalidatePlannedTurns();
 }
 
-bool APF2EncounterModeOfPlayRuleSetBase::HavePlayableCharacters() const
+void APF2EncounterModeOfPlayRuleSetBase::OnModeSuspended(const EPF2ModeOfPlayType ModeOfPlay)
 {
-	bool Result = false;
+	// The next time this mode is active is a new encounter, so none of the turn order of this one carries over.
+	this->SetActiveCharacter(TScriptInterface<IPF2CharacterInterface>(nullptr));
+	this->ClearInitiativeForAllCharacters();
 
-	if (!this->GetCharacterInitiativeQueue()->IsEmpty())
-	{
-		for (const TScriptInterface<IPF2CharacterInterface> Character : this->GetAllCharactersInInitiativeOrder())
-		{
-			if (Character->IsAlive())
-			{
-				Result = true;
-				break;
-			}
-		}
-	}
+	// This removes every character still in the encounter through OnCharactersRemovedFromEncounter().
+	Super::OnModeSuspended(ModeOfPlay);
 
-	return Result;
+	// Drop anything left behind by characters whose actors were destroyed while they were still in the encounter.
+	this->UnregisterAllHitPointsCallbacks();
+	this->CharacterStates.Reset();
+	this->InvalidatePlannedTurns();
+}
+
+bool APF2EncounterModeOfPlayRuleSetBase::HavePlayableCharacters() const
+{
+	return !this->GetCharacterInitiativeQueue()->IsEmpty() && (this->GetCharacterStates().GetNumAlive() > 0);
 }
 
 void APF2EncounterModeOfPlayRuleSetBase::SetCharacterInitiative(
@@ -189,6 +208,39 @@ void APF2EncounterModeOfPlayRuleSetBase::MoveInitiativeLowerThanCharacter(
 	}
 }
 
+void APF2EncounterModeOfPlayRuleSetBase::OnCharactersAddedToEncounter(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
+{
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		this->CharacterStates.SetCharacterStates(
+			PF2InterfaceUtilities::FromScriptInterface(Character),
+			this->GetCurrentStatesOfCharacter(Character)
+		);
+
+		this->RegisterHitPointsCallback(Character);
+	}
+
+	this->InvalidatePlannedTurns();
+
+	Super::OnCharactersAddedToEncounter(Characters);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::OnCharactersRemovedFromEncounter(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
+{
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		this->CharacterStates.RemoveCharacter(PF2InterfaceUtilities::FromScriptInterface(Character));
+
+		this->UnregisterHitPointsCallback(Character->ToActor());
+	}
+
+	this->InvalidatePlannedTurns();
+
+	Super::OnCharactersRemovedFromEncounter(Characters);
+}
+
 void APF2EncounterModeOfPlayRuleSetBase::StartTurnForCharacter(
 	const TScriptInterface<IPF2CharacterInterface>& Character)
 {
@@ -203,6 +255,14 @@ void APF2EncounterModeOfPlayRuleSetBase::StartTurnForCharacter(
 		*(Character->GetIdForLogs())
 	);
 
+	if (this->bPlanNonPlayerTurnsInAdvance &&
+	    (PlayerController.GetInterface() == nullptr) &&
+	    !this->ArePlannedTurnsCurrent())
+	{
+		// Plan all NPCs at once, so that the rest of the NPC turns do not each have to stop to plan.
+		this->PlanNonPlayerTurns();
+	}
+
 	this->BP_OnCharacterTurnStart(Character);
 	this->SetActiveCharacter(Character);
 
@@ -417,6 +477,322 @@ void APF2EncounterModeOfPlayRuleSetBase::PopNextCommandQueuedForCharacter(
 	}
 }
 
+void APF2EncounterModeOfPlayRuleSetBase::Native_OnCharacterUnconscious(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	this->UpdateCharacterStates(Character);
+
+	Super::Native_OnCharacterUnconscious(Character);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::Native_OnCharacterConscious(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	this->UpdateCharacterStates(Character);
+
+	Super::Native_OnCharacterConscious(Character);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::Native_OnCharacterDying(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	this->UpdateCharacterStates(Character);
+
+	Super::Native_OnCharacterDying(Character);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::Native_OnCharacterRecoveredFromDying(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	this->UpdateCharacterStates(Character);
+
+	Super::Native_OnCharacterRecoveredFromDying(Character);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::Native_OnCharacterDead(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	this->UpdateCharacterStates(Character);
+
+	Super::Native_OnCharacterDead(Character);
+}
+
+bool APF2EncounterModeOfPlayRuleSetBase::HaveLivingPlayerControlledCharacters() const
+{
+	return (this->GetCharacterStates().GetNumAlivePlayerControlled() > 0);
+}
+
+bool APF2EncounterModeOfPlayRuleSetBase::HaveLivingNonPlayerCharacters() const
+{
+	return (this->GetCharacterStates().GetNumAliveNonPlayerControlled() > 0);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::UpdateCharacterStates(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	const IPF2CharacterInterface* Pf2Character = PF2InterfaceUtilities::FromScriptInterface(Character);
+
+	if (this->CharacterStates.Contains(Pf2Character))
+	{
+		this->CharacterStates.SetCharacterStates(Pf2Character, this->GetCurrentStatesOfCharacter(Character));
+		this->InvalidatePlannedTurns();
+	}
+}
+
+FPF2EncounterCharacterStates APF2EncounterModeOfPlayRuleSetBase::GetCurrentStatesOfCharacter(
+	const TScriptInterface<IPF2CharacterInterface>& Character) const
+{
+	FPF2EncounterCharacterStates   States;
+	const UAbilitySystemComponent* CharacterAsc = Character->GetAbilitySystemComponent();
+
+	check(CharacterAsc != nullptr);
+
+	States.bIsAlive            = Character->IsAlive();
+	States.bIsDying            = CharacterAsc->HasMatchingGameplayTag(this->DyingConditionTag);
+	States.bIsUnconscious      = CharacterAsc->HasMatchingGameplayTag(this->UnconsciousConditionTag);
+	States.bIsDead             = CharacterAsc->HasMatchingGameplayTag(this->DeadConditionTag);
+	States.bIsPlayerControlled = (Character->GetPlayerController().GetInterface() != nullptr);
+
+	return States;
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::RegisterHitPointsCallback(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	const TWeakObjectPtr<AActor> CharacterPtr = Character->ToActor();
+	UAbilitySystemComponent*     CharacterAsc;
+	FDelegateHandle              DelegateHandle;
+
+	if (this->HitPointsDelegateHandles.Contains(CharacterPtr))
+	{
+		return;
+	}
+
+	CharacterAsc = Character->GetAbilitySystemComponent();
+	check(CharacterAsc != nullptr);
+
+	DelegateHandle =
+		CharacterAsc->GetGameplayAttributeValueChangeDelegate(UPF2CharacterAttributeSet::GetHitPointsAttribute())
+			.AddUObject(this, &APF2EncounterModeOfPlayRuleSetBase::OnCharacterHitPointsChanged, CharacterPtr);
+
+	this->HitPointsDelegateHandles.Add(CharacterPtr, DelegateHandle);
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::UnregisterHitPointsCallback(const TWeakObjectPtr<AActor>& CharacterPtr)
+{
+	FDelegateHandle DelegateHandle;
+
+	if (this->HitPointsDelegateHandles.RemoveAndCopyValue(CharacterPtr, DelegateHandle))
+	{
+		const IPF2CharacterInterface* CharacterIntf = Cast<IPF2CharacterInterface>(CharacterPtr.Get());
+
+		// The ASC might have been garbage collected along with the character, taking the delegate with it.
+		if (CharacterIntf != nullptr)
+		{
+			UAbilitySystemComponent* CharacterAsc = CharacterIntf->GetAbilitySystemComponent();
+
+			if (CharacterAsc != nullptr)
+			{
+				CharacterAsc->GetGameplayAttributeValueChangeDelegate(
+					UPF2CharacterAttributeSet::GetHitPointsAttribute()
+				).Remove(DelegateHandle);
+			}
+		}
+	}
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::UnregisterAllHitPointsCallbacks()
+{
+	TArray<TWeakObjectPtr<AActor>> CharacterPtrs;
+
+	this->HitPointsDelegateHandles.GetKeys(CharacterPtrs);
+
+	for (const TWeakObjectPtr<AActor>& CharacterPtr : CharacterPtrs)
+	{
+		this->UnregisterHitPointsCallback(CharacterPtr);
+	}
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::OnCharacterHitPointsChanged(const FOnAttributeChangeData& ChangeData,
+                                                                     TWeakObjectPtr<AActor>        CharacterPtr)
+{
+	IPF2CharacterInterface* CharacterIntf;
+
+	// Like condition callbacks, changes in hit points are ignored while the encounter is suspended.
+	if (this->IsSuspended())
+	{
+		return;
+	}
+
+	CharacterIntf = Cast<IPF2CharacterInterface>(CharacterPtr.Get());
+
+	if (CharacterIntf != nullptr)
+	{
+		this->UpdateCharacterStates(PF2InterfaceUtilities::ToScriptInterface(CharacterIntf));
+	}
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::PlanNonPlayerTurns()
+{
+	const TArray<TScriptInterface<IPF2CharacterInterface>> Characters = this->GetAllCharactersInInitiativeOrder();
+	const FPF2EncounterSnapshot                            Snapshot   = this->CaptureEncounterSnapshot(Characters);
+	TArray<int32>                                          PlannerCharacterIndices;
+	TArray<const APF2AIControllerBase*>                    Planners;
+	TArray<FPF2AITurnPlan>                                 Plans;
+	TArray<bool>                                           PlanResults;
+
+	check(IsInGameThread());
+
+	// Controllers have to be looked up on the game thread, before planning starts.
+	for (int32 CharacterIndex = 0; CharacterIndex < Characters.Num(); ++CharacterIndex)
+	{
+		const FPF2EncounterCharacterSnapshot& CharacterSnapshot = Snapshot.Characters[CharacterIndex];
+		const APawn*                          Pawn;
+		const APF2AIControllerBase*           AIController;
+
+		if (CharacterSnapshot.bIsPlayerControlled || !CharacterSnapshot.bIsAlive)
+		{
+			continue;
+		}
+
+		Pawn = Characters[CharacterIndex]->ToPawn();
+
+		if (Pawn == nullptr)
+		{
+			continue;
+		}
+
+		AIController = Cast<APF2AIControllerBase>(Pawn->GetController());
+
+		if (AIController != nullptr)
+		{
+			PlannerCharacterIndices.Add(CharacterIndex);
+			Planners.Add(AIController);
+		}
+	}
+
+	Plans.SetNum(Planners.Num());
+	PlanResults.SetNumZeroed(Planners.Num());
+
+	// Each planner only reads from the snapshot and writes to its own plan, so no synchronization is needed.
+	ParallelFor(Planners.Num(), [&](const int32 PlannerIndex)
+	{
+		PlanResults[PlannerIndex] = Planners[PlannerIndex]->PlanEncounterTurn(
+			Snapshot,
+			PlannerCharacterIndices[PlannerIndex],
+			Plans[PlannerIndex]
+		);
+	});
+
+	this->PlannedTurns.Reset();
+
+	for (int32 PlannerIndex = 0; PlannerIndex < Planners.Num(); ++PlannerIndex)
+	{
+		if (PlanResults[PlannerIndex])
+		{
+			this->PlannedTurns.Add(Characters[PlannerCharacterIndices[PlannerIndex]]->ToActor(), Plans[PlannerIndex]);
+		}
+	}
+
+	this->PlannedSnapshot         = Snapshot;
+	this->bArePlannedTurnsCurrent = true;
+
+	UE_LOG(
+		LogPf2Encounters,
+		VeryVerbose,
+		TEXT("[%s] Planned turns for %d of %d NPC(s) in the encounter."),
+		*(PF2LogUtilities::GetHostNetId(this->GetWorld())),
+		this->PlannedTurns.Num(),
+		Planners.Num()
+	);
+}
+
+bool APF2EncounterModeOfPlayRuleSetBase::ArePlannedTurnsCurrent() const
+{
+	const float ToleranceSquared = FMath::Square(this->PlannedTurnsMovementTolerance);
+
+	if (!this->bArePlannedTurnsCurrent)
+	{
+		return false;
+	}
+
+	// Movement does not notify the rule set, so check whether anyone has moved since the plans were made.
+	for (const FPF2EncounterCharacterSnapshot& CharacterSnapshot : this->PlannedSnapshot.Characters)
+	{
+		IPF2CharacterInterface* Character = CharacterSnapshot.Character.Get();
+
+		if ((Character == nullptr) ||
+		    (FVector::DistSquared(Character->ToActor()->GetActorLocation(), CharacterSnapshot.Location) >
+		     ToleranceSquared))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void APF2EncounterModeOfPlayRuleSetBase::InvalidatePlannedTurns()
+{
+	this->PlannedTurns.Reset();
+	this->PlannedSnapshot.Characters.Reset();
+
+	this->bArePlannedTurnsCurrent = false;
+}
+
+TScriptInterface<IPF2CharacterInterface> APF2EncounterModeOfPlayRuleSetBase::GetPlannedTargetForCharacter(
+	const TScriptInterface<IPF2CharacterInterface>& Character,
+	bool&                                           bHasPlan) const
+{
+	TScriptInterface<IPF2CharacterInterface> Result;
+	const FPF2AITurnPlan*                    Plan   = this->PlannedTurns.Find(Character->ToActor());
+
+	if (Plan == nullptr)
+	{
+		bHasPlan = false;
+	}
+	else
+	{
+		// The target might have been destroyed since the plan was made, in which case the result is empty.
+		Result   = PF2InterfaceUtilities::ToScriptInterface(Plan->TargetCharacter.Get());
+		bHasPlan = true;
+	}
+
+	return Result;
+}
+
+FPF2EncounterSnapshot APF2EncounterModeOfPlayRuleSetBase::CaptureEncounterSnapshot(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters) const
+{
+	FPF2EncounterSnapshot Snapshot;
+
+	Snapshot.Characters.Reserve(Characters.Num());
+
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		FPF2EncounterCharacterSnapshot& CharacterSnapshot = Snapshot.Characters.AddDefaulted_GetRef();
+		const UAbilitySystemComponent*  CharacterAsc      = Character->GetAbilitySystemComponent();
+
+		check(CharacterAsc != nullptr);
+
+		CharacterSnapshot.Character    = *Character;
+		CharacterSnapshot.Location     = Character->ToActor()->GetActorLocation();
+		CharacterSnapshot.HitPoints    =
+			CharacterAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetHitPointsAttribute());
+		CharacterSnapshot.MaxHitPoints =
+			CharacterAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetMaxHitPointsAttribute());
+		CharacterSnapshot.ArmorClass   =
+			CharacterAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetArmorClassAttribute());
+
+		CharacterAsc->GetOwnedGameplayTags(CharacterSnapshot.OwnedTags);
+
+		CharacterSnapshot.bIsAlive            = Character->IsAlive();
+		CharacterSnapshot.bIsPlayerControlled = (Character->GetPlayerController().GetInterface() != nullptr);
+	}
+
+	return Snapshot;
+}
+
 void APF2EncounterModeOfPlayRuleSetBase::SetActiveCharacter(
 	const TScriptInterface<IPF2CharacterInterface>& NewActiveCharacter)
 {
@@ -425,8 +801,5 @@ void APF2EncounterModeOfPlayRuleSetBase::SetActiveCharacter(
 
 void APF2EncounterModeOfPlayRuleSetBase::RemoveAllCharactersFromEncounter()
 {
-	for (const TScriptInterface<IPF2CharacterInterface>& Character : this->GetAllCharactersInInitiativeOrder())
-	{
-		this->RemoveCharacterFromEncounter(Character);
-	}
+	this->OnCharactersRemovedFromEncounter(this->GetAllCharactersInInitiativeOrder());
 }
@@ -5,6 +5,8 @@
 
 #include "ModesOfPlay/PF2ModeOfPlayRuleSetBase.h"
 
+#include <AbilitySystemComponent.h>
+
 #include <Engine/World.h>
 
 // ReSharper disable once CppUnusedIncludeDirective
@@ -20,11 +22,35 @@
 
 #include "Utilities/PF2InterfaceUtilities.h"
 
-APF2ModeOfPlayRuleSetBase::APF2ModeOfPlayRuleSetBase()
+APF2ModeOfPlayRuleSetBase::APF2ModeOfPlayRuleSetBase() : bIsSuspended(false)
 {
 	this->DyingConditionTag       = PF2GameplayAbilityUtilities::GetTag(DyingConditionTagName);
 	this->DeadConditionTag        = PF2GameplayAbilityUtilities::GetTag(DeadConditionTagName);
 	this->UnconsciousConditionTag = PF2GameplayAbilityUtilities::GetTag(UnconsciousConditionTagName);
+
+	this->BindTagCallback(
+		this->UnconsciousConditionTag,
+		FPF2CharacterTagCallbackDelegate::CreateUObject(
+			this,
+			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterUnconscious
+		),
+		FPF2CharacterTagCallbackDelegate::CreateUObject(this, &APF2ModeOfPlayRuleSetBase::Native_OnCharacterConscious)
+	);
+
+	this->BindTagCallback(
+		this->DyingConditionTag,
+		FPF2CharacterTagCallbackDelegate::CreateUObject(this, &APF2ModeOfPlayRuleSetBase::Native_OnCharacterDying),
+		FPF2CharacterTagCallbackDelegate::CreateUObject(
+			this,
+			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterRecoveredFromDying
+		)
+	);
+
+	this->BindTagCallback(
+		this->DeadConditionTag,
+		FPF2CharacterTagCallbackDelegate::CreateUObject(this, &APF2ModeOfPlayRuleSetBase::Native_OnCharacterDead),
+		FPF2CharacterTagCallbackDelegate()
+	);
 }
 
 void APF2ModeOfPlayRuleSetBase::OnModeOfPlayStart(const EPF2ModeOfPlayType ModeOfPlay)
@@ -39,77 +65,62 @@ void APF2ModeOfPlayRuleSetBase::OnPlayableCharacterStarting(const TScriptInterfa
 
 void APF2ModeOfPlayRuleSetBase::OnCharacterAddedToEncounter(const TScriptInterface<IPF2CharacterInterface>& Character)
 {
-	const TWeakObjectPtr<AActor> CharacterPtr = Character->ToActor();
-
-	if (this->ConditionCallbackHandles.Contains(CharacterPtr))
-	{
-		UE_LOG(
-			LogPf2Encounters,
-			Error,
-			TEXT("OnCharacterAddedToEncounter() was invoked with character ('%s') that already has condition callbacks registered."),
-			*(Character->GetIdForLogs())
-		);
-	}
-	else
-	{
-		this->RegisterTagCallback(
-			CharacterPtr,
-			this->UnconsciousConditionTag,
-			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterUnconscious,
-			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterConscious
-		);
-
-		this->RegisterTagCallback(
-			CharacterPtr,
-			this->DyingConditionTag,
-			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterDying,
-			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterRecoveredFromDying
-		);
-
-		this->RegisterTagCallback(
-			CharacterPtr,
-			this->DeadConditionTag,
-			&APF2ModeOfPlayRuleSetBase::Native_OnCharacterDead,
-			nullptr
-		);
-	}
-
-	this->BP_OnCharacterAddedToEncounter(Character);
+	this->OnCharactersAddedToEncounter({Character});
 }
 
 void APF2ModeOfPlayRuleSetBase::OnCharacterRemovedFromEncounter(
 	const TScriptInterface<IPF2CharacterInterface>& Character)
 {
-	const TWeakObjectPtr<AActor> CharacterPtr = Character->ToActor();
+	this->OnCharactersRemovedFromEncounter({Character});
+}
 
-	if (this->ConditionCallbackHandles.Contains(CharacterPtr))
-	{
-		this->UnregisterAllTagCallbacksForCharacter(CharacterPtr);
-		this->ConditionCallbackHandles.Remove(CharacterPtr);
-	}
-	else
-	{
-		UE_LOG(
-			LogPf2Encounters,
-			Error,
-			TEXT("OnCharacterRemovedFromEncounter() was invoked with character ('%s') that had no callbacks registered."),
-			*(Character->GetIdForLogs())
-		);
-	}
+void APF2ModeOfPlayRuleSetBase::OnModeOfPlayEnd(const EPF2ModeOfPlayType ModeOfPlay)
+{
+	this->UnregisterAllTagCallbacks();
 
-	this->BP_OnCharacterRemovedFromEncounter(Character);
+	this->BP_OnModeOfPlayEnd(ModeOfPlay);
 }
 
-void APF2ModeOfPlayRuleSetBase::OnModeOfPlayEnd(const EPF2ModeOfPlayType ModeOfPlay)
+void APF2ModeOfPlayRuleSetBase::OnModeSuspended(const EPF2ModeOfPlayType ModeOfPlay)
 {
-	for (const auto& [CharacterPtr, _] : this->ConditionCallbackHandles)
+	TArray<TScriptInterface<IPF2CharacterInterface>> TrackedCharacters;
+	TArray<TWeakObjectPtr<AActor>>                   RemainingCharacterPtrs;
+
+	this->bIsSuspended = true;
+
+	// Persisting a rule set only saves having to re-create it and re-allocate its tables. The characters of one
+	// encounter must not carry over into the next, so everyone is removed through the normal path. Tag callback slots
+	// are freed but stay allocated for the characters of the next encounter.
+	TrackedCharacters.Reserve(this->TagCallbackCharacterIndicesByActor.Num());
+
+	for (const FPF2TagCallbackCharacter& TrackedCharacter : this->TagCallbackCharacters)
 	{
-		this->UnregisterAllTagCallbacksForCharacter(CharacterPtr);
+		IPF2CharacterInterface* CharacterIntf = Cast<IPF2CharacterInterface>(TrackedCharacter.CharacterPtr.Get());
+
+		if (CharacterIntf != nullptr)
+		{
+			TrackedCharacters.Add(PF2InterfaceUtilities::ToScriptInterface(CharacterIntf));
+		}
 	}
 
-	this->ConditionCallbackHandles.Empty();
+	this->OnCharactersRemovedFromEncounter(TrackedCharacters);
+
+	// Characters whose actors have already been destroyed cannot be removed the normal way, but still occupy slots.
+	this->TagCallbackCharacterIndicesByActor.GetKeys(RemainingCharacterPtrs);
+	this->UnregisterTagCallbacks(RemainingCharacterPtrs);
 
 	this->BP_OnModeOfPlayEnd(ModeOfPlay);
+	this->BP_OnModeSuspended(ModeOfPlay);
+}
+
+void APF2ModeOfPlayRuleSetBase::OnModeResumed(const EPF2ModeOfPlayType ModeOfPlay)
+{
+	this->bIsSuspended = false;
+
+	// Each time the mode becomes active, it starts fresh, exactly as a newly-created rule set would.
+	this->OnModeOfPlayStart(ModeOfPlay);
+
+	this->BP_OnModeResumed(ModeOfPlay);
 }
 
 EPF2CommandExecuteOrQueueResult APF2ModeOfPlayRuleSetBase::AttemptToExecuteOrQueueCommand_Implementation(
@@ -177,147 +188,254 @@ void APF2ModeOfPlayRuleSetBase::AttemptToCancelCommand_Implementation(
 	}
 
 	// Default implementation -- remove the command from the character's command queue, if one exists.
-	CommandQueue->Remove(Command);
+	if (CommandQueue->Remove(Command))
+	{
+		UPF2CharacterCommandLibrary::ReleaseCommand(Command);
+	}
+}
+
+void APF2ModeOfPlayRuleSetBase::OnCharactersAddedToEncounter(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
+{
+	TArray<TScriptInterface<IPF2CharacterInterface>> NewCharacters;
+
+	NewCharacters.Reserve(Characters.Num());
+
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		if (this->HasTagCallbacksForCharacter(Character->ToActor()) || NewCharacters.Contains(Character))
+		{
+			UE_LOG(
+				LogPf2Encounters,
+				Error,
+				TEXT("OnCharacterAddedToEncounter() was invoked with character ('%s') that already has condition callbacks registered."),
+				*(Character->GetIdForLogs())
+			);
+		}
+		else
+		{
+			NewCharacters.Add(Character);
+		}
+	}
+
+	// Register the whole batch at once, so that the dispatch table only has to grow once.
+	this->RegisterTagCallbacks(NewCharacters);
+
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		this->BP_OnCharacterAddedToEncounter(Character);
+	}
 }
 
-void APF2ModeOfPlayRuleSetBase::RegisterTagCallback(
-	const TWeakObjectPtr<AActor>      CharacterPtr,
-	const FGameplayTag&               Tag,
-	void (APF2ModeOfPlayRuleSetBase::*OnTagAdded)(const TScriptInterface<IPF2CharacterInterface>&),
-	void (APF2ModeOfPlayRuleSetBase::*OnTagRemoved)(const TScriptInterface<IPF2CharacterInterface>&))
+void APF2ModeOfPlayRuleSetBase::OnCharactersRemovedFromEncounter(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
 {
-	if ((OnTagAdded == nullptr) && (OnTagRemoved == nullptr))
+	TArray<TWeakObjectPtr<AActor>> CharacterPtrs;
+
+	CharacterPtrs.Reserve(Characters.Num());
+
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		const TWeakObjectPtr<AActor> CharacterPtr = Character->ToActor();
+
+		if (this->HasTagCallbacksForCharacter(CharacterPtr))
+		{
+			CharacterPtrs.Add(CharacterPtr);
+		}
+		else
+		{
+			UE_LOG(
+				LogPf2Encounters,
+				Error,
+				TEXT("OnCharacterRemovedFromEncounter() was invoked with character ('%s') that had no callbacks registered."),
+				*(Character->GetIdForLogs())
+			);
+		}
+	}
+
+	this->UnregisterTagCallbacks(CharacterPtrs);
+
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		this->BP_OnCharacterRemovedFromEncounter(Character);
+	}
+}
+
+void APF2ModeOfPlayRuleSetBase::BindTagCallback(const FGameplayTag&                     Tag,
+                                                const FPF2CharacterTagCallbackDelegate& OnTagAdded,
+                                                const FPF2CharacterTagCallbackDelegate& OnTagRemoved)
+{
+	// The layout of the dispatch table depends on the number of bindings, so bindings cannot change once in use.
+	check(this->TagCallbackCharacterIndicesByActor.IsEmpty());
+
+	if (!OnTagAdded.IsBound() && !OnTagRemoved.IsBound())
 	{
 		UE_LOG(
 			LogPf2Core,
 			Error,
-			TEXT("RegisterTagCallback() was invoked null pointers for both callbacks for tag ('%s'), so nothing was bound."),
+			TEXT("BindTagCallback() was invoked with unbound delegates for both callbacks for tag ('%s'), so nothing was bound."),
+			*(Tag.ToString())
+		);
+	}
+	else if (this->TagCallbackIndicesByTag.Contains(Tag))
+	{
+		UE_LOG(
+			LogPf2Core,
+			Error,
+			TEXT("BindTagCallback() was invoked for a tag ('%s') that already has callbacks bound."),
 			*(Tag.ToString())
 		);
 	}
 	else
 	{
-		AActor*                 CharacterActor = CharacterPtr.Get();
-		IPF2CharacterInterface* CharacterIntf  = Cast<IPF2CharacterInterface>(CharacterActor);
+		const int32 TagIndex = this->TagCallbackBindings.Add(FPF2TagCallbackBinding{Tag, OnTagAdded, OnTagRemoved});
 
-		// Actor might have been garbage collected since they were originally added for tracking by this MoPRS.
-		if (CharacterIntf != nullptr)
+		this->TagCallbackIndicesByTag.Add(Tag, TagIndex);
+	}
+}
+
+void APF2ModeOfPlayRuleSetBase::RegisterTagCallbacks(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
+{
+	const int32 NumTags = this->TagCallbackBindings.Num();
+
+	// Grow the dispatch table once for the whole batch, rather than once per character.
+	this->TagCallbackCharacterIndicesByActor.Reserve(this->TagCallbackCharacterIndicesByActor.Num() + Characters.Num());
+	this->TagCallbackCharacters.Reserve(this->TagCallbackCharacters.Num() + Characters.Num());
+	this->EnabledTagCallbacks.Reserve(this->EnabledTagCallbacks.Num() + (Characters.Num() * NumTags));
+
+	for (const TScriptInterface<IPF2CharacterInterface>& Character : Characters)
+	{
+		AActor*                  CharacterActor;
+		TWeakObjectPtr<AActor>   CharacterPtr;
+		UAbilitySystemComponent* CharacterAsc;
+		int32                    CharacterIndex;
+
+		if (Character.GetInterface() == nullptr)
 		{
-			UAbilitySystemComponent*            CharacterAsc = CharacterIntf->GetAbilitySystemComponent();
-			TMap<FGameplayTag, FDelegateHandle> CallbacksForCharacter;
+			continue;
+		}
 
-			if (this->ConditionCallbackHandles.Contains(CharacterPtr))
-			{
-				CallbacksForCharacter = this->ConditionCallbackHandles[CharacterPtr];
-			}
-			else
-			{
-				CallbacksForCharacter = TMap<FGameplayTag, FDelegateHandle>();
-			}
+		CharacterActor = Character->ToActor();
+		CharacterPtr   = CharacterActor;
 
-			if (CallbacksForCharacter.Contains(Tag))
-			{
-				UE_LOG(
-					LogPf2Core,
-					Error,
-					TEXT("RegisterTagCallback() was invoked with character ('%s') that already has a condition callback registered for tag ('%s')."),
-					*(CharacterIntf->GetIdForLogs()),
-					*(Tag.ToString())
-				);
-			}
-			else
+		if (this->HasTagCallbacksForCharacter(CharacterPtr))
+		{
+			continue;
+		}
+
+		CharacterAsc = Character->GetAbilitySystemComponent();
+
+		if (this->FreeTagCallbackCharacterIndices.IsEmpty())
+		{
+			CharacterIndex = this->TagCallbackCharacters.AddDefaulted();
+
+			this->EnabledTagCallbacks.Add(false, NumTags);
+		}
+		else
+		{
+			CharacterIndex = this->FreeTagCallbackCharacterIndices.Pop(false);
+		}
+
+		FPF2TagCallbackCharacter& TrackedCharacter = this->TagCallbackCharacters[CharacterIndex];
+
+		TrackedCharacter.CharacterPtr           = CharacterPtr;
+		TrackedCharacter.AbilitySystemComponent = CharacterAsc;
+
+		// One delegate per ASC handles every bound tag; the dispatch table routes each change to the right callback.
+		TrackedCharacter.DelegateHandle =
+			CharacterAsc->RegisterGenericGameplayTagEvent().AddUObject(
+				this,
+				&APF2ModeOfPlayRuleSetBase::OnTrackedCharacterTagChanged,
+				CharacterIndex
+			);
+
+		this->EnabledTagCallbacks.SetRange(CharacterIndex * NumTags, NumTags, true);
+		this->TagCallbackCharacterIndicesByActor.Add(CharacterPtr, CharacterIndex);
+	}
+}
+
+void APF2ModeOfPlayRuleSetBase::UnregisterTagCallbacks(const TArray<TWeakObjectPtr<AActor>>& CharacterPtrs)
+{
+	const int32 NumTags = this->TagCallbackBindings.Num();
+
+	for (const TWeakObjectPtr<AActor>& CharacterPtr : CharacterPtrs)
+	{
+		int32 CharacterIndex;
+
+		if (this->TagCallbackCharacterIndicesByActor.RemoveAndCopyValue(CharacterPtr, CharacterIndex))
+		{
+			FPF2TagCallbackCharacter& TrackedCharacter = this->TagCallbackCharacters[CharacterIndex];
+			UAbilitySystemComponent*  CharacterAsc     = TrackedCharacter.AbilitySystemComponent.Get();
+
+			// The ASC might have been garbage collected along with the character, taking the delegate with it.
+			if (CharacterAsc != nullptr)
 			{
-				TScriptInterface<IPF2CharacterInterface> Character =
-					PF2InterfaceUtilities::ToScriptInterface(CharacterIntf);
-
-				CallbacksForCharacter.Add(
-					Tag,
-					CharacterAsc->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved).AddLambda(
-						[this, OnTagAdded, OnTagRemoved, Character](const FGameplayTag, const int32 NewCount)
-						{
-							if (NewCount > 0)
-							{
-								if (OnTagAdded != nullptr)
-								{
-									(this->*OnTagAdded)(Character);
-								}
-							}
-							else
-							{
-								if (OnTagRemoved != nullptr)
-								{
-									(this->*OnTagRemoved)(Character);
-								}
-							}
-						}
-					)
-				);
-
-				this->ConditionCallbackHandles.Add(CharacterPtr, CallbacksForCharacter);
+				CharacterAsc->RegisterGenericGameplayTagEvent().Remove(TrackedCharacter.DelegateHandle);
 			}
+
+			TrackedCharacter = FPF2TagCallbackCharacter();
+
+			this->EnabledTagCallbacks.SetRange(CharacterIndex * NumTags, NumTags, false);
+			this->FreeTagCallbackCharacterIndices.Add(CharacterIndex);
 		}
 	}
 }
 
-void APF2ModeOfPlayRuleSetBase::UnregisterAllTagCallbacksForCharacter(
-	const TWeakObjectPtr<AActor> CharacterPtr)
+void APF2ModeOfPlayRuleSetBase::UnregisterAllTagCallbacks()
 {
-	if (CharacterPtr.IsValid())
+	for (FPF2TagCallbackCharacter& TrackedCharacter : this->TagCallbackCharacters)
 	{
-		TMap<FGameplayTag, FDelegateHandle>& CallbacksForCharacter = this->ConditionCallbackHandles[CharacterPtr];
+		UAbilitySystemComponent* CharacterAsc = TrackedCharacter.AbilitySystemComponent.Get();
 
-		// Iterate over a copy since UnregisterTagCallback() modifies the map.
-		for (const auto& [Tag, CallbackHandle] : TMap(CallbacksForCharacter))
+		if (CharacterAsc != nullptr)
 		{
-			this->UnregisterTagCallback(CharacterPtr, Tag, CallbackHandle);
+			CharacterAsc->RegisterGenericGameplayTagEvent().Remove(TrackedCharacter.DelegateHandle);
 		}
-
-		CallbacksForCharacter.Empty();
 	}
+
+	this->TagCallbackCharacters.Empty();
+	this->FreeTagCallbackCharacterIndices.Empty();
+	this->TagCallbackCharacterIndicesByActor.Empty();
+	this->EnabledTagCallbacks.Empty();
 }
 
-void APF2ModeOfPlayRuleSetBase::UnregisterTagCallback(
-	const TWeakObjectPtr<AActor> CharacterPtr,
-	const FGameplayTag&          Tag,
-	const FDelegateHandle&       DelegateHandle)
+void APF2ModeOfPlayRuleSetBase::OnTrackedCharacterTagChanged(const FGameplayTag Tag,
+                                                             const int32        NewCount,
+                                                             const int32        CharacterIndex)
 {
-	AActor*                       CharacterActor = CharacterPtr.Get();
-	const IPF2CharacterInterface* Character      = Cast<IPF2CharacterInterface>(CharacterActor);
+	const int32* TagIndex;
+
+	if (this->bIsSuspended)
+	{
+		return;
+	}
+
+	TagIndex = this->TagCallbackIndicesByTag.Find(Tag);
 
-	// Actor might have been garbage collected since they were originally added for tracking by this MoPRS.
-	if (Character != nullptr)
+	// The delegate fires for every tag of the character, most of which this MoPRS does not care about.
+	if ((TagIndex != nullptr) &&
+		this->EnabledTagCallbacks[(CharacterIndex * this->TagCallbackBindings.Num()) + *TagIndex])
 	{
-		if (this->ConditionCallbackHandles.Contains(CharacterPtr))
+		const FPF2TagCallbackBinding&   Binding          = this->TagCallbackBindings[*TagIndex];
+		const FPF2TagCallbackCharacter& TrackedCharacter = this->TagCallbackCharacters[CharacterIndex];
+		IPF2CharacterInterface*         CharacterIntf    =
+			Cast<IPF2CharacterInterface>(TrackedCharacter.CharacterPtr.Get());
+
+		if (CharacterIntf != nullptr)
 		{
-			TMap<FGameplayTag, FDelegateHandle>& CallbacksForCharacter = this->ConditionCallbackHandles[CharacterPtr];
+			const TScriptInterface<IPF2CharacterInterface> Character =
+				PF2InterfaceUtilities::ToScriptInterface(CharacterIntf);
 
-			if (CallbacksForCharacter.Contains(Tag))
+			if (NewCount > 0)
 			{
-				UAbilitySystemComponent* CharacterAsc = Character->GetAbilitySystemComponent();
-
-				CharacterAsc->UnregisterGameplayTagEvent(DelegateHandle, Tag, EGameplayTagEventType::NewOrRemoved);
-				CallbacksForCharacter.Remove(Tag);
+				Binding.OnTagAdded.ExecuteIfBound(Character);
 			}
 			else
 			{
-				UE_LOG(
-					LogPf2Core,
-					Error,
-					TEXT("UnregisterTagCallback() was invoked with character ('%s') that had no callbacks registered for tag ('%s')."),
-					*(Character->GetIdForLogs()),
-					*(Tag.ToString())
-				);
+				Binding.OnTagRemoved.ExecuteIfBound(Character);
 			}
 		}
-		else
-		{
-			UE_LOG(
-				LogPf2Core,
-				Error,
-				TEXT("UnregisterTagCallback() was invoked with character ('%s') that had no callbacks registered."),
-				*(Character->GetIdForLogs())
-			);
-		}
 	}
 }
 
@@ -372,10 +490,7 @@ void APF2ModeOfPlayRuleSetBase::AddCharacterToEncounter(const TScriptInterface<I
 
 void APF2ModeOfPlayRuleSetBase::AddAllPlayerControlledCharactersToEncounter()
 {
-	for (const TScriptInterface<IPF2CharacterInterface>& Character : this->GetPlayerControlledCharacters())
-	{
-		this->AddCharacterToEncounter(Character);
-	}
+	this->OnCharactersAddedToEncounter(this->GetPlayerControlledCharacters());
 }
 
 void APF2ModeOfPlayRuleSetBase::RemoveCharacterFromEncounter(
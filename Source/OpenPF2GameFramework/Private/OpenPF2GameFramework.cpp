@@ -5,12 +5,28 @@
 
 #include "OpenPF2GameFramework.h"
 
+#include <GameplayTagsManager.h>
+
+#include "CharacterStats/PF2TemlTagIndex.h"
+
+#include "GameplayEffects/PF2WeightGroupRegistry.h"
+
 #define LOCTEXT_NAMESPACE "FOpenPF2GameFrameworkModule"
 
 void FOpenPF2GameFrameworkModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin
 	// file per-module
+
+	// Build the TEML tag index and weight group registry up front, once all tags are available, so that the first stat
+	// calculation or passive GE activation does not have to pay for them.
+	UGameplayTagsManager::CallOrRegister_OnDoneAddingNativeTagsDelegate(
+		FSimpleMulticastDelegate::FDelegate::CreateLambda([]
+		{
+			FPF2TemlTagIndex::GetInstance();
+			FPF2WeightGroupRegistry::GetInstance();
+		})
+	);
 }
 
 void FOpenPF2GameFrameworkModule::ShutdownModule()
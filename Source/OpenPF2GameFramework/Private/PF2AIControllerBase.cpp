@@ -12,3 +12,40 @@ FString APF2AIControllerBase::GetIdForLogs() const
 {
 	return this->GetName();
 }
+
+bool APF2AIControllerBase::PlanEncounterTurn(const FPF2EncounterSnapshot& Snapshot,
+                                             const int32                  CharacterIndex,
+                                             FPF2AITurnPlan&              OutPlan) const
+{
+	bool                                  bHasPlan            = false;
+	const FPF2EncounterCharacterSnapshot& Planner             = Snapshot.Characters[CharacterIndex];
+	float                                 BestDistanceSquared = 0.0f,
+	                                      BestHitPoints       = 0.0f;
+
+	for (const FPF2EncounterCharacterSnapshot& Candidate : Snapshot.Characters)
+	{
+		float DistanceSquared;
+
+		if (!Candidate.bIsAlive || (Candidate.bIsPlayerControlled == Planner.bIsPlayerControlled))
+		{
+			continue;
+		}
+
+		DistanceSquared = FVector::DistSquared(Planner.Location, Candidate.Location);
+
+		if (!bHasPlan ||
+		    (DistanceSquared < BestDistanceSquared) ||
+		    ((DistanceSquared == BestDistanceSquared) && (Candidate.HitPoints < BestHitPoints)))
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestHitPoints       = Candidate.HitPoints;
+
+			OutPlan.TargetCharacter = Candidate.Character;
+			OutPlan.Score           = -FMath::Sqrt(DistanceSquared);
+
+			bHasPlan = true;
+		}
+	}
+
+	return bHasPlan;
+}
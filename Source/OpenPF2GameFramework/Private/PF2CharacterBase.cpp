@@ -18,6 +18,7 @@
 
 #include "Abilities/Attacks/PF2AttackAttributeSet.h"
 
+#include "Actors/Components/PF2DynamicTagBatchScope.h"
 #include "Actors/Components/PF2OwnerTrackingComponent.h"
 
 #include "CharacterStats/AbilityBoosts/PF2GameplayAbilityTargetData_BoostAbility.h"
@@ -271,6 +272,9 @@ void APF2CharacterBase::ApplyAbilityBoostSelections()
 	{
 		TArray<FPF2CharacterAbilityBoostSelection> UnmatchedAbilityBoostSelections;
 
+		// Each boost adds a passive GE; batch them so that passive GEs are re-applied only once for all of them.
+		FPF2DynamicTagBatchScope BatchScope(this->GetCharacterAbilitySystemComponent().GetInterface());
+
 		for (const auto& AbilityBoostSelection : this->AbilityBoostSelections)
 		{
 			TSubclassOf<UPF2AbilityBoostBase> BoostGa   = AbilityBoostSelection.BoostGameplayAbility;
@@ -563,8 +567,13 @@ void APF2CharacterBase::Native_OnCharacterLevelChanged(const float OldLevel, con
 {
 	this->DeactivatePassiveGameplayEffects();
 
-	this->CharacterLevel = NewLevel;
-	this->BP_OnCharacterLevelChanged(OldLevel, NewLevel);
+	{
+		// Batch any tag or passive GE changes made by Blueprint logic, since all passive GEs get re-applied below anyway.
+		FPF2DynamicTagBatchScope BatchScope(this->GetCharacterAbilitySystemComponent().GetInterface());
+
+		this->CharacterLevel = NewLevel;
+		this->BP_OnCharacterLevelChanged(OldLevel, NewLevel);
+	}
 
 	this->ActivatePassiveGameplayEffects();
 }
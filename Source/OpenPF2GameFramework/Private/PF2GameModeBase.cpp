@@ -503,9 +503,24 @@ void APF2GameModeBase::ForceSwitchModeOfPlay(const EPF2ModeOfPlayType NewModeOfP
 	{
 		const EPF2ModeOfPlayType                               OldModeOfPlay = Pf2GameState->GetModeOfPlay();
 		const TScriptInterface<IPF2ModeOfPlayRuleSetInterface> OldRuleSet    = Pf2GameState->GetModeOfPlayRuleSet();
-		const TScriptInterface<IPF2ModeOfPlayRuleSetInterface> NewRuleSet    = this->CreateModeOfPlayRuleSet(NewModeOfPlay);
+		bool                                                   bIsNewRuleSet = true;
+		TScriptInterface<IPF2ModeOfPlayRuleSetInterface>       NewRuleSet;
 
-		if (OldRuleSet.GetInterface() != nullptr)
+		if (this->bPersistModeOfPlayRuleSets)
+		{
+			NewRuleSet = this->FindOrCreatePersistentModeOfPlayRuleSet(NewModeOfPlay, bIsNewRuleSet);
+		}
+		else
+		{
+			NewRuleSet = this->CreateModeOfPlayRuleSet(NewModeOfPlay);
+		}
+
+		if ((OldRuleSet.GetInterface() != nullptr) && this->bPersistModeOfPlayRuleSets)
+		{
+			// The old rule set stays in the registry so that it can be resumed the next time its mode is active.
+			OldRuleSet->OnModeSuspended(OldModeOfPlay);
+		}
+		else if (OldRuleSet.GetInterface() != nullptr)
 		{
 			AActor* OldRuleSetActor = Cast<AActor>(OldRuleSet.GetObject());
 
@@ -521,9 +536,40 @@ void APF2GameModeBase::ForceSwitchModeOfPlay(const EPF2ModeOfPlayType NewModeOfP
 
 		Pf2GameState->SetModeOfPlay(NewModeOfPlay, NewRuleSet);
 
-		if (NewRuleSet.GetInterface() != nullptr)
+		if ((NewRuleSet.GetInterface() != nullptr) && bIsNewRuleSet)
 		{
 			NewRuleSet->OnModeOfPlayStart(NewModeOfPlay);
 		}
+		else if (NewRuleSet.GetInterface() != nullptr)
+		{
+			NewRuleSet->OnModeResumed(NewModeOfPlay);
+		}
 	}
 }
+
+TScriptInterface<IPF2ModeOfPlayRuleSetInterface> APF2GameModeBase::FindOrCreatePersistentModeOfPlayRuleSet(
+	const EPF2ModeOfPlayType ModeOfPlay,
+	bool&                    bOutWasCreated)
+{
+	TScriptInterface<IPF2ModeOfPlayRuleSetInterface> RuleSet;
+	const TScriptInterface<IPF2ModeOfPlayRuleSetInterface>* ExistingRuleSet =
+		this->PersistentModeRuleSets.Find(ModeOfPlay);
+
+	if ((ExistingRuleSet != nullptr) && IsValid(ExistingRuleSet->GetObject()))
+	{
+		RuleSet        = *ExistingRuleSet;
+		bOutWasCreated = false;
+	}
+	else
+	{
+		RuleSet        = this->CreateModeOfPlayRuleSet(ModeOfPlay);
+		bOutWasCreated = true;
+
+		if (RuleSet.GetInterface() != nullptr)
+		{
+			this->PersistentModeRuleSets.Add(ModeOfPlay, RuleSet);
+		}
+	}
+
+	return RuleSet;
+}
@@ -19,6 +19,9 @@
 #include "Actors/Components/PF2OwnerTrackingInterface.h"
 
 #include "Commands/PF2CharacterCommand.h"
+#include "Commands/PF2CommandQueueInterface.h"
+
+#include "Libraries/PF2CharacterCommandLibrary.h"
 
 #include "ModesOfPlay/PF2ModeOfPlayRuleSetInterface.h"
 #include "ModesOfPlay/Encounter/PF2CharacterQueueComponent.h"
@@ -27,6 +30,8 @@
 #include "Utilities/PF2InterfaceUtilities.h"
 #include "Utilities/PF2LogUtilities.h"
 
+const int32 APF2PlayerControllerBase::MaxCommandsPerBatch = 32;
+
 APF2PlayerControllerBase::APF2PlayerControllerBase()
 {
 	this->ControllableCharacterQueue =
@@ -293,10 +298,6 @@ void APF2PlayerControllerBase::Server_ExecuteAbilitySpecAsCharacterCommandWithPa
 	AActor*                          CharacterActor,
 	const FGameplayEventData&        AbilityPayload)
 {
-	IPF2CharacterInterface*        TargetCharacter = Cast<IPF2CharacterInterface>(CharacterActor);
-	IPF2CharacterCommandInterface* CharacterCommandIntf;
-	APawn*                         CharacterPawn;
-
 	UE_LOG(
 		LogPf2Abilities,
 		VeryVerbose,
@@ -306,6 +307,70 @@ void APF2PlayerControllerBase::Server_ExecuteAbilitySpecAsCharacterCommandWithPa
 		*(this->GetIdForLogs())
 	);
 
+	this->ExecuteAbilitySpecAsCharacterCommand(CharacterActor, AbilitySpecHandle, AbilityPayload);
+}
+
+bool APF2PlayerControllerBase::Server_ExecuteCharacterCommands_Validate(
+	const TArray<FPF2CharacterCommandDescriptor>& Commands)
+{
+	for (const FPF2CharacterCommandDescriptor& Command : Commands)
+	{
+		if (!this->IsControllableCharacterPawn(Command.CharacterActor))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void APF2PlayerControllerBase::Server_ExecuteCharacterCommands_Implementation(
+	const TArray<FPF2CharacterCommandDescriptor>& Commands)
+{
+	UE_LOG(
+		LogPf2Abilities,
+		VeryVerbose,
+		TEXT("Server_ExecuteCharacterCommands(%d commands) called on player controller ('%s')."),
+		Commands.Num(),
+		*(this->GetIdForLogs())
+	);
+
+	// An oversized batch is not evidence of cheating (e.g., a UI could queue up a long chain of actions), so it is
+	// rejected here rather than in Validate(), which would disconnect the client.
+	if (Commands.Num() > MaxCommandsPerBatch)
+	{
+		UE_LOG(
+			LogPf2Abilities,
+			Error,
+			TEXT("Server_ExecuteCharacterCommands(): Batch from player controller ('%s') contains too many commands ('%d'); the limit is '%d'. Rejecting the entire batch."),
+			*(this->GetIdForLogs()),
+			Commands.Num(),
+			MaxCommandsPerBatch
+		);
+
+		return;
+	}
+
+	for (const FPF2CharacterCommandDescriptor& Command : Commands)
+	{
+		this->ExecuteAbilitySpecAsCharacterCommand(
+			Command.CharacterActor,
+			Command.AbilitySpecHandle,
+			Command.AbilityPayload
+		);
+	}
+}
+
+void APF2PlayerControllerBase::ExecuteAbilitySpecAsCharacterCommand(
+	AActor*                          CharacterActor,
+	const FGameplayAbilitySpecHandle AbilitySpecHandle,
+	const FGameplayEventData&        AbilityPayload)
+{
+	IPF2CharacterInterface*         TargetCharacter = Cast<IPF2CharacterInterface>(CharacterActor);
+	IPF2CharacterCommandInterface*  CharacterCommandIntf;
+	APawn*                          CharacterPawn;
+	EPF2CommandExecuteOrQueueResult Result;
+
 	// Already checked by Validate() callback.
 	check(TargetCharacter != nullptr);
 
@@ -315,7 +380,13 @@ void APF2PlayerControllerBase::Server_ExecuteAbilitySpecAsCharacterCommandWithPa
 
 	CharacterCommandIntf = APF2CharacterCommand::Create(TargetCharacter, AbilitySpecHandle, AbilityPayload);
 
-	CharacterCommandIntf->AttemptExecuteOrQueue();
+	Result = CharacterCommandIntf->AttemptExecuteOrQueue();
+
+	// Only queued commands are still needed; the queue releases them once they have been executed or cancelled.
+	if (Result != EPF2CommandExecuteOrQueueResult::Queued)
+	{
+		UPF2CharacterCommandLibrary::ReleaseCommand(PF2InterfaceUtilities::ToScriptInterface(CharacterCommandIntf));
+	}
 }
 
 bool APF2PlayerControllerBase::IsControllableCharacterPawn(AActor* CharacterActor) const
@@ -366,15 +437,30 @@ bool APF2PlayerControllerBase::IsControllableCharacterPawn(AActor* CharacterActo
 	return true;
 }
 
+bool APF2PlayerControllerBase::IsStaleCommandRequest(const AInfo* Command, const int32 CommandGeneration)
+{
+	const APF2CharacterCommand* CharacterCommand = Cast<APF2CharacterCommand>(Command);
+
+	return (CharacterCommand != nullptr) && !CharacterCommand->IsCurrentGeneration(CommandGeneration);
+}
+
 UEnhancedInputComponent* APF2PlayerControllerBase::GetEnhancedInputComponent() const
 {
 	return Cast<UEnhancedInputComponent>(this->InputComponent);
 }
 
-bool APF2PlayerControllerBase::Server_CancelCharacterCommand_Validate(AInfo* Command)
+bool APF2PlayerControllerBase::Server_CancelCharacterCommand_Validate(AInfo*      Command,
+                                                                      const int32 CommandGeneration)
 {
 	const IPF2CharacterCommandInterface* CommandIntf = Cast<IPF2CharacterCommandInterface>(Command);
 
+	// A command that no longer exists or that has been recycled since the client sent this request is not a sign of
+	// cheating, so such requests are ignored by the implementation instead of being rejected here.
+	if ((Command == nullptr) || IsStaleCommandRequest(Command, CommandGeneration))
+	{
+		return true;
+	}
+
 	if (CommandIntf == nullptr)
 	{
 		UE_LOG(
@@ -421,26 +507,83 @@ bool APF2PlayerControllerBase::Server_CancelCharacterCommand_Validate(AInfo* Com
 	return true;
 }
 
-void APF2PlayerControllerBase::Server_CancelCharacterCommand_Implementation(AInfo* Command)
+void APF2PlayerControllerBase::Server_CancelCharacterCommand_Implementation(AInfo*      Command,
+                                                                            const int32 CommandGeneration)
 {
 	IPF2CharacterCommandInterface* CommandIntf = Cast<IPF2CharacterCommandInterface>(Command);
 
 	UE_LOG(
 		LogPf2Abilities,
 		VeryVerbose,
-		TEXT("Server_CancelCharacterCommand(%s) called on player controller ('%s')."),
+		TEXT("Server_CancelCharacterCommand(%s,%d) called on player controller ('%s')."),
 		*(GetNameSafe(Command)),
+		CommandGeneration,
 		*(this->GetIdForLogs())
 	);
 
-	// Already checked by Validate() callback.
-	check(CommandIntf != nullptr);
+	if ((CommandIntf == nullptr) || IsStaleCommandRequest(Command, CommandGeneration))
+	{
+		UE_LOG(
+			LogPf2Abilities,
+			Verbose,
+			TEXT("Server_CancelCharacterCommand(%s,%d): Command has been released or destroyed since the request was sent; ignoring request."),
+			*(GetNameSafe(Command)),
+			CommandGeneration
+		);
+		return;
+	}
 
 	// Just defer back to the command. Since we're on the server side, this should not result in infinite recursion
 	// because the server implementation is for the command to call into the game mode.
 	CommandIntf->AttemptCancel();
 }
 
+bool APF2PlayerControllerBase::Server_CancelQueuedCharacterCommand_Validate(AActor*     CharacterActor,
+                                                                            const int32 CommandId)
+{
+	return this->IsControllableCharacterPawn(CharacterActor);
+}
+
+void APF2PlayerControllerBase::Server_CancelQueuedCharacterCommand_Implementation(AActor*     CharacterActor,
+                                                                                  const int32 CommandId)
+{
+	IPF2CharacterInterface*                         TargetCharacter = Cast<IPF2CharacterInterface>(CharacterActor);
+	TScriptInterface<IPF2CommandQueueInterface>     CommandQueue;
+	TScriptInterface<IPF2CharacterCommandInterface> Command;
+
+	UE_LOG(
+		LogPf2Abilities,
+		VeryVerbose,
+		TEXT("Server_CancelQueuedCharacterCommand(%s,%d) called on player controller ('%s')."),
+		*(GetNameSafe(CharacterActor)),
+		CommandId,
+		*(this->GetIdForLogs())
+	);
+
+	// Already checked by Validate() callback.
+	check(TargetCharacter != nullptr);
+
+	CommandQueue = TargetCharacter->GetCommandQueueComponent();
+	Command      = CommandQueue->FindCommandById(CommandId);
+
+	if (Command.GetInterface() == nullptr)
+	{
+		// The command may have been executed or removed from the queue before this request arrived.
+		UE_LOG(
+			LogPf2Abilities,
+			Verbose,
+			TEXT("Server_CancelQueuedCharacterCommand(%s,%d): Command is no longer in the command queue ('%s')."),
+			*(TargetCharacter->GetIdForLogs()),
+			CommandId,
+			*(CommandQueue->GetIdForLogs())
+		);
+	}
+	else
+	{
+		Command->AttemptCancel();
+	}
+}
+
 void APF2PlayerControllerBase::Multicast_OnEncounterTurnStarted_Implementation()
 {
 	this->BP_OnEncounterTurnStarted();
@@ -0,0 +1,140 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Utilities/PF2DamageCueUtilities.h"
+
+#include "OpenPF2GameFramework.h"
+
+#include "Abilities/Attacks/PF2AttackAttributeStatics.h"
+
+namespace
+{
+	/**
+	 * The number of bits in each lane of packed damage.
+	 */
+	constexpr int32 BitsPerLane = 16;
+
+	/**
+	 * The mask for a single lane of packed damage.
+	 */
+	constexpr uint32 LaneMask = (1u << BitsPerLane) - 1u;
+
+	/**
+	 * The number of lanes of packed damage in each 32-bit word of the cue parameters.
+	 */
+	constexpr int32 LanesPerWord = 32 / BitsPerLane;
+
+	static_assert(
+		PF2DamageCueUtilities::MaxDamageTypesPerCue <= (LanesPerWord * 2),
+		"Damage cues only have room for two words (GameplayEffectLevel and AbilityLevel) of packed damage."
+	);
+}
+
+namespace PF2DamageCueUtilities
+{
+	void PackDamageByType(const TConstArrayView<TPair<FGameplayTag, float>>& DamageByType,
+	                      FGameplayCueParameters&                            OutCueParameters)
+	{
+		const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+		float                             TotalDamage    = 0.0f;
+		uint32                            PackedWords[2] = { 0, 0 };
+
+		// Each lane is keyed by the mask bit of its damage type, so that lanes can be put in mask order.
+		TArray<TPair<uint32, float>, TInlineAllocator<MaxDamageTypesPerCue>> Lanes;
+
+		checkf(
+			DamageByType.Num() <= MaxDamageTypesPerCue,
+			TEXT("At most %d damage types can be packed into a single cue (got %d)."),
+			MaxDamageTypesPerCue,
+			DamageByType.Num()
+		);
+
+		for (const TPair<FGameplayTag, float>& DamageOfType : DamageByType)
+		{
+			const uint32 DamageTypeBit = AttackCaptures.GetDamageTypeMaskBit(DamageOfType.Key);
+
+			if (DamageTypeBit == 0)
+			{
+				UE_LOG(
+					LogPf2Stats,
+					Error,
+					TEXT("Cannot pack damage for '%s' into a cue because it is not a damage type."),
+					*(DamageOfType.Key.ToString())
+				);
+
+				continue;
+			}
+
+			OutCueParameters.AggregatedSourceTags.AddTag(DamageOfType.Key);
+
+			Lanes.Add({ DamageTypeBit, DamageOfType.Value });
+
+			TotalDamage += DamageOfType.Value;
+		}
+
+		OutCueParameters.RawMagnitude = TotalDamage;
+
+		// A cue for a single type of damage needs no lanes since the total is the amount of that type of damage.
+		if (Lanes.Num() > 1)
+		{
+			Lanes.Sort([](const TPair<uint32, float>& Lane1, const TPair<uint32, float>& Lane2)
+			{
+				return Lane1.Key < Lane2.Key;
+			});
+
+			for (int32 LaneIndex = 0; LaneIndex < Lanes.Num(); ++LaneIndex)
+			{
+				const uint32 PackedAmount = static_cast<uint32>(
+					FMath::Clamp(FMath::RoundToInt32(Lanes[LaneIndex].Value), 0, static_cast<int32>(LaneMask))
+				);
+
+				PackedWords[LaneIndex / LanesPerWord] |= PackedAmount << ((LaneIndex % LanesPerWord) * BitsPerLane);
+			}
+
+			OutCueParameters.GameplayEffectLevel = static_cast<int32>(PackedWords[0]);
+			OutCueParameters.AbilityLevel        = static_cast<int32>(PackedWords[1]);
+		}
+	}
+
+	TMap<FGameplayTag, float> UnpackDamageByType(const FGameplayCueParameters& CueParameters)
+	{
+		TMap<FGameplayTag, float>         Result;
+		const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+		const uint32                      DamageTypeMask =
+			AttackCaptures.GetDamageTypeMask(CueParameters.AggregatedSourceTags);
+
+		if (FMath::CountBits(DamageTypeMask) == 1)
+		{
+			Result.Add(
+				AttackCaptures.GetDamageTypeForDamageIndex(FMath::CountTrailingZeros(DamageTypeMask)),
+				CueParameters.RawMagnitude
+			);
+		}
+		else
+		{
+			const uint32 PackedWords[2] = {
+				static_cast<uint32>(CueParameters.GameplayEffectLevel),
+				static_cast<uint32>(CueParameters.AbilityLevel),
+			};
+
+			int32 LaneIndex = 0;
+
+			for (uint32 RemainingMask = DamageTypeMask;
+			     (RemainingMask != 0) && (LaneIndex < MaxDamageTypesPerCue);
+			     RemainingMask &= (RemainingMask - 1))
+			{
+				const int32  DamageIndex = FMath::CountTrailingZeros(RemainingMask);
+				const uint32 Amount      =
+					(PackedWords[LaneIndex / LanesPerWord] >> ((LaneIndex % LanesPerWord) * BitsPerLane)) & LaneMask;
+
+				Result.Add(AttackCaptures.GetDamageTypeForDamageIndex(DamageIndex), static_cast<float>(Amount));
+
+				++LaneIndex;
+			}
+		}
+
+		return Result;
+	}
+}
@@ -1,4 +1,4 @@
-// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
 //
 // This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 // distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -6,12 +6,206 @@
 #include "Utilities/PF2GameplayAbilityUtilities.h"
 
 #include <GameplayEffectExtension.h>
+#include <GameplayModMagnitudeCalculation.h>
+
+#include <GameplayEffectComponents/TargetTagRequirementsGameplayEffectComponent.h>
 
 #include <GameFramework/Pawn.h>
 
 #include "PF2CharacterInterface.h"
 
 #include "CharacterStats/PF2CharacterAbilitySystemInterface.h"
+#include "CharacterStats/PF2TagDependentCalculationInterface.h"
+
+#include "GameplayEffects/Components/PF2AdvancedAdditionalEffectsGameplayEffectComponent.h"
+#include "GameplayEffects/Components/PF2ConditionalGameplayEffect.h"
+#include "GameplayEffects/PF2WeightGroupRegistry.h"
+
+namespace
+{
+	/**
+	 * Appends all of the tags referenced by the given tag requirements to the given container.
+	 *
+	 * @param [in] Requirements
+	 *	The requirements for which tags are desired.
+	 * @param [out] OutQueriedTags
+	 *	A reference to the container to which tags are appended.
+	 */
+	void AppendRequirementTags(const FGameplayTagRequirements& Requirements, FGameplayTagContainer& OutQueriedTags)
+	{
+		TArray<FGameplayTag> QueryTags;
+
+		OutQueriedTags.AppendTags(Requirements.RequireTags);
+		OutQueriedTags.AppendTags(Requirements.IgnoreTags);
+
+		Requirements.TagQuery.GetGameplayTagArray(QueryTags);
+
+		OutQueriedTags.AppendTags(FGameplayTagContainer::CreateFromArray(QueryTags));
+	}
+
+	/**
+	 * Appends the tags declared by the given MMC or execution to the given container.
+	 *
+	 * @param [in] CalculationClass
+	 *	The type of MMC or execution. Can be null.
+	 * @param [out] OutQueriedTags
+	 *	A reference to the container to which tags are appended.
+	 *
+	 * @return
+	 *	true if the calculation is null or declares the tags it queries; or, false, otherwise.
+	 */
+	bool AppendCalculationTags(const UClass* CalculationClass, FGameplayTagContainer& OutQueriedTags)
+	{
+		bool bResult = true;
+
+		if (CalculationClass != nullptr)
+		{
+			const IPF2TagDependentCalculationInterface* CalculationIntf =
+				Cast<IPF2TagDependentCalculationInterface>(CalculationClass->GetDefaultObject());
+
+			if (CalculationIntf == nullptr)
+			{
+				bResult = false;
+			}
+			else
+			{
+				OutQueriedTags.AppendTags(CalculationIntf->GetQueriedTags());
+			}
+		}
+
+		return bResult;
+	}
+
+	/**
+	 * Gets the attribute-based float of the given modifier magnitude.
+	 *
+	 * The engine does not expose this part of a magnitude publicly, so it is read through reflection.
+	 *
+	 * @param [in] Magnitude
+	 *	The magnitude for which the attribute-based float is desired.
+	 *
+	 * @return
+	 *	A pointer to the attribute-based float of the magnitude; or, nullptr, if the magnitude is not attribute-based.
+	 */
+	const FAttributeBasedFloat* GetAttributeBasedMagnitude(const FGameplayEffectModifierMagnitude& Magnitude)
+	{
+		static const FStructProperty* AttributeBasedMagnitudeProperty =
+			FindFProperty<FStructProperty>(
+				FGameplayEffectModifierMagnitude::StaticStruct(),
+				TEXT("AttributeBasedMagnitude")
+			);
+
+		const FAttributeBasedFloat* Result = nullptr;
+
+		if ((Magnitude.GetMagnitudeCalculationType() == EGameplayEffectMagnitudeCalculation::AttributeBased) &&
+			(AttributeBasedMagnitudeProperty != nullptr))
+		{
+			Result = AttributeBasedMagnitudeProperty->ContainerPtrToValuePtr<FAttributeBasedFloat>(&Magnitude);
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Appends the tags that the given modifier magnitude checks for to the given container.
+	 *
+	 * This covers the source and target tag filters of attribute-based magnitudes and the tags declared by MMCs.
+	 *
+	 * @param [in] Magnitude
+	 *	The magnitude for which queried tags are desired.
+	 * @param [out] OutQueriedTags
+	 *	A reference to the container to which tags are appended.
+	 *
+	 * @return
+	 *	true if all of the tags that the magnitude can check are known; or, false, otherwise.
+	 */
+	bool AppendMagnitudeTags(const FGameplayEffectModifierMagnitude& Magnitude, FGameplayTagContainer& OutQueriedTags)
+	{
+		if (const FAttributeBasedFloat* AttributeBasedMagnitude = GetAttributeBasedMagnitude(Magnitude))
+		{
+			OutQueriedTags.AppendTags(AttributeBasedMagnitude->SourceTagFilter);
+			OutQueriedTags.AppendTags(AttributeBasedMagnitude->TargetTagFilter);
+		}
+
+		return AppendCalculationTags(Magnitude.GetCustomMagnitudeCalculationClass(), OutQueriedTags);
+	}
+
+	/**
+	 * Appends the tags queried by the given GE to the given container, recursing into conditional GEs.
+	 *
+	 * @param [in] GameplayEffect
+	 *	The effect for which queried tags are desired.
+	 * @param [in,out] VisitedEffects
+	 *	The effects that have already been examined, to guard against GEs that (indirectly) apply themselves.
+	 * @param [out] OutQueriedTags
+	 *	A reference to the container to which tags are appended.
+	 *
+	 * @return
+	 *	true if all of the tags that the GE can check are known; or, false, otherwise.
+	 */
+	bool AppendGameplayEffectTags(const TSubclassOf<UGameplayEffect> GameplayEffect,
+	                              TSet<const UClass*>&               VisitedEffects,
+	                              FGameplayTagContainer&             OutQueriedTags)
+	{
+		bool                   bAllTagsKnown = true;
+		bool                   bAlreadyVisited;
+		const UGameplayEffect* Effect        = GameplayEffect.GetDefaultObject();
+
+		VisitedEffects.Add(GameplayEffect.Get(), &bAlreadyVisited);
+
+		if ((Effect == nullptr) || bAlreadyVisited)
+		{
+			return true;
+		}
+
+		for (const FGameplayModifierInfo& Modifier : Effect->Modifiers)
+		{
+			AppendRequirementTags(Modifier.SourceTags, OutQueriedTags);
+			AppendRequirementTags(Modifier.TargetTags, OutQueriedTags);
+
+			bAllTagsKnown &= AppendMagnitudeTags(Modifier.ModifierMagnitude, OutQueriedTags);
+		}
+
+		for (const FGameplayEffectExecutionDefinition& Execution : Effect->Executions)
+		{
+			bAllTagsKnown &= AppendCalculationTags(Execution.CalculationClass, OutQueriedTags);
+
+			for (const FGameplayEffectExecutionScopedModifierInfo& ScopedModifier : Execution.CalculationModifiers)
+			{
+				AppendRequirementTags(ScopedModifier.SourceTags, OutQueriedTags);
+				AppendRequirementTags(ScopedModifier.TargetTags, OutQueriedTags);
+
+				bAllTagsKnown &= AppendMagnitudeTags(ScopedModifier.ModifierMagnitude, OutQueriedTags);
+			}
+		}
+
+		if (const UTargetTagRequirementsGameplayEffectComponent* TagRequirements =
+			Effect->FindComponent<UTargetTagRequirementsGameplayEffectComponent>())
+		{
+			AppendRequirementTags(TagRequirements->ApplicationTagRequirements, OutQueriedTags);
+			AppendRequirementTags(TagRequirements->OngoingTagRequirements, OutQueriedTags);
+			AppendRequirementTags(TagRequirements->RemovalTagRequirements, OutQueriedTags);
+		}
+
+		if (const UPF2AdvancedAdditionalEffectsGameplayEffectComponent* AdditionalEffects =
+			Effect->FindComponent<UPF2AdvancedAdditionalEffectsGameplayEffectComponent>())
+		{
+			for (const FPF2ConditionalGameplayEffect& ConditionalEffect :
+			     AdditionalEffects->GetOnApplicationGameplayEffects())
+			{
+				OutQueriedTags.AppendTags(ConditionalEffect.GetQueriedTags());
+
+				bAllTagsKnown &= AppendGameplayEffectTags(
+					ConditionalEffect.GetEffectClass(),
+					VisitedEffects,
+					OutQueriedTags
+				);
+			}
+		}
+
+		return bAllTagsKnown;
+	}
+}
 
 /**
  * Utility logic for working with Gameplay Abilities.
@@ -31,36 +225,15 @@ namespace PF2GameplayAbilityUtilities
 
 	FName GetWeightGroupOfGameplayEffect(const TSubclassOf<UGameplayEffect> GameplayEffect, const FName DefaultWeight)
 	{
-		FName                  WeightGroup;
-		const FGameplayTag     WeightTagParent = GetTag(FName(TEXT("GameplayEffect.WeightGroup")));
-		const UGameplayEffect* Effect          = GameplayEffect.GetDefaultObject();
-
-		const FGameplayTagContainer WeightTags = Effect->GetAssetTags().Filter(FGameplayTagContainer(WeightTagParent));
-
-		if (WeightTags.IsEmpty())
-		{
-			WeightGroup = DefaultWeight;
-		}
-		else
-		{
-			const FGameplayTag WeightTag = WeightTags.First();
-
-			checkf(
-				WeightTags.Num() < 2,
-				TEXT("A Gameplay Effect can only have a single weight group assigned (this GE has been assigned '%d' weight groups)."),
-				WeightTags.Num()
-			);
-
-			checkf(
-				WeightTag != WeightTagParent,
-				TEXT("Parent tag of weight groups ('%s') cannot be used as a weight group "),
-				*WeightTagParent.ToString()
-			);
+		return FPF2WeightGroupRegistry::GetInstance().GetWeightGroupOfGameplayEffect(GameplayEffect, DefaultWeight);
+	}
 
-			WeightGroup = WeightTag.GetTagName();
-		}
+	bool GetTagsQueriedByGameplayEffect(const TSubclassOf<UGameplayEffect> GameplayEffect,
+	                                    FGameplayTagContainer&             OutQueriedTags)
+	{
+		TSet<const UClass*> VisitedEffects;
 
-		return WeightGroup;
+		return AppendGameplayEffectTags(GameplayEffect, VisitedEffects, OutQueriedTags);
 	}
 
 	IPF2CharacterAbilitySystemInterface* GetCharacterAbilitySystemComponent(const FGameplayAbilityActorInfo* ActorInfo)
@@ -51,7 +51,43 @@ protected:
 		{ "DamageType.Precision",            "TmpDmgTypePrecision"           },
 	};
 
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The capture definitions of all transient damage attributes.
+	 */
+	TArray<const FGameplayEffectAttributeCaptureDefinition*> DamageCaptures;
+
+	/**
+	 * Map from each damage type tag to the slot of the capture definition for the transient damage attribute of that
+	 * damage type.
+	 */
+	TMap<FGameplayTag, int32> DamageSlotsByDamageType;
+
+	/**
+	 * The damage type tag of each capture definition, indexed by slot.
+	 *
+	 * The tag for the slot of any capture that is not a transient damage attribute is not valid.
+	 */
+	TArray<FGameplayTag> DamageTypesBySlot;
+
+	/**
+	 * Map from each damage type tag to the bit that represents that damage type in a damage type mask.
+	 *
+	 * The bit for each damage type is the index of its capture definition in DamageCaptures.
+	 */
+	TMap<FGameplayTag, uint32> DamageTypeMaskBits;
+
 public:
+	// =================================================================================================================
+	// Public Constants
+	// =================================================================================================================
+	/**
+	 * The largest number of damage types that can be represented in a damage type mask.
+	 */
+	static constexpr int32 MaxDamageTypesInMask = sizeof(uint32) * 8;
+
 	// =================================================================================================================
 	// Public Static Methods
 	// =================================================================================================================
@@ -107,7 +143,10 @@ public:
 	 * @return
 	 *	The damage-related attributes in this static capture definition.
 	 */
-	TArray<const FGameplayEffectAttributeCaptureDefinition*> GetAllDamageCaptures() const;
+	FORCEINLINE const TArray<const FGameplayEffectAttributeCaptureDefinition*>& GetAllDamageCaptures() const
+	{
+		return this->DamageCaptures;
+	}
 
 	/**
 	 * Gets the transient damage attribute capture definition for the damage type that has the given tag.
@@ -119,11 +158,8 @@ public:
 	 *	Either the desired capture definition; or nullptr if the character is using an ASC that does not provide a
 	 *	transient damage attribute that corresponds to the specified damage type.
 	 */
-	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetDamageCaptureForDamageType(
-		const FGameplayTag& DamageType) const
-	{
-		return this->GetDamageCaptureForDamageType(DamageType.GetTagName());
-	}
+	const FGameplayEffectAttributeCaptureDefinition* GetDamageCaptureForDamageType(
+		const FGameplayTag& DamageType) const;
 
 	/**
 	 * Gets the transient damage attribute capture definition for the damage type that has the given tag name.
@@ -135,8 +171,28 @@ public:
 	 *	Either the desired capture definition; or nullptr if the character is using an ASC that does not provide a
 	 *	transient damage attribute that corresponds to the specified damage type.
 	 */
-	const FGameplayEffectAttributeCaptureDefinition* GetDamageCaptureForDamageType(
-		const FName& DamageTypeName) const;
+	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetDamageCaptureForDamageType(
+		const FName& DamageTypeName) const
+	{
+		return this->GetDamageCaptureForDamageType(FGameplayTag::RequestGameplayTag(DamageTypeName, false));
+	}
+
+	/**
+	 * Gets the slot of the transient damage attribute capture definition for the damage type that has the given tag.
+	 *
+	 * @param DamageType
+	 *	The damage tag for which a damage capture slot is desired.
+	 *
+	 * @return
+	 *	Either the slot of the desired capture definition (see GetCaptureBySlot()); or, INDEX_NONE if there is no
+	 *	transient damage attribute that corresponds to the specified damage type.
+	 */
+	FORCEINLINE int32 GetDamageSlotForDamageType(const FGameplayTag& DamageType) const
+	{
+		const int32* Slot = this->DamageSlotsByDamageType.Find(DamageType);
+
+		return (Slot == nullptr) ? INDEX_NONE : *Slot;
+	}
 
 	/**
 	 * Gets the damage type tag that corresponds to the specified transient damage attribute.
@@ -148,7 +204,91 @@ public:
 	 *	Either the tag for the type of damage that was provided; or, a gameplay tag that is not valid if there is no
 	 *	damage type that corresponds to the given attribute.
 	 */
-	FGameplayTag GetDamageTypeForDamageAttribute(const FGameplayAttribute& Attribute) const;
+	FORCEINLINE FGameplayTag GetDamageTypeForDamageAttribute(const FGameplayAttribute& Attribute) const
+	{
+		return this->GetDamageTypeForSlot(this->GetSlotOfAttribute(Attribute));
+	}
+
+	/**
+	 * Gets the damage type tag that corresponds to the transient damage attribute captured in the given slot.
+	 *
+	 * @param Slot
+	 *	The slot of the capture definition for which a damage type is desired.
+	 *
+	 * @return
+	 *	Either the tag for the type of damage that was provided; or, a gameplay tag that is not valid if the slot does
+	 *	not contain a transient damage attribute.
+	 */
+	FORCEINLINE FGameplayTag GetDamageTypeForSlot(const int32 Slot) const
+	{
+		return this->DamageTypesBySlot.IsValidIndex(Slot) ? this->DamageTypesBySlot[Slot] : FGameplayTag();
+	}
+
+	/**
+	 * Gets the damage type tag that corresponds to the transient damage attribute at the given index.
+	 *
+	 * @param DamageIndex
+	 *	The index of the capture definition in GetAllDamageCaptures() for which a damage type is desired.
+	 *
+	 * @return
+	 *	Either the tag for the type of damage at the given index; or, a gameplay tag that is not valid if the index is
+	 *	out of range.
+	 */
+	FORCEINLINE FGameplayTag GetDamageTypeForDamageIndex(const int32 DamageIndex) const
+	{
+		FGameplayTag Result;
+
+		if (this->DamageCaptures.IsValidIndex(DamageIndex))
+		{
+			Result = this->GetDamageTypeForDamageAttribute(this->DamageCaptures[DamageIndex]->AttributeToCapture);
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Gets the bit that represents the given damage type in a damage type mask.
+	 *
+	 * @param DamageType
+	 *	The tag of the damage type for which a bit is desired.
+	 *
+	 * @return
+	 *	Either the bit for the damage type; or, 0 if the tag is not a damage type.
+	 */
+	FORCEINLINE uint32 GetDamageTypeMaskBit(const FGameplayTag& DamageType) const
+	{
+		const uint32* Bit = this->DamageTypeMaskBits.Find(DamageType);
+
+		return (Bit == nullptr) ? 0 : *Bit;
+	}
+
+	/**
+	 * Gets a sparse mask of the damage types among the given tags.
+	 *
+	 * Each bit of the mask corresponds to the capture definition at the same index in GetAllDamageCaptures(). Tags
+	 * that are not damage types are ignored.
+	 *
+	 * @param Tags
+	 *	The tags to convert into a mask. This is typically the dynamic asset tags of a damage GE spec.
+	 *
+	 * @return
+	 *	A mask that has a bit set for each damage type among the given tags; or, 0 if none of the given tags is a
+	 *	damage type.
+	 */
+	uint32 GetDamageTypeMask(const FGameplayTagContainer& Tags) const;
+
+	/**
+	 * Gets a mask that has a bit set for every transient damage attribute.
+	 *
+	 * @return
+	 *	The mask for all damage types.
+	 */
+	FORCEINLINE uint32 GetAllDamageTypesMask() const
+	{
+		const int32 NumDamageTypes = this->DamageCaptures.Num();
+
+		return (NumDamageTypes >= MaxDamageTypesInMask) ? MAX_uint32 : ((1u << NumDamageTypes) - 1u);
+	}
 
 protected:
 	// =================================================================================================================
@@ -0,0 +1,116 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Abilities/PF2DegreeOfSuccess.h"
+
+#include "PF2DegreeOfSuccessDistribution.generated.h"
+
+/**
+ * The exact probability of each degree of success for a single check.
+ *
+ * The four probabilities always sum to 1.0.
+ */
+USTRUCT(BlueprintType)
+struct OPENPF2GAMEFRAMEWORK_API FPF2DegreeOfSuccessDistribution
+{
+	GENERATED_BODY()
+
+	/**
+	 * The probability that the check is a critical success.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float CriticalSuccess;
+
+	/**
+	 * The probability that the check is a success (but not a critical success).
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float Success;
+
+	/**
+	 * The probability that the check is a failure (but not a critical failure).
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float Failure;
+
+	/**
+	 * The probability that the check is a critical failure.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float CriticalFailure;
+
+	/**
+	 * Default constructor for FPF2DegreeOfSuccessDistribution.
+	 */
+	explicit FPF2DegreeOfSuccessDistribution() : FPF2DegreeOfSuccessDistribution(0.0f, 0.0f, 0.0f, 0.0f)
+	{
+	}
+
+	/**
+	 * Constructor for FPF2DegreeOfSuccessDistribution.
+	 *
+	 * @param CriticalSuccess
+	 *	The probability that the check is a critical success.
+	 * @param Success
+	 *	The probability that the check is a success (but not a critical success).
+	 * @param Failure
+	 *	The probability that the check is a failure (but not a critical failure).
+	 * @param CriticalFailure
+	 *	The probability that the check is a critical failure.
+	 */
+	explicit FPF2DegreeOfSuccessDistribution(const float CriticalSuccess,
+	                                         const float Success,
+	                                         const float Failure,
+	                                         const float CriticalFailure) :
+		CriticalSuccess(CriticalSuccess),
+		Success(Success),
+		Failure(Failure),
+		CriticalFailure(CriticalFailure)
+	{
+	}
+
+	/**
+	 * Gets the probability of the given degree of success.
+	 *
+	 * @param DegreeOfSuccess
+	 *	The degree of success of interest.
+	 *
+	 * @return
+	 *	The probability of the given outcome; or, 0.0 if given EPF2DegreeOfSuccess::None.
+	 */
+	FORCEINLINE float GetProbability(const EPF2DegreeOfSuccess DegreeOfSuccess) const
+	{
+		switch (DegreeOfSuccess)
+		{
+			case EPF2DegreeOfSuccess::CriticalSuccess:
+				return this->CriticalSuccess;
+
+			case EPF2DegreeOfSuccess::Success:
+				return this->Success;
+
+			case EPF2DegreeOfSuccess::Failure:
+				return this->Failure;
+
+			case EPF2DegreeOfSuccess::CriticalFailure:
+				return this->CriticalFailure;
+
+			default:
+				return 0.0f;
+		}
+	}
+
+	/**
+	 * Gets the probability that the check is either a success or a critical success.
+	 *
+	 * @return
+	 *	The probability of a successful outcome.
+	 */
+	FORCEINLINE float GetSuccessOrBetter() const
+	{
+		return this->CriticalSuccess + this->Success;
+	}
+};
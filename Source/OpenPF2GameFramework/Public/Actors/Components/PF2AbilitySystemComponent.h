@@ -1,4 +1,4 @@
-// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
 //
 // This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 // distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -21,6 +21,45 @@ class IPF2AbilityBoostInterface;
 // =====================================================================================================================
 // Normal Declarations
 // =====================================================================================================================
+/**
+ * The tags that the passive Gameplay Effects (GEs) of a single weight group check for when they are applied.
+ */
+struct FPF2WeightGroupTagDependencies
+{
+	/**
+	 * The tags that GEs in the weight group check for. A parent tag stands for itself and all of its children.
+	 */
+	FGameplayTagContainer QueriedTags;
+
+	/**
+	 * Whether at least one GE in the weight group uses a calculation that does not declare which tags it checks.
+	 *
+	 * If this is true, the weight group must be assumed to depend on every tag.
+	 */
+	bool bDependsOnAllTags = false;
+};
+
+/**
+ * The passive Gameplay Effects (GEs) of a single weight group, in the order that they are applied.
+ */
+struct FPF2PassiveGameplayEffectWeightGroup
+{
+	/**
+	 * The name of the weight group.
+	 */
+	FName WeightGroup;
+
+	/**
+	 * The priority of the weight group (see FPF2WeightGroupRegistry), or INDEX_NONE if the group is not registered.
+	 */
+	int32 Priority = INDEX_NONE;
+
+	/**
+	 * The GEs in the weight group.
+	 */
+	TArray<TSubclassOf<UGameplayEffect>> GameplayEffects;
+};
+
 UCLASS(ClassGroup="OpenPF2-Characters")
 class OPENPF2GAMEFRAMEWORK_API UPF2AbilitySystemComponent :
 	public UAbilitySystemComponent,
@@ -87,6 +126,32 @@ protected:
 	UPROPERTY(BlueprintReadOnly)
 	TSet<FName> ActivatedWeightGroups;
 
+	/**
+	 * Whether to re-apply every passive GE whenever the dynamic tags of this ASC change.
+	 *
+	 * By default, only the weight groups that contain a GE that checks for one of the changed tags -- and all of the
+	 * weight groups after them -- are re-applied. Enable this to fall back to re-applying all passive GEs (e.g., if a
+	 * calculation that depends on tags does not declare them through IPF2TagDependentCalculationInterface and is
+	 * missed).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="OpenPF2 - Passive Gameplay Effects")
+	bool bReapplyAllPassiveGEsOnTagChange;
+
+	/**
+	 * The number of dynamic tag batches that have been started on this ASC and not yet ended.
+	 */
+	int32 DynamicTagBatchDepth;
+
+	/**
+	 * The dynamic tags that have been added or removed during the current dynamic tag batch.
+	 */
+	FGameplayTagContainer BatchedChangedTags;
+
+	/**
+	 * The weight groups to which passive GEs have been added during the current dynamic tag batch.
+	 */
+	TSet<FName> BatchedWeightGroups;
+
 	/**
 	 * A special, "dummy" GE that is used for applying dynamic tags.
 	 *
@@ -106,9 +171,16 @@ protected:
 
 	/**
 	 * The cached list of all Gameplay Effects registered on this ASC with AddPassiveGameplayEffect() or
-	 * AddPassiveGameplayEffectWithWeight.
+	 * AddPassiveGameplayEffectWithWeight, grouped by weight group and sorted in weight order.
 	 */
-	TMultiMap<FName, TSubclassOf<UGameplayEffect>> CachedPassiveGameplayEffectsToApply;
+	TArray<FPF2PassiveGameplayEffectWeightGroup> CachedPassiveGameplayEffectsToApply;
+
+	/**
+	 * The cached tags that the passive GEs of each weight group check for, keyed by weight group.
+	 *
+	 * Entries are added as weight groups are examined, and the cache is cleared whenever passive GEs change.
+	 */
+	TMap<FName, FPF2WeightGroupTagDependencies> CachedWeightGroupTagDependencies;
 
 public:
 	// =================================================================================================================
@@ -215,6 +287,10 @@ public:
 
 	virtual void RemoveAllDynamicTags() override;
 
+	virtual void BeginDynamicTagBatch() override;
+
+	virtual void EndDynamicTagBatch() override;
+
 	// =================================================================================================================
 	// Public Methods - IPF2CharacterAbilitySystemInterface Implementation
 	// =================================================================================================================
@@ -282,12 +358,26 @@ protected:
 	 *
 	 * The returned list includes all of the passive GEs that have been added to this GE as well as the dynamic tag GE.
 	 *
-	 * The list is cached, for performance reasons.
+	 * The list is cached, for performance reasons. The returned reference is only valid until the passive GEs of this
+	 * ASC change. Since applying a passive GE can itself change the passive GEs of this ASC, callers that apply GEs
+	 * must copy the list before iterating over it.
+	 *
+	 * @return
+	 *	The weight groups of passive GEs to activate, sorted in weight order.
+	 */
+	const TArray<FPF2PassiveGameplayEffectWeightGroup>& GetPassiveGameplayEffectsToApply();
+
+	/**
+	 * Gets the passive gameplay effects to activate for the given weight group.
+	 *
+	 * @param WeightGroup
+	 *	The name of the weight group.
 	 *
 	 * @return
-	 *	The map of passive GEs to activate, keyed by weight group.
+	 *	The passive GEs of the weight group; or, nullptr if there are no passive GEs in the weight group. The returned
+	 *	pointer is only valid until the passive GEs of this ASC change.
 	 */
-	TMultiMap<FName, TSubclassOf<UGameplayEffect>> GetPassiveGameplayEffectsToApply();
+	const FPF2PassiveGameplayEffectWeightGroup* FindPassiveGameplayEffectsToApply(const FName WeightGroup);
 
 	/**
 	 * Builds the list of all passive gameplay effects to activate, organized by weight group.
@@ -297,9 +387,58 @@ protected:
 	 * The list is not cached.
 	 *
 	 * @return
-	 *	The map of passive GEs to activate, keyed by weight group.
+	 *	The weight groups of passive GEs to activate, sorted in weight order.
 	 */
-	TMultiMap<FName, TSubclassOf<UGameplayEffect>> BuildPassiveGameplayEffectsToApply() const;
+	TArray<FPF2PassiveGameplayEffectWeightGroup> BuildPassiveGameplayEffectsToApply() const;
+
+	/**
+	 * Gets or builds the tags that the passive GEs of the given weight group check for.
+	 *
+	 * The result is cached, for performance reasons.
+	 *
+	 * @param WeightGroup
+	 *	The weight group for which tag dependencies are desired.
+	 *
+	 * @return
+	 *	The tags that the passive GEs of the weight group check for.
+	 */
+	const FPF2WeightGroupTagDependencies& GetWeightGroupTagDependencies(const FName WeightGroup);
+
+	/**
+	 * Finds the earliest active weight group that contains a passive GE that checks for any of the given tags.
+	 *
+	 * @param [in] ChangedTags
+	 *	The tags that are being added to or removed from this ASC.
+	 * @param [out] OutWeightGroup
+	 *	A reference to the variable to receive the earliest affected weight group, if one was found.
+	 *
+	 * @return
+	 *	true if an active weight group depends on at least one of the given tags; or, false, otherwise.
+	 */
+	bool FindFirstWeightGroupAffectedByTags(const FGameplayTagContainer& ChangedTags, FName& OutWeightGroup);
+
+	/**
+	 * Determines whether changes are currently being accumulated in a dynamic tag batch.
+	 *
+	 * @return
+	 *	true if at least one dynamic tag batch has been started and not yet ended; or, false, otherwise.
+	 */
+	FORCEINLINE bool IsInDynamicTagBatch() const
+	{
+		return (this->DynamicTagBatchDepth > 0);
+	}
+
+	/**
+	 * Re-applies the passive GEs affected by all changes accumulated during the dynamic tag batch that just ended.
+	 */
+	void CommitDynamicTagBatch();
+
+	/**
+	 * Removes and re-applies only the "dummy" GE that grants dynamic tags, so that it grants the current dynamic tags.
+	 *
+	 * This has no effect if the weight group of the dynamic tags GE is not active.
+	 */
+	void ReapplyDynamicTagsEffect();
 
 	/**
 	 * Activates a specific passive Gameplay Effect on this ASC.
@@ -326,6 +465,41 @@ protected:
 	template<typename Func>
 	void InvokeAndReapplyAllPassiveGEs(const Func Callable);
 
+	/**
+	 * Invokes the logic of the specified callable, which changes dynamic tags, then re-applies passive GEs starting at
+	 * the given weight group.
+	 *
+	 * The given weight group and all active weight groups after it are deactivated before the callable is invoked. Once
+	 * it returns, the dynamic tags GE is refreshed (if its weight group is not among them), and then the weight groups
+	 * are re-activated in weight order.
+	 *
+	 * @param FirstWeightGroup
+	 *	The earliest weight group to re-apply.
+	 * @param Callable
+	 *	A lambda that is invoked to perform the task.
+	 */
+	template<typename Func>
+	void InvokeAndReapplyPassiveGEsStartingAt(const FName FirstWeightGroup, const Func Callable);
+
+	/**
+	 * Invokes the logic of the specified callable, which changes dynamic tags, then re-applies affected passive GEs.
+	 *
+	 * Only the earliest active weight group that depends on one of the changed tags, and all active weight groups after
+	 * it, are deactivated before the callable is invoked and re-activated afterward. If no weight group depends on the
+	 * changed tags, only the dynamic tags GE is re-applied.
+	 *
+	 * If bReapplyAllPassiveGEsOnTagChange is true, this behaves like InvokeAndReapplyAllPassiveGEs() instead. If a
+	 * dynamic tag batch is in progress, the callable is invoked and the changed tags are recorded, but no passive GEs
+	 * are re-applied until the batch ends.
+	 *
+	 * @param ChangedTags
+	 *	The tags that the callable adds or removes.
+	 * @param Callable
+	 *	A lambda that is invoked to perform the task.
+	 */
+	template<typename Func>
+	void InvokeAndReapplyPassiveGEsAffectedByTags(const FGameplayTagContainer ChangedTags, const Func Callable);
+
 	/**
 	 * Invokes the logic of the specified callable, then re-applies passive GEs in weight groups after it.
 	 *
@@ -407,6 +407,8 @@ public:
 	 * size, skill proficiency, etc. If passive GEs are currently active on this ASC, they will be re-applied when this
 	 * method is called. Consequently, calling AppendDynamicTags() is preferred over this method when there are multiple
 	 * tags that should be applied at the same time, to avoid unnecessary overhead from re-applying all passive GEs.
+	 * When tags are changed in several different places, wrap the changes in BeginDynamicTagBatch() and
+	 * EndDynamicTagBatch() instead.
 	 *
 	 * @param Tag
 	 *	The tag to apply to this Ability System Component.
@@ -476,4 +478,25 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category="OpenPF2|Components|Actors|Ability System")
 	virtual void RemoveAllDynamicTags() = 0;
+
+	/**
+	 * Starts a batch of changes to dynamic tags and passive GEs on this ASC.
+	 *
+	 * Until the matching call to EndDynamicTagBatch(), changes to dynamic tags and passive GEs added to this ASC are
+	 * accumulated instead of causing passive GEs to be re-applied after each change. When the batch ends, affected
+	 * passive GEs are re-applied at most once.
+	 *
+	 * Batches can be nested; passive GEs are only re-applied when the outermost batch ends. In C++, prefer
+	 * FPF2DynamicTagBatchScope, which ends the batch automatically.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Components|Actors|Ability System")
+	virtual void BeginDynamicTagBatch() = 0;
+
+	/**
+	 * Ends a batch of changes that was started with BeginDynamicTagBatch().
+	 *
+	 * If this ends the outermost batch, passive GEs affected by changes made during the batch are re-applied.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Components|Actors|Ability System")
+	virtual void EndDynamicTagBatch() = 0;
 };
@@ -0,0 +1,63 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Actors/Components/PF2AbilitySystemInterface.h"
+
+/**
+ * RAII helper that batches changes to the dynamic tags and passive GEs of an ASC until it goes out of scope.
+ *
+ * While the scope is active, changes accumulate on the ASC instead of causing passive GEs to be re-applied after each
+ * change. When the scope ends, affected passive GEs are re-applied at most once. Scopes may be nested.
+ *
+ * For example:
+ * @code
+ * {
+ *	FPF2DynamicTagBatchScope BatchScope(AbilitySystemComponent);
+ *
+ *	AbilitySystemComponent->AddDynamicTag(FirstTag);
+ *	AbilitySystemComponent->AddDynamicTag(SecondTag);
+ * }
+ * @endcode
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2DynamicTagBatchScope final
+{
+protected:
+	/**
+	 * The ASC on which the batch was started; or, nullptr if no ASC was provided.
+	 */
+	IPF2AbilitySystemInterface* AbilitySystemComponent;
+
+public:
+	/**
+	 * Constructor for FPF2DynamicTagBatchScope.
+	 *
+	 * @param AbilitySystemComponent
+	 *	The ASC on which to batch changes until this object is destroyed. If this is nullptr, this scope has no effect.
+	 */
+	explicit FPF2DynamicTagBatchScope(IPF2AbilitySystemInterface* AbilitySystemComponent) :
+		AbilitySystemComponent(AbilitySystemComponent)
+	{
+		if (this->AbilitySystemComponent != nullptr)
+		{
+			this->AbilitySystemComponent->BeginDynamicTagBatch();
+		}
+	}
+
+	/**
+	 * Destructor for FPF2DynamicTagBatchScope.
+	 */
+	~FPF2DynamicTagBatchScope()
+	{
+		if (this->AbilitySystemComponent != nullptr)
+		{
+			this->AbilitySystemComponent->EndDynamicTagBatch();
+		}
+	}
+
+	FPF2DynamicTagBatchScope(const FPF2DynamicTagBatchScope&)            = delete;
+	FPF2DynamicTagBatchScope& operator=(const FPF2DynamicTagBatchScope&) = delete;
+};
@@ -26,6 +26,12 @@ class OPENPF2GAMEFRAMEWORK_API UPF2SimpleTemlModifierCalculationBase : public UP
 {
 	GENERATED_BODY()
 
+public:
+	// =================================================================================================================
+	// Public Methods - IPF2TagDependentCalculationInterface Implementation
+	// =================================================================================================================
+	virtual FGameplayTagContainer GetQueriedTags() const override;
+
 protected:
 	// =================================================================================================================
 	// Protected Fields
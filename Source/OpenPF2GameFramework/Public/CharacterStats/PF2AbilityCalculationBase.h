@@ -7,13 +7,17 @@
 
 #include <GameplayModMagnitudeCalculation.h>
 
+#include "CharacterStats/PF2TagDependentCalculationInterface.h"
+
 #include "PF2AbilityCalculationBase.generated.h"
 
 /**
  * Base class for MMCs that provide values based on captured character ability values.
  */
 UCLASS(Abstract)
-class OPENPF2GAMEFRAMEWORK_API UPF2AbilityCalculationBase : public UGameplayModMagnitudeCalculation
+class OPENPF2GAMEFRAMEWORK_API UPF2AbilityCalculationBase :
+	public UGameplayModMagnitudeCalculation,
+	public IPF2TagDependentCalculationInterface
 {
 	GENERATED_BODY()
 
@@ -23,6 +27,20 @@ public:
 	// =================================================================================================================
 	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
 
+	// =================================================================================================================
+	// Public Methods - IPF2TagDependentCalculationInterface Implementation
+	// =================================================================================================================
+	/**
+	 * Gets the tags that this calculation checks for on the source or target of the GE.
+	 *
+	 * Ability calculations only depend on captured attributes by default, so this returns no tags. Sub-classes that
+	 * also check tags must override this method.
+	 *
+	 * @return
+	 *	The tags that can affect the result of this calculation.
+	 */
+	virtual FGameplayTagContainer GetQueriedTags() const override;
+
 protected:
 	// =================================================================================================================
 	// Protected Methods
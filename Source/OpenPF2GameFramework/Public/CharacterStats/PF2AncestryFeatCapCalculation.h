@@ -7,13 +7,17 @@
 
 #include <GameplayModMagnitudeCalculation.h>
 
+#include "CharacterStats/PF2TagDependentCalculationInterface.h"
+
 #include "PF2AncestryFeatCapCalculation.generated.h"
 
 /**
  * An MMC for calculating how many ancestry feats a character is entitled to have at their current level.
  */
 UCLASS()
-class OPENPF2GAMEFRAMEWORK_API UPF2AncestryFeatCapCalculation : public UGameplayModMagnitudeCalculation
+class OPENPF2GAMEFRAMEWORK_API UPF2AncestryFeatCapCalculation :
+	public UGameplayModMagnitudeCalculation,
+	public IPF2TagDependentCalculationInterface
 {
 	GENERATED_BODY()
 
@@ -22,4 +26,9 @@ public:
 	// Public Methods - UGameplayModMagnitudeCalculation Implementation
 	// =================================================================================================================
 	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
+
+	// =================================================================================================================
+	// Public Methods - IPF2TagDependentCalculationInterface Implementation
+	// =================================================================================================================
+	virtual FGameplayTagContainer GetQueriedTags() const override;
 };
@@ -33,6 +33,31 @@ class OPENPF2GAMEFRAMEWORK_API UPF2ApplyDamageFromSourceExecution : public UGame
 	 */
 	FGameplayTag InflictDamageCueTag;
 
+	/**
+	 * The capture definition of the target resistance to each type of damage.
+	 *
+	 * This is parallel to FPF2AttackAttributeStatics::GetAllDamageCaptures() (i.e., the resistance at each index
+	 * corresponds to the damage capture at the same index). An entry is nullptr if the target has no resistance
+	 * attribute for the corresponding damage type.
+	 */
+	TArray<const FGameplayEffectAttributeCaptureDefinition*> ResistanceCapturesByDamageIndex;
+
+protected:
+	// =================================================================================================================
+	// Protected Properties
+	// =================================================================================================================
+	/**
+	 * Whether to emit a single "inflict damage" cue per hit rather than one cue per type of damage inflicted.
+	 *
+	 * When enabled, the damage of each type is packed into the parameters of the cue (see PF2DamageCueUtilities), and
+	 * cue handlers can unpack it with UPF2AbilitySystemLibrary::GetDamageByTypeFromGameplayCue(). This reduces the
+	 * number of cues that have to be replicated for weapons and effects that inflict several types of damage, at the
+	 * cost of the GameplayEffectLevel and AbilityLevel of the cue being used to carry damage amounts. Hits that inflict
+	 * more than PF2DamageCueUtilities::MaxDamageTypesPerCue types of damage are split across several cues.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="OpenPF2|Gameplay Cues")
+	bool bCoalesceDamageCues;
+
 public:
 	// =================================================================================================================
 	// Constructors
@@ -61,6 +86,33 @@ protected:
 		return this->InflictDamageCueTag;
 	}
 
+	/**
+	 * Gets the mask of damage types that the GE being executed can inflict.
+	 *
+	 * The mask is derived from the damage type tags among the dynamic asset tags of the owning GE spec (see
+	 * UPF2AbilitySystemLibrary::AddDamageTypesToGameplayEffectSpec()). If the spec does not carry any damage type tags,
+	 * every damage type is assumed to be possible.
+	 *
+	 * @param ExecutionParams
+	 *	The parameters passed to the current GE execution.
+	 *
+	 * @return
+	 *	A mask that has a bit set for the index of each damage capture that should be evaluated.
+	 */
+	static uint32 GetDamageTypeMaskOfSpec(const FGameplayEffectCustomExecutionParameters& ExecutionParams);
+
+	/**
+	 * Emits "inflict damage" cues on the target that carry the damage of several types at once.
+	 *
+	 * @param ExecutionParams
+	 *	The parameters passed to the current GE execution.
+	 * @param DamageByType
+	 *	The damage type tag and amount of each type of damage that was inflicted on the target.
+	 */
+	void ExecuteCoalescedDamageCues(
+		const FGameplayEffectCustomExecutionParameters&    ExecutionParams,
+		const TConstArrayView<TPair<FGameplayTag, float>>& DamageByType) const;
+
 	/**
 	 * Populates parameters from a gameplay cue from the parameters of the current GE execution.
 	 *
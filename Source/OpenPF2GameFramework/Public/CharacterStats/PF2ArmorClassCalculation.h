@@ -14,6 +14,8 @@
 
 #include <GameplayModMagnitudeCalculation.h>
 
+#include "CharacterStats/PF2TagDependentCalculationInterface.h"
+
 #include "PF2ArmorClassCalculation.generated.h"
 
 /**
@@ -25,10 +27,67 @@
  * bonus with their armor, plus their armor’s item bonus to AC and any other permanent bonuses and penalties."
  */
 UCLASS()
-class OPENPF2GAMEFRAMEWORK_API UPF2ArmorClassCalculation : public UGameplayModMagnitudeCalculation
+class OPENPF2GAMEFRAMEWORK_API UPF2ArmorClassCalculation :
+	public UGameplayModMagnitudeCalculation,
+	public IPF2TagDependentCalculationInterface
 {
 	GENERATED_BODY()
 
+protected:
+	// =================================================================================================================
+	// Protected Types
+	// =================================================================================================================
+	/**
+	 * The tags that indicate the type of armor a character is wearing and their proficiency with that type of armor.
+	 */
+	struct FArmorTypeTags
+	{
+		/**
+		 * The parent tag of all tags that indicate the character has armor equipped.
+		 */
+		const FGameplayTag EquippedTag;
+
+		/**
+		 * The tag that indicates the character has light armor equipped.
+		 */
+		const FGameplayTag EquippedLightTag;
+
+		/**
+		 * The tag that indicates the character has medium armor equipped.
+		 */
+		const FGameplayTag EquippedMediumTag;
+
+		/**
+		 * The tag that indicates the character has heavy armor equipped.
+		 */
+		const FGameplayTag EquippedHeavyTag;
+
+		/**
+		 * The prefix of the TEML proficiency tags for unarmored defense.
+		 */
+		const FGameplayTag CategoryUnarmoredTag;
+
+		/**
+		 * The prefix of the TEML proficiency tags for light armor.
+		 */
+		const FGameplayTag CategoryLightTag;
+
+		/**
+		 * The prefix of the TEML proficiency tags for medium armor.
+		 */
+		const FGameplayTag CategoryMediumTag;
+
+		/**
+		 * The prefix of the TEML proficiency tags for heavy armor.
+		 */
+		const FGameplayTag CategoryHeavyTag;
+
+		/**
+		 * Constructor for FArmorTypeTags.
+		 */
+		explicit FArmorTypeTags();
+	};
+
 public:
 	// =================================================================================================================
 	// Constructors
@@ -43,6 +102,11 @@ public:
 	// =================================================================================================================
 	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
 
+	// =================================================================================================================
+	// Public Methods - IPF2TagDependentCalculationInterface Implementation
+	// =================================================================================================================
+	virtual FGameplayTagContainer GetQueriedTags() const override;
+
 protected:
 	// =================================================================================================================
 	// Protected Fields
@@ -82,7 +146,8 @@ protected:
 	 *	"Armor.Equipped.Unarmored", "Armor.Equipped.Light", etc.).
 	 *
 	 * @return
-	 *	The name of the armor type ("Unarmored", "Light", "Medium", or "Heavy").
+	 *	The prefix of the TEML proficiency tags for the armor type (e.g., "Armor.Category.Unarmored",
+	 *	"Armor.Category.Light", "Armor.Category.Medium", or "Armor.Category.Heavy").
 	 */
-	FString DetermineArmorType(const FGameplayTagContainer *SourceTags) const;
+	FGameplayTag DetermineArmorType(const FGameplayTagContainer *SourceTags) const;
 };
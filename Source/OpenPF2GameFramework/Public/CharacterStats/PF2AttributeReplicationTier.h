@@ -0,0 +1,30 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <UObject/ObjectMacros.h>
+
+/**
+ * An enumeration of which network connections an attribute of a character is replicated to.
+ */
+UENUM(BlueprintType)
+enum class EPF2AttributeReplicationTier : uint8
+{
+	/**
+	 * The attribute is replicated to every client (e.g., hit points and armor class).
+	 */
+	Everyone,
+
+	/**
+	 * The attribute is only replicated to the client that owns the character (e.g., experience and boost counts).
+	 */
+	Owner,
+
+	/**
+	 * The attribute is never replicated, so it is only available on the server.
+	 */
+	ServerOnly,
+};
@@ -20,7 +20,7 @@
 #define DEFINE_PF2_ATTRIBUTE_CAPTUREDEF(S, P, T, B) \
 { \
 	DEFINE_ATTRIBUTE_CAPTUREDEF(S, P, T, B) \
-	this->CaptureDefinitions.Add(P##Property->GetName(), &P##Def); \
+	this->RegisterCaptureDefinition(&P##Def); \
 }
 
 #define DEFINE_PF2_ABILITY_SCORE_CAPTUREDEF(S, P, T, B) \
@@ -0,0 +1,247 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Net/Serialization/FastArraySerializer.h>
+
+#include "PF2AttributeSnapshot.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class UAttributeSet;
+
+struct FPF2AttributeSnapshot;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * The replicated value of a single attribute within an attribute snapshot.
+ *
+ * Values are serialized as 16-bit integers whenever they are whole numbers that fit in 16 bits, which is the case for
+ * nearly all PF2 stats (modifiers, proficiency ranks, hit points, etc.). Other values fall back to full precision.
+ */
+USTRUCT()
+struct OPENPF2GAMEFRAMEWORK_API FPF2AttributeSnapshotItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	// =================================================================================================================
+	// Public Fields
+	// =================================================================================================================
+	/**
+	 * The index of the attribute in the attribute table of the owning attribute set class.
+	 *
+	 * @see FPF2AttributeSnapshot::GetAttributeIndex()
+	 */
+	UPROPERTY()
+	uint8 AttributeIndex;
+
+	/**
+	 * The base value of the attribute.
+	 */
+	UPROPERTY()
+	float BaseValue;
+
+	/**
+	 * The current value of the attribute.
+	 */
+	UPROPERTY()
+	float CurrentValue;
+
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor.
+	 */
+	explicit FPF2AttributeSnapshotItem() : AttributeIndex(0), BaseValue(0.0f), CurrentValue(0.0f)
+	{
+	}
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Serializes this item to or from a compact network representation.
+	 *
+	 * @param Ar
+	 *	The archive being serialized to or from.
+	 * @param Map
+	 *	The package map of the connection (unused).
+	 * @param bOutSuccess
+	 *	Set to whether serialization succeeded.
+	 *
+	 * @return
+	 *	Always true, to indicate that this struct has handled its own serialization.
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	// =================================================================================================================
+	// Public Methods - FFastArraySerializerItem Callbacks
+	// =================================================================================================================
+	void PostReplicatedAdd(const FPF2AttributeSnapshot& InArraySerializer);
+	void PostReplicatedChange(const FPF2AttributeSnapshot& InArraySerializer);
+};
+
+template<>
+struct TStructOpsTypeTraits<FPF2AttributeSnapshotItem> : public TStructOpsTypeTraitsBase2<FPF2AttributeSnapshotItem>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * A compact, batched alternative to replicating each attribute of an attribute set as its own property.
+ *
+ * Only attributes that have been recorded by the server (i.e., that have changed since the attribute set was created)
+ * appear in the snapshot, and only the items for attributes that changed since the state last acknowledged by a client
+ * are sent to that client. Each item is quantized to 16 bits per value whenever possible (see
+ * FPF2AttributeSnapshotItem).
+ *
+ * Attributes are identified by their index among the replicated FGameplayAttributeData properties of the owning
+ * attribute set class, which is identical on the server and clients.
+ */
+USTRUCT()
+struct OPENPF2GAMEFRAMEWORK_API FPF2AttributeSnapshot : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The replicated value of each attribute that has been recorded.
+	 */
+	UPROPERTY()
+	TArray<FPF2AttributeSnapshotItem> Items;
+
+	/**
+	 * The attribute set that values are recorded from (on the server) and applied to (on clients).
+	 *
+	 * This is the object that contains this snapshot, so it does not need to be tracked by the garbage collector.
+	 */
+	UAttributeSet* OwningAttributeSet = nullptr;
+
+	/**
+	 * The position of the item for each attribute in Items, indexed by attribute index; or, INDEX_NONE if the attribute
+	 * has not been recorded.
+	 */
+	TArray<int32> ItemPositionsByAttribute;
+
+public:
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Gets the attributes of the given attribute set class that can be replicated in a snapshot.
+	 *
+	 * @param AttributeSetClass
+	 *	The type of attribute set for which attributes are desired.
+	 *
+	 * @return
+	 *	The replicated FGameplayAttributeData properties of the class, in a stable order.
+	 */
+	static const TArray<FProperty*>& GetSnapshotAttributes(const UClass* AttributeSetClass);
+
+	/**
+	 * Gets the index of the given attribute among the attributes of its attribute set class that can be replicated.
+	 *
+	 * @param AttributeSetClass
+	 *	The type of attribute set to which the attribute belongs.
+	 * @param AttributeProperty
+	 *	The property of the attribute.
+	 *
+	 * @return
+	 *	Either the index of the attribute; or, INDEX_NONE if the property is not a replicated attribute of the class.
+	 */
+	static int32 GetAttributeIndex(const UClass* AttributeSetClass, const FProperty* AttributeProperty);
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Sets the attribute set that values are recorded from and applied to.
+	 *
+	 * @param AttributeSet
+	 *	The attribute set that owns this snapshot.
+	 */
+	FORCEINLINE void SetOwningAttributeSet(UAttributeSet* AttributeSet)
+	{
+		this->OwningAttributeSet = AttributeSet;
+	}
+
+	/**
+	 * Gets the attribute set that values are recorded from and applied to.
+	 *
+	 * @return
+	 *	The attribute set that owns this snapshot.
+	 */
+	FORCEINLINE UAttributeSet* GetOwningAttributeSet() const
+	{
+		return this->OwningAttributeSet;
+	}
+
+	/**
+	 * Gets the number of attributes that have been recorded in this snapshot.
+	 *
+	 * @return
+	 *	The number of items in this snapshot.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return this->Items.Num();
+	}
+
+	/**
+	 * Records the current base and current value of an attribute of the owning attribute set.
+	 *
+	 * This should only be called on the server.
+	 *
+	 * @param AttributeProperty
+	 *	The property of the attribute to record.
+	 *
+	 * @return
+	 *	- true if the value of the attribute in the snapshot has changed and needs to be replicated.
+	 *	- false if the attribute is not part of the snapshot or its recorded value has not changed.
+	 */
+	bool RecordAttribute(const FProperty* AttributeProperty);
+
+	/**
+	 * Applies the value in the given item to the corresponding attribute of the owning attribute set.
+	 *
+	 * This is invoked on clients when an item has been replicated.
+	 *
+	 * @param Item
+	 *	The item that has been added or changed.
+	 */
+	void ApplyItem(const FPF2AttributeSnapshotItem& Item) const;
+
+	// =================================================================================================================
+	// Public Methods - FFastArraySerializer Implementation
+	// =================================================================================================================
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FPF2AttributeSnapshotItem, FPF2AttributeSnapshot>(
+			this->Items,
+			DeltaParms,
+			*this
+		);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FPF2AttributeSnapshot> : public TStructOpsTypeTraitsBase2<FPF2AttributeSnapshot>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -23,9 +23,25 @@ protected:
 	// =================================================================================================================
 	/**
 	 * A map of all capture definitions, keyed by property name.
+	 *
+	 * This only exists to support the deprecated, string-based GetCaptureByAttributeName() lookup.
 	 */
 	TMap<FString, const FGameplayEffectAttributeCaptureDefinition*> CaptureDefinitions;
 
+	/**
+	 * All capture definitions, indexed by slot.
+	 *
+	 * Each capture definition is assigned the next available slot as it is registered, so slots are dense and stable for
+	 * the lifetime of the container.
+	 */
+	TArray<const FGameplayEffectAttributeCaptureDefinition*> CaptureDefinitionsBySlot;
+
+	/**
+	 * Map from each captured attribute to the slot of its capture definition.
+	 */
+	TMap<FGameplayAttribute, int32> SlotsByAttribute;
+
+public:
 	// =================================================================================================================
 	// Public Methods
 	// =================================================================================================================
@@ -33,13 +49,81 @@ protected:
 	 * Gets all attribute capture definitions.
 	 *
 	 * @return
-	 *	An array of all the capture definitions for character attributes.
+	 *	An array of all the capture definitions in this container, indexed by slot.
 	 */
-	FORCEINLINE TArray<const FGameplayEffectAttributeCaptureDefinition*> GetCaptureDefinitions() const
+	FORCEINLINE const TArray<const FGameplayEffectAttributeCaptureDefinition*>& GetCaptureDefinitions() const
 	{
-		TArray<const FGameplayEffectAttributeCaptureDefinition*> Result;
+		return this->CaptureDefinitionsBySlot;
+	}
 
-		this->CaptureDefinitions.GenerateValueArray(Result);
+	/**
+	 * Gets the number of capture definitions (and, therefore, slots) in this container.
+	 *
+	 * @return
+	 *	The number of capture definitions. Valid slots range from 0 to one less than this number.
+	 */
+	FORCEINLINE int32 GetNumCaptureSlots() const
+	{
+		return this->CaptureDefinitionsBySlot.Num();
+	}
+
+	/**
+	 * Gets the slot of the capture definition for the given attribute.
+	 *
+	 * Slots can be looked up once (e.g., when an execution is constructed) and then used for constant-time access to
+	 * capture definitions with GetCaptureBySlot().
+	 *
+	 * @param Attribute
+	 *	The attribute for which a slot is desired.
+	 *
+	 * @return
+	 *	Either the slot of the capture definition; or, INDEX_NONE if this container does not capture the attribute.
+	 */
+	FORCEINLINE int32 GetSlotOfAttribute(const FGameplayAttribute& Attribute) const
+	{
+		const int32* Slot = this->SlotsByAttribute.Find(Attribute);
+
+		return (Slot == nullptr) ? INDEX_NONE : *Slot;
+	}
+
+	/**
+	 * Gets the capture definition in the given slot.
+	 *
+	 * @param Slot
+	 *	The slot of the capture definition.
+	 *
+	 * @return
+	 *	Either the desired capture definition; or nullptr if the slot is not valid.
+	 */
+	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetCaptureBySlot(const int32 Slot) const
+	{
+		return this->CaptureDefinitionsBySlot.IsValidIndex(Slot) ? this->CaptureDefinitionsBySlot[Slot] : nullptr;
+	}
+
+	/**
+	 * Gets the capture definition for the given attribute.
+	 *
+	 * @param Attribute
+	 *	The attribute for which a capture definition is desired.
+	 *
+	 * @return
+	 *	Either the desired capture definition; or nullptr if this container does not capture the given attribute.
+	 */
+	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetCaptureByAttribute(
+		const FGameplayAttribute& Attribute) const
+	{
+		const FGameplayEffectAttributeCaptureDefinition* Result =
+			this->GetCaptureBySlot(this->GetSlotOfAttribute(Attribute));
+
+		if (Result == nullptr)
+		{
+			UE_LOG(
+				LogPf2Stats,
+				Error,
+				TEXT("No attribute capture corresponds to attribute '%s'."),
+				*(Attribute.GetName())
+			);
+		}
 
 		return Result;
 	}
@@ -54,6 +138,7 @@ protected:
 	 *	Either the desired capture definition; or nullptr if the given attribute name doesn't correspond to a value in
 	 *	the attribute set.
 	 */
+	UE_DEPRECATED(5.3, "Look up captures by attribute or slot with GetCaptureByAttribute() or GetCaptureBySlot() instead.")
 	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetCaptureByAttributeName(const FString& Name) const
 	{
 		if (this->CaptureDefinitions.Contains(Name))
@@ -72,4 +157,30 @@ protected:
 			return nullptr;
 		}
 	}
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Adds a capture definition to this container, assigning it the next available slot.
+	 *
+	 * This is invoked by DEFINE_PF2_ATTRIBUTE_CAPTUREDEF() and should not normally need to be called directly.
+	 *
+	 * @param CaptureDefinition
+	 *	The capture definition to add. The definition must be a field of this container.
+	 *
+	 * @return
+	 *	The slot assigned to the capture definition.
+	 */
+	FORCEINLINE int32 RegisterCaptureDefinition(const FGameplayEffectAttributeCaptureDefinition* CaptureDefinition)
+	{
+		const FGameplayAttribute& Attribute = CaptureDefinition->AttributeToCapture;
+		const int32               Slot      = this->CaptureDefinitionsBySlot.Add(CaptureDefinition);
+
+		this->CaptureDefinitions.Add(Attribute.GetName(), CaptureDefinition);
+		this->SlotsByAttribute.Add(Attribute, Slot);
+
+		return Slot;
+	}
 };
@@ -1,4 +1,4 @@
-// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2021-2024, Guy Elsmore-Paddock. All Rights Reserved.
 //
 // Content from Pathfinder 2nd Edition is licensed under the Open Game License (OGL) v1.0a, subject to the following:
 //   - Open Game License v 1.0a, Copyright 2000, Wizards of the Coast, Inc.
@@ -15,6 +15,8 @@
 #include <AttributeSet.h>
 #include <AbilitySystemComponent.h>
 
+#include "CharacterStats/PF2AttributeReplicationTier.h"
+#include "CharacterStats/PF2AttributeSnapshot.h"
 #include "CharacterStats/PF2AttributeSetMacros.h"
 
 #include "PF2CharacterAttributeSet.generated.h"
@@ -25,12 +27,41 @@
 class IPF2CharacterInterface;
 
 // =====================================================================================================================
-// Normal Declarations
+// Normal Declarations - Delegates
+// =====================================================================================================================
+/**
+ * Delegate for native code to react to a Gameplay Effect having been executed against a specific attribute.
+ *
+ * @param SourceEffectSpec
+ *	Specifications and context about the gameplay effect execution that modified the attribute.
+ * @param TargetCharacter
+ *	The character whose attribute was modified. This is usually the same as the character who owns the attribute set.
+ * @param ValueDelta
+ *	The amount of the change, if the modification was additive; otherwise, 0.
+ */
+DECLARE_DELEGATE_ThreeParams(
+	FPF2AttributeExecutedDelegate,
+	const FGameplayEffectSpec& /* SourceEffectSpec */,
+	IPF2CharacterInterface*    /* TargetCharacter */,
+	const float                /* ValueDelta */
+);
+
+// =====================================================================================================================
+// Normal Declarations - Types
 // =====================================================================================================================
 /**
  * This holds all of the attributes used by abilities. A copy of this is instantiated on every character.
+ *
+ * Each replicated attribute belongs to a replication tier (see EPF2AttributeReplicationTier) that controls which
+ * clients receive it. The default tier of each attribute can be overridden in the game config, for example:
+ *
+ * [/Script/OpenPF2GameFramework.PF2CharacterAttributeSet]
+ * ReplicationTierOverrides=(("Experience", Everyone),("SkLore2Modifier", ServerOnly))
+ *
+ * Attributes in the "Everyone" tier can optionally be replicated as a single, quantized snapshot instead of as separate
+ * properties (see bReplicateAttributesAsSnapshot).
  */
-UCLASS()
+UCLASS(Config=Game)
 class OPENPF2GAMEFRAMEWORK_API UPF2CharacterAttributeSet : public UAttributeSet
 {
 	GENERATED_BODY()
@@ -825,10 +856,50 @@ public:
 	// =================================================================================================================
 	// Public Methods - UAttributeSet Overrides
 	// =================================================================================================================
+	virtual void PostInitProperties() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
+
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute,
+	                                 const float               OldValue,
+	                                 const float               NewValue) override;
+
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute,
+	                                     const float               OldValue,
+	                                     const float               NewValue) const override;
+
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the tier that controls which clients receive the specified attribute of this set.
+	 *
+	 * @param AttributeName
+	 *	The name of the attribute property (e.g., "HitPoints").
+	 *
+	 * @return
+	 *	The tier from ReplicationTierOverrides, if the attribute has been overridden; otherwise, the default tier of the
+	 *	attribute.
+	 */
+	EPF2AttributeReplicationTier GetReplicationTierOfAttribute(const FName& AttributeName) const;
+
+	/**
+	 * Registers a handler to invoke after a Gameplay Effect has been executed against the specified attribute.
+	 *
+	 * This is how subclasses and game-specific code react to changes in attributes, without needing to override
+	 * PostGameplayEffectExecute(). Each attribute can have only one handler; registering a handler for an attribute that
+	 * already has one replaces the existing handler.
+	 *
+	 * @param Attribute
+	 *	The attribute for which the handler is being registered. This must be an attribute of this set.
+	 * @param Handler
+	 *	The handler to invoke.
+	 */
+	void RegisterAttributeExecutedHandler(const FGameplayAttribute&            Attribute,
+	                                      const FPF2AttributeExecutedDelegate& Handler);
+
 	// =================================================================================================================
 	// Public Methods - Replication Callbacks
 	// =================================================================================================================
@@ -1067,6 +1138,70 @@ protected:
 	 */
 	inline static const FName HitPointsChangedEventTagName = TEXT("GameplayAbility.GameplayEvent.HitPointsChanged");
 
+	/**
+	 * The replication tier of each attribute that is not replicated to everyone, unless overridden in config.
+	 *
+	 * These attributes are only of interest to the player controlling the character, so there is no need to replicate
+	 * them for every character to every client.
+	 */
+	inline static const TMap<FName, EPF2AttributeReplicationTier> DefaultReplicationTiers = {
+		{ "Experience",             EPF2AttributeReplicationTier::Owner },
+		{ "AbBoostCount",           EPF2AttributeReplicationTier::Owner },
+		{ "AbBoostLimit",           EPF2AttributeReplicationTier::Owner },
+		{ "ClassDifficultyClass",   EPF2AttributeReplicationTier::Owner },
+		{ "SkAcrobaticsModifier",   EPF2AttributeReplicationTier::Owner },
+		{ "SkArcanaModifier",       EPF2AttributeReplicationTier::Owner },
+		{ "SkAthleticsModifier",    EPF2AttributeReplicationTier::Owner },
+		{ "SkCraftingModifier",     EPF2AttributeReplicationTier::Owner },
+		{ "SkDeceptionModifier",    EPF2AttributeReplicationTier::Owner },
+		{ "SkDiplomacyModifier",    EPF2AttributeReplicationTier::Owner },
+		{ "SkIntimidationModifier", EPF2AttributeReplicationTier::Owner },
+		{ "SkLore1Modifier",        EPF2AttributeReplicationTier::Owner },
+		{ "SkLore2Modifier",        EPF2AttributeReplicationTier::Owner },
+		{ "SkMedicineModifier",     EPF2AttributeReplicationTier::Owner },
+		{ "SkNatureModifier",       EPF2AttributeReplicationTier::Owner },
+		{ "SkOccultismModifier",    EPF2AttributeReplicationTier::Owner },
+		{ "SkPerformanceModifier",  EPF2AttributeReplicationTier::Owner },
+		{ "SkReligionModifier",     EPF2AttributeReplicationTier::Owner },
+		{ "SkSocietyModifier",      EPF2AttributeReplicationTier::Owner },
+		{ "SkStealthModifier",      EPF2AttributeReplicationTier::Owner },
+		{ "SkSurvivalModifier",     EPF2AttributeReplicationTier::Owner },
+		{ "SkThieveryModifier",     EPF2AttributeReplicationTier::Owner },
+		{ "SpellAttackRoll",        EPF2AttributeReplicationTier::Owner },
+		{ "SpellDifficultyClass",   EPF2AttributeReplicationTier::Owner },
+		{ "FeAncestryFeatCount",    EPF2AttributeReplicationTier::Owner },
+		{ "FeAncestryFeatLimit",    EPF2AttributeReplicationTier::Owner },
+	};
+
+	// =================================================================================================================
+	// Protected Properties
+	// =================================================================================================================
+	/**
+	 * Overrides for the replication tiers of attributes, keyed by attribute name.
+	 *
+	 * An attribute that appears in this map uses the tier from this map instead of its default tier. Changes only take
+	 * effect at startup, since replication conditions are fixed once the replication layout of this class is built.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, Category="OpenPF2|Replication")
+	TMap<FName, EPF2AttributeReplicationTier> ReplicationTierOverrides;
+
+	/**
+	 * Whether attributes in the "Everyone" replication tier are replicated through AttributeSnapshot.
+	 *
+	 * When enabled, these attributes are not replicated as separate properties. Instead, the server records each change
+	 * to them in AttributeSnapshot, which sends only the attributes that have changed since the last state acknowledged
+	 * by each client, quantized to 16 bits per value whenever possible. This is most useful for encounters with many
+	 * characters. Attributes in other tiers are unaffected. Changes only take effect at startup.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, Category="OpenPF2|Replication")
+	bool bReplicateAttributesAsSnapshot;
+
+	/**
+	 * The snapshot through which attributes are replicated when bReplicateAttributesAsSnapshot is enabled.
+	 */
+	UPROPERTY(Replicated)
+	FPF2AttributeSnapshot AttributeSnapshot;
+
 	// =================================================================================================================
 	// Protected Fields
 	// =================================================================================================================
@@ -1080,9 +1215,38 @@ protected:
 	 */
 	FGameplayTag HitPointsChangedEventTag;
 
+	/**
+	 * The handler to invoke when a Gameplay Effect is executed against each attribute, keyed by attribute property.
+	 *
+	 * Looking up the handler for an attribute is a single hash lookup, regardless of how many attributes have handlers.
+	 */
+	TMap<const FProperty*, FPF2AttributeExecutedDelegate> AttributeExecutedHandlers;
+
 	// =================================================================================================================
 	// Protected Methods
 	// =================================================================================================================
+	/**
+	 * Flags an attribute of this set as needing to be replicated during the next net update.
+	 *
+	 * Attributes of this set use push-model replication, so a change to an attribute is not replicated unless it has
+	 * been marked dirty.
+	 *
+	 * @param Attribute
+	 *	The attribute that has changed. Attributes that do not belong to this attribute set are ignored.
+	 */
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute) const;
+
+	/**
+	 * Records the value of an attribute of this set in the attribute snapshot, if the attribute is replicated by it.
+	 *
+	 * This has no effect unless bReplicateAttributesAsSnapshot is enabled, this is running on the server, and the
+	 * attribute belongs to the "Everyone" replication tier.
+	 *
+	 * @param Attribute
+	 *	The attribute that has changed.
+	 */
+	void RecordAttributeInSnapshot(const FGameplayAttribute& Attribute);
+
 	/**
 	 * Notifies the ASC of the target about a change to an attribute.
 	 *
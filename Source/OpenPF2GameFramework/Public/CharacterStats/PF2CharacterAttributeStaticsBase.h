@@ -120,6 +120,22 @@ public:
 	 */
 	TArray<FString> AbilityModifierNames;
 
+	/**
+	 * The slot of the capture definition for each ability score, indexed by EPF2CharacterAbilityScoreType.
+	 */
+	TArray<int32> AbilityScoreSlots;
+
+	/**
+	 * The slot of the capture definition for the modifier of each ability score, indexed by
+	 * EPF2CharacterAbilityScoreType.
+	 */
+	TArray<int32> AbilityModifierSlots;
+
+	/**
+	 * Map from each damage type tag to the slot of the capture definition for resistance to that damage type.
+	 */
+	TMap<FGameplayTag, int32> ResistanceSlotsByDamageType;
+
 	// =================================================================================================================
 	// Public Methods
 	// =================================================================================================================
@@ -145,22 +161,6 @@ public:
 		return this->AbilityModifierNames;
 	}
 
-	/**
-	 * Gets the capture definition for the given character attribute.
-	 *
-	 * @param Attribute
-	 *	The attribute for which a capture definition is desired.
-	 *
-	 * @return
-	 *	Either the desired capture definition; or nullptr if the given attribute doesn't correspond to a character
-	 *	ability.
-	 */
-	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetCaptureByAttribute(
-		const FGameplayAttribute& Attribute) const
-	{
-		return this->GetCaptureByAttributeName(Attribute.GetName());
-	}
-
 	/**
 	 * Gets the capture definition for the given character ability score type.
 	 *
@@ -174,7 +174,7 @@ public:
 	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetCaptureByAbilityScoreType(
 		const EPF2CharacterAbilityScoreType AbilityScoreType) const
 	{
-		return this->GetCaptureByAttributeName(PF2EnumUtilities::ToString(AbilityScoreType));
+		return this->GetCaptureBySlot(this->AbilityScoreSlots[static_cast<int32>(AbilityScoreType)]);
 	}
 
 	/**
@@ -190,7 +190,7 @@ public:
 	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetModifierCaptureByAbilityScoreType(
 		const EPF2CharacterAbilityScoreType AbilityScoreType) const
 	{
-		return this->GetCaptureByAttributeName(PF2EnumUtilities::ToString(AbilityScoreType) + "Modifier");
+		return this->GetCaptureBySlot(this->AbilityModifierSlots[static_cast<int32>(AbilityScoreType)]);
 	}
 
 	/**
@@ -214,7 +214,20 @@ public:
 	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetResistanceCaptureForDamageType(
 		const FGameplayTag& DamageType) const
 	{
-		return this->GetResistanceCaptureForDamageType(DamageType.GetTagName());
+		const FGameplayEffectAttributeCaptureDefinition* Result =
+			this->GetCaptureBySlot(this->GetResistanceSlotForDamageType(DamageType));
+
+		if (Result == nullptr)
+		{
+			UE_LOG(
+				LogPf2Stats,
+				Error,
+				TEXT("No resistance attribute corresponds to damage type '%s'."),
+				*(DamageType.ToString())
+			);
+		}
+
+		return Result;
 	}
 
 	/**
@@ -230,6 +243,23 @@ public:
 	const FGameplayEffectAttributeCaptureDefinition* GetResistanceCaptureForDamageType(
 		const FName& DamageTypeName) const;
 
+	/**
+	 * Gets the slot of the resistance attribute capture definition for the damage type that has the given tag.
+	 *
+	 * @param DamageType
+	 *	The damage tag for which a resistance capture slot is desired.
+	 *
+	 * @return
+	 *	Either the slot of the desired capture definition (see GetCaptureBySlot()); or, INDEX_NONE if there is no
+	 *	resistance attribute that corresponds to the specified damage type.
+	 */
+	FORCEINLINE int32 GetResistanceSlotForDamageType(const FGameplayTag& DamageType) const
+	{
+		const int32* Slot = this->ResistanceSlotsByDamageType.Find(DamageType);
+
+		return (Slot == nullptr) ? INDEX_NONE : *Slot;
+	}
+
 	/**
 	 * Gets capture definitions for all damage resistances.
 	 *
@@ -246,4 +276,15 @@ protected:
 	 * Protected constructor to prevent instantiation outside of the singleton factory method.
 	 */
 	explicit FPF2CharacterAttributeStaticsBase();
+
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Builds the tables that map ability scores and damage types to the slots of their capture definitions.
+	 *
+	 * This must be called by the constructor of each concrete container, after all capture definitions have been
+	 * registered.
+	 */
+	void IndexCaptureSlots();
 };
@@ -14,13 +14,17 @@
 
 #include <GameplayModMagnitudeCalculation.h>
 
+#include "CharacterStats/PF2TagDependentCalculationInterface.h"
+
 #include "PF2KeyAbilityTemlCalculationBase.generated.h"
 
 /**
  * Base class for MMCs that are based on the key ability of the character (Class DC, Spell Attack Roll, Spell DC, etc.).
  */
 UCLASS(Abstract)
-class OPENPF2GAMEFRAMEWORK_API UPF2KeyAbilityTemlCalculationBase : public UGameplayModMagnitudeCalculation
+class OPENPF2GAMEFRAMEWORK_API UPF2KeyAbilityTemlCalculationBase :
+	public UGameplayModMagnitudeCalculation,
+	public IPF2TagDependentCalculationInterface
 {
 	GENERATED_BODY()
 
@@ -63,6 +67,11 @@ public:
 	// =================================================================================================================
 	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
 
+	// =================================================================================================================
+	// Public Methods - IPF2TagDependentCalculationInterface Implementation
+	// =================================================================================================================
+	virtual FGameplayTagContainer GetQueriedTags() const override;
+
 protected:
 	// =================================================================================================================
 	// Protected Fields
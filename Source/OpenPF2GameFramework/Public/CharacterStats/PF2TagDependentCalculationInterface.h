@@ -0,0 +1,46 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayTagContainer.h>
+
+#include <UObject/Interface.h>
+
+#include "PF2TagDependentCalculationInterface.generated.h"
+
+UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
+class UPF2TagDependentCalculationInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * An interface for Magnitude Calculations (MMCs) and executions that declare which tags on a character they read.
+ *
+ * The OpenPF2 ASC uses this information to limit how many passive Gameplay Effects (GEs) it has to re-apply when the
+ * dynamic tags of a character change. A GE that uses a calculation that does NOT implement this interface is assumed
+ * to depend on every tag, so it is always re-applied.
+ */
+class OPENPF2GAMEFRAMEWORK_API IPF2TagDependentCalculationInterface
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the tags that this calculation checks for on the source or target of the GE.
+	 *
+	 * A parent tag stands for itself and all of its children. For example, a calculation that checks a character's
+	 * proficiency in Perception only needs to return "Perception", rather than "Perception.Trained",
+	 * "Perception.Expert", etc.
+	 *
+	 * @return
+	 *	The tags that can affect the result of this calculation. This is empty if the result does not depend on tags.
+	 */
+	virtual FGameplayTagContainer GetQueriedTags() const = 0;
+};
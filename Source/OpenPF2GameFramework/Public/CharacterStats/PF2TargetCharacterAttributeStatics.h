@@ -44,6 +44,14 @@ protected:
 		{ "TmpDmgTypePrecision",           "RstPrecision"           },
 	};
 
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * Map from each transient damage attribute to the slot of the capture definition for resistance to that damage.
+	 */
+	TMap<FGameplayAttribute, int32> ResistanceSlotsByDamageAttribute;
+
 public:
 	// =================================================================================================================
 	// Public Static Methods
@@ -80,6 +88,7 @@ public:
 	 *	Either the desired capture definition; or nullptr if the character is using an ASC that does not provide a
 	 *	resistance attribute that corresponds to the specified transient damage attribute.
 	 */
+	UE_DEPRECATED(5.3, "Look up resistance captures by damage attribute or slot instead.")
 	FORCEINLINE const FGameplayEffectAttributeCaptureDefinition* GetResistanceCaptureForDamageAttribute(
 		const FString& DamageAttributeName) const
 	{
@@ -99,6 +108,36 @@ public:
 	const FGameplayEffectAttributeCaptureDefinition* GetResistanceCaptureForDamageAttribute(
 		const FName& DamageAttributeName) const;
 
+	/**
+	 * Gets the resistance attribute capture definition for the given transient damage attribute.
+	 *
+	 * @param DamageAttribute
+	 *	The transient damage attribute for which a resistance capture definition is desired.
+	 *
+	 * @return
+	 *	Either the desired capture definition; or nullptr if the character is using an ASC that does not provide a
+	 *	resistance attribute that corresponds to the specified transient damage attribute.
+	 */
+	const FGameplayEffectAttributeCaptureDefinition* GetResistanceCaptureForDamageAttribute(
+		const FGameplayAttribute& DamageAttribute) const;
+
+	/**
+	 * Gets the slot of the resistance attribute capture definition for the given transient damage attribute.
+	 *
+	 * @param DamageAttribute
+	 *	The transient damage attribute for which a resistance capture slot is desired.
+	 *
+	 * @return
+	 *	Either the slot of the desired capture definition (see GetCaptureBySlot()); or, INDEX_NONE if there is no
+	 *	resistance attribute that corresponds to the specified transient damage attribute.
+	 */
+	FORCEINLINE int32 GetResistanceSlotForDamageAttribute(const FGameplayAttribute& DamageAttribute) const
+	{
+		const int32* Slot = this->ResistanceSlotsByDamageAttribute.Find(DamageAttribute);
+
+		return (Slot == nullptr) ? INDEX_NONE : *Slot;
+	}
+
 private:
 	// =================================================================================================================
 	// Private Constructors
@@ -0,0 +1,126 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayTagContainer.h>
+
+/**
+ * The tags that represent each TEML rank of a single proficiency (e.g., "SavingThrow.Reflex.Trained",
+ * "SavingThrow.Reflex.Expert", etc.).
+ *
+ * Any tag that is not registered with the project is left empty (invalid), and never matches a character's tags.
+ */
+struct OPENPF2GAMEFRAMEWORK_API FPF2TemlRankTags
+{
+	/**
+	 * The tag that indicates the character is trained in the proficiency.
+	 */
+	FGameplayTag TrainedTag;
+
+	/**
+	 * The tag that indicates the character is an expert in the proficiency.
+	 */
+	FGameplayTag ExpertTag;
+
+	/**
+	 * The tag that indicates the character is a master of the proficiency.
+	 */
+	FGameplayTag MasterTag;
+
+	/**
+	 * The tag that indicates the character is legendary in the proficiency.
+	 */
+	FGameplayTag LegendaryTag;
+};
+
+/**
+ * Singleton index from each TEML proficiency prefix tag to the tags for each of its ranks.
+ *
+ * The index is built once, from all of the gameplay tags registered with the project, the first time that it is
+ * accessed. This allows TEML calculations to check a character's rank in a proficiency without having to build the
+ * name of each rank tag (e.g., "<prefix>.Legendary") and look it up by name on every evaluation.
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2TemlTagIndex final
+{
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * Map from each proficiency prefix tag to the tags for its ranks.
+	 */
+	TMap<FGameplayTag, FPF2TemlRankTags> RankTagsByPrefix;
+
+public:
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Gets an instance of this index.
+	 *
+	 * @return
+	 *	A reference to the TEML tag index.
+	 */
+	FORCEINLINE static const FPF2TemlTagIndex& GetInstance()
+	{
+		static FPF2TemlTagIndex TagIndex;
+
+		return TagIndex;
+	}
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the tags for each TEML rank of the proficiency that has the given prefix tag.
+	 *
+	 * If the prefix tag was not indexed (for example, because it was added to the project after the index was built),
+	 * its rank tags are looked up by name instead.
+	 *
+	 * @param TagPrefix
+	 *	The root/parent tag of tags that represent the TEML proficiency.
+	 *
+	 * @return
+	 *	The tags for each rank of the proficiency.
+	 */
+	FPF2TemlRankTags GetRankTags(const FGameplayTag TagPrefix) const;
+
+	/**
+	 * Gets the number of proficiency prefix tags in this index.
+	 *
+	 * @return
+	 *	The number of proficiencies that have at least one rank tag registered with the project.
+	 */
+	FORCEINLINE int32 GetNumPrefixes() const
+	{
+		return this->RankTagsByPrefix.Num();
+	}
+
+protected:
+	// =================================================================================================================
+	// Protected Static Methods
+	// =================================================================================================================
+	/**
+	 * Looks up the tags for each TEML rank of the proficiency that has the given prefix tag, by name.
+	 *
+	 * @param TagPrefix
+	 *	The root/parent tag of tags that represent the TEML proficiency.
+	 *
+	 * @return
+	 *	The tags for each rank of the proficiency.
+	 */
+	static FPF2TemlRankTags LookupRankTags(const FGameplayTag TagPrefix);
+
+	// =================================================================================================================
+	// Protected Constructors
+	// =================================================================================================================
+	/**
+	 * Constructor for FPF2TemlTagIndex.
+	 *
+	 * Indexes the rank tags of every proficiency registered with the project.
+	 */
+	explicit FPF2TemlTagIndex();
+};
@@ -27,6 +27,8 @@
 // =====================================================================================================================
 class IPF2AbilitySystemInterface;
 
+struct FPF2QueuedCommand;
+
 // =====================================================================================================================
 // Normal Declarations
 // =====================================================================================================================
@@ -43,6 +45,9 @@ class OPENPF2GAMEFRAMEWORK_API APF2CharacterCommand : public AInfo, public IPF2C
 {
 	GENERATED_BODY()
 
+	// Allow the command pool to initialize and recycle commands.
+	friend class UPF2CharacterCommandPoolSubsystem;
+
 protected:
 	// =================================================================================================================
 	// Protected Fields
@@ -84,6 +89,24 @@ protected:
 	UPROPERTY()
 	mutable UGameplayAbility* CachedAbility;
 
+	/**
+	 * The ID of the queued command that this command is a local copy of; or, INDEX_NONE if this command is not a copy.
+	 *
+	 * Only commands that clients create for queues that use lightweight replication have an ID.
+	 */
+	UPROPERTY()
+	int32 QueuedCommandId;
+
+	/**
+	 * The number of times this command actor has been returned to the command pool.
+	 *
+	 * Clients include this in requests that refer to this command, so that the server can tell a request about an
+	 * earlier use of this actor (e.g., a cancellation that arrives after the command was recycled for a different
+	 * character) apart from a request about its current use.
+	 */
+	UPROPERTY(Replicated)
+	int32 Generation;
+
 public:
 	// =================================================================================================================
 	// Public Static Methods
@@ -174,7 +197,9 @@ public:
 	 *
 	 * The given actor must implement IPF2CharacterInterface.
 	 *
-	 * This method is necessary because actors cannot be passed parameters through a constructor at spawn time.
+	 * This method is necessary because actors cannot be passed parameters through a constructor at spawn time. If a
+	 * previously-released command is available in the command pool of the world, it is reused instead of spawning a new
+	 * command.
 	 *
 	 * @param OwningCharacterActor
 	 *	The character (as an actor) who would be issued the command.
@@ -195,6 +220,23 @@ public:
 		const FGameplayEventData&        AbilityPayload          = FGameplayEventData(),
 		const EPF2CommandQueuePosition   QueuePositionPreference = EPF2CommandQueuePosition::EndOfQueue);
 
+	/**
+	 * Creates a local, non-replicated copy of a command that was replicated by a command queue.
+	 *
+	 * Cancelling the copy cancels the original command on the server. The copy should be released to the command pool
+	 * when it leaves the queue.
+	 *
+	 * @param OwningCharacterActor
+	 *	The character (as an actor) who would be issued the command.
+	 * @param QueuedCommand
+	 *	The replicated state of the command.
+	 *
+	 * @return
+	 *	The new command.
+	 */
+	static APF2CharacterCommand* CreateFromQueuedCommand(AActor*                  OwningCharacterActor,
+	                                                     const FPF2QueuedCommand& QueuedCommand);
+
 protected:
 	// =================================================================================================================
 	// Protected Constructors
@@ -202,7 +244,9 @@ protected:
 	explicit APF2CharacterCommand() :
 		OwningCharacterActor(nullptr),
 		QueuePositionPreference(EPF2CommandQueuePosition::EndOfQueue),
-		CachedAbility(nullptr)
+		CachedAbility(nullptr),
+		QueuedCommandId(INDEX_NONE),
+		Generation(0)
 	{
 		// Replicate commands to ensure that, when characters are controlled by AI during encounters, both the server
 		// and the client who is issuing the command can observe its details (icon, description, and callback).
@@ -241,9 +285,8 @@ public:
 	// =================================================================================================================
 	virtual FString GetIdForLogs() const override;
 
-protected:
 	// =================================================================================================================
-	// Protected Methods
+	// Public Methods
 	// =================================================================================================================
 	/**
 	 * Gets the handle of the ability that this command will trigger when it is executed.
@@ -269,6 +312,36 @@ protected:
 		return this->AbilityPayload;
 	}
 
+	/**
+	 * Gets the number of times this command actor has been returned to the command pool.
+	 *
+	 * @return
+	 *	The generation of this command.
+	 */
+	FORCEINLINE int32 GetGeneration() const
+	{
+		return this->Generation;
+	}
+
+	/**
+	 * Determines whether a request that was made for the given generation of this command refers to its current use.
+	 *
+	 * @param InGeneration
+	 *	The generation of this command that the request was made for.
+	 *
+	 * @return
+	 *	- true if the request refers to the current use of this command.
+	 *	- false if the request refers to an earlier use of this command that has since been released to the pool.
+	 */
+	FORCEINLINE bool IsCurrentGeneration(const int32 InGeneration) const
+	{
+		return (this->Generation == InGeneration);
+	}
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
 	/**
 	 * Gets the specification for the ability that this command will trigger when it is executed.
 	 *
@@ -328,6 +401,28 @@ protected:
 	                          const FGameplayEventData&        InAbilityPayload,
 	                          const EPF2CommandQueuePosition   InQueuePositionPreference);
 
+	/**
+	 * Re-initializes the state of a command that is being reused from the command pool.
+	 *
+	 * @param InOwningCharacterActor
+	 *	The character who would be issued this command.
+	 * @param InAbilitySpecHandle
+	 *	The handle of the ability that this command will trigger when it is executed.
+	 * @param InAbilityPayload
+	 *	The payload (if applicable) for the ability.
+	 * @param InQueuePositionPreference
+	 *	The preference for where in a command queue this command should be placed, if this command gets queued.
+	 */
+	void Reinitialize(AActor*                          InOwningCharacterActor,
+	                  const FGameplayAbilitySpecHandle InAbilitySpecHandle,
+	                  const FGameplayEventData&        InAbilityPayload,
+	                  const EPF2CommandQueuePosition   InQueuePositionPreference);
+
+	/**
+	 * Clears the cached state of this command and makes it dormant, as it is being returned to the command pool.
+	 */
+	void OnReleasedToPool();
+
 	/**
 	 * Attempts to cancel this command on the remote server by routing the request through the local player controller.
 	 */
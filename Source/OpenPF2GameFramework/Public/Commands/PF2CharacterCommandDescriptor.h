@@ -0,0 +1,86 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayAbilitySpec.h>
+
+#include <Abilities/GameplayAbilityTypes.h>
+
+#include "PF2CharacterCommandDescriptor.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class AActor;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * A description of a command that a player would like to issue to one of the characters they control.
+ *
+ * This is what clients send to the server to request that several commands be executed or queued at once. The server
+ * creates the command from this description, so no command actor exists until the request has been accepted.
+ */
+USTRUCT(BlueprintType)
+struct OPENPF2GAMEFRAMEWORK_API FPF2CharacterCommandDescriptor
+{
+	GENERATED_BODY()
+
+	// =================================================================================================================
+	// Public Fields
+	// =================================================================================================================
+	/**
+	 * The character to whom the command would be issued.
+	 *
+	 * This is an actor (instead of an interface) for replication. The actor must implement IPF2CharacterInterface.
+	 */
+	UPROPERTY(BlueprintReadWrite)
+	AActor* CharacterActor;
+
+	/**
+	 * The handle of the ability that the command will trigger when it is executed.
+	 */
+	UPROPERTY(BlueprintReadWrite)
+	FGameplayAbilitySpecHandle AbilitySpecHandle;
+
+	/**
+	 * The payload to provide when invoking the ability.
+	 *
+	 * Not all abilities use the payload; this is only useful for those that do.
+	 */
+	UPROPERTY(BlueprintReadWrite)
+	FGameplayEventData AbilityPayload;
+
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor.
+	 */
+	explicit FPF2CharacterCommandDescriptor() : CharacterActor(nullptr)
+	{
+	}
+
+	/**
+	 * Constructor for a command that activates the given ability on the given character.
+	 *
+	 * @param InCharacterActor
+	 *	The character to whom the command would be issued.
+	 * @param InAbilitySpecHandle
+	 *	The handle of the ability that the command will trigger when it is executed.
+	 * @param InAbilityPayload
+	 *	The payload to provide when invoking the ability.
+	 */
+	explicit FPF2CharacterCommandDescriptor(AActor*                          InCharacterActor,
+	                                        const FGameplayAbilitySpecHandle InAbilitySpecHandle,
+	                                        const FGameplayEventData&        InAbilityPayload = FGameplayEventData()) :
+		CharacterActor(InCharacterActor),
+		AbilitySpecHandle(InAbilitySpecHandle),
+		AbilityPayload(InAbilityPayload)
+	{
+	}
+};
@@ -0,0 +1,126 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayAbilitySpec.h>
+
+#include <Abilities/GameplayAbilityTypes.h>
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "Commands/PF2CommandQueuePosition.h"
+
+#include "PF2CharacterCommandPoolSubsystem.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class AActor;
+class APF2CharacterCommand;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * A world subsystem that recycles character command actors, so that issuing commands does not spawn a new actor (and
+ * eventually generate garbage) for every command.
+ *
+ * Commands that have been released to the pool are made dormant, so that they cost nothing to replicate while they are
+ * waiting to be reused. A command must not be used by the code that released it after it has been released.
+ */
+UCLASS()
+class OPENPF2GAMEFRAMEWORK_API UPF2CharacterCommandPoolSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Constants
+	// =================================================================================================================
+	/**
+	 * The maximum number of released commands that are kept for reuse.
+	 *
+	 * Commands released while the pool is full are destroyed instead.
+	 */
+	static const int32 MaxPooledCommands;
+
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The commands that have been released and are available for reuse.
+	 */
+	UPROPERTY()
+	TArray<APF2CharacterCommand*> AvailableCommands;
+
+public:
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Gets the command pool of the world that contains the given object.
+	 *
+	 * @param WorldContextObject
+	 *	An object in the world of interest.
+	 *
+	 * @return
+	 *	The command pool of the world; or, nullptr if the object is not in a world.
+	 */
+	static UPF2CharacterCommandPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// =================================================================================================================
+	// Public Methods - USubsystem Overrides
+	// =================================================================================================================
+	virtual void Deinitialize() override;
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the number of released commands that are available for reuse.
+	 *
+	 * @return
+	 *	The number of commands in the pool.
+	 */
+	FORCEINLINE int32 GetNumAvailableCommands() const
+	{
+		return this->AvailableCommands.Num();
+	}
+
+	/**
+	 * Obtains a command for the given character and ability, reusing a released command if one is available.
+	 *
+	 * This must only be called from the game thread.
+	 *
+	 * @param OwningCharacterActor
+	 *	The character (as an actor) who would be issued the command.
+	 * @param AbilitySpecHandle
+	 *	The handle of the ability that the command will trigger when it is executed.
+	 * @param AbilityPayload
+	 *	The payload to provide when invoking the ability.
+	 * @param QueuePositionPreference
+	 *	The preference for where in a command queue the command should be placed, if the command gets queued.
+	 *
+	 * @return
+	 *	The command.
+	 */
+	APF2CharacterCommand* AcquireCommand(AActor*                          OwningCharacterActor,
+	                                     const FGameplayAbilitySpecHandle AbilitySpecHandle,
+	                                     const FGameplayEventData&        AbilityPayload,
+	                                     const EPF2CommandQueuePosition   QueuePositionPreference);
+
+	/**
+	 * Returns a command that is no longer needed to the pool.
+	 *
+	 * The command must not be in any command queue. Releasing a command that is already in the pool has no effect.
+	 *
+	 * This must only be called from the game thread.
+	 *
+	 * @param Command
+	 *	The command to release.
+	 */
+	void ReleaseCommand(APF2CharacterCommand* Command);
+};
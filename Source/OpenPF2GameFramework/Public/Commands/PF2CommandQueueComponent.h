@@ -15,6 +15,7 @@
 
 #include "Commands/PF2CharacterCommandInterface.h"
 #include "Commands/PF2CommandQueueInterface.h"
+#include "Commands/PF2QueuedCommandList.h"
 
 #include "PF2CommandQueueComponent.generated.h"
 
@@ -58,10 +59,29 @@ protected:
 	 *
 	 * This is an array of actors (instead of interfaces) for replication. UE will not replicate actors if they are
 	 * declared/referenced through an interface property.
+	 *
+	 * This is only used if bUseLightweightReplication is false.
 	 */
 	UPROPERTY(ReplicatedUsing=OnRep_Queue)
 	TArray<AInfo*> Queue;
 
+	/**
+	 * The queue of commands for the owning character, when lightweight replication is enabled.
+	 *
+	 * Only the ability and payload of each command is replicated, and only for commands that have been added or
+	 * removed since the last update a client received. Clients create local copies of the commands.
+	 *
+	 * This is only used if bUseLightweightReplication is true.
+	 */
+	UPROPERTY(Replicated)
+	FPF2QueuedCommandList QueuedCommands;
+
+	/**
+	 * Whether any item in QueuedCommands has been added, removed, or changed by the update being received. (Clients
+	 * only).
+	 */
+	bool bHaveQueuedCommandsChanged;
+
 	/**
 	 * The maximum number of commands that can be in the queue at one time.
 	 *
@@ -71,6 +91,23 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="OpenPF2 - Command Queue")
 	uint8 SizeLimit;
 
+	/**
+	 * Whether to replicate the contents of this queue as a list of lightweight entries instead of as command actors.
+	 *
+	 * When this is enabled, commands in this queue are not replicated as actors. Instead, clients receive only the
+	 * commands that were added to or removed from the queue, and create a local copy of each command that was added.
+	 * This reduces the number of actors that the server has to consider for replication, which matters most when
+	 * there are many characters queuing commands at once.
+	 *
+	 * This does not eliminate command actors. Each queued command is still an actor on the server (it just does not
+	 * replicate), and every client spawns its own local command actor for each command it receives (see
+	 * APF2CharacterCommand::CreateFromQueuedCommand()). The savings are in replication overhead, not in actor count.
+	 *
+	 * Only commands of type APF2CharacterCommand can be queued when this is enabled.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="OpenPF2 - Command Queue")
+	bool bUseLightweightReplication;
+
 public:
 	// =================================================================================================================
 	// Public Constructors
@@ -83,6 +120,8 @@ public:
 	// =================================================================================================================
 	// Public Methods - AActorComponent Overrides
 	// =================================================================================================================
+	virtual void PostInitProperties() override;
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	// =================================================================================================================
@@ -116,6 +155,8 @@ public:
 
 	virtual TArray<TScriptInterface<IPF2CharacterCommandInterface>> ToArray() const override;
 
+	virtual TScriptInterface<IPF2CharacterCommandInterface> FindCommandById(const int32 CommandId) const override;
+
 	// =================================================================================================================
 	// Public Methods - IPF2ActorComponentInterface Implementation
 	// =================================================================================================================
@@ -129,7 +170,116 @@ public:
 		return Super::GetIdForLogs();
 	}
 
+	// =================================================================================================================
+	// Public Replication Callbacks
+	// =================================================================================================================
+	/**
+	 * Replication callback for a command that has been added to the "QueuedCommands" list.
+	 *
+	 * This creates a local copy of the command and notifies listeners that the command was added.
+	 *
+	 * @param QueuedCommand
+	 *	The replicated state of the command that was added.
+	 */
+	void OnRep_QueuedCommandAdded(FPF2QueuedCommand& QueuedCommand);
+
+	/**
+	 * Replication callback for a command that is about to be removed from the "QueuedCommands" list.
+	 *
+	 * This notifies listeners that the command was removed and then destroys the local copy of the command.
+	 *
+	 * @param QueuedCommand
+	 *	The replicated state of the command that is being removed.
+	 */
+	void OnRep_QueuedCommandRemoved(FPF2QueuedCommand& QueuedCommand);
+
+	/**
+	 * Replication callback for a command in the "QueuedCommands" list that has changed.
+	 *
+	 * The server only changes a command after it has been added to re-order it (i.e., to give it a new sort key), so
+	 * this ensures that listeners are notified that the contents of the queue has changed once the update is applied.
+	 *
+	 * @param QueuedCommand
+	 *	The replicated state of the command that changed.
+	 */
+	void OnRep_QueuedCommandChanged(const FPF2QueuedCommand& QueuedCommand);
+
+	/**
+	 * Replication callback for the "QueuedCommands" list, invoked after all changes in an update have been applied.
+	 *
+	 * If any command was added, removed, or re-ordered by the update, this notifies all event listeners that the
+	 * contents of the queue has changed.
+	 */
+	void OnRep_QueuedCommands();
+
 protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Gets the command at the given position in this queue.
+	 *
+	 * @param Position
+	 *	The position of the command in the queue.
+	 *
+	 * @return
+	 *	Either the command at the given position; or, nullptr if the position is out of range.
+	 */
+	AInfo* GetCommandAt(const int32 Position) const;
+
+	/**
+	 * Gets all commands in this queue, in the order that they will be executed.
+	 *
+	 * @return
+	 *	The commands in this queue.
+	 */
+	TArray<AInfo*> GetCommands() const;
+
+	/**
+	 * Determines whether the given command is in this queue.
+	 *
+	 * @param CommandActor
+	 *	The command to look for.
+	 *
+	 * @return
+	 *	- true if the command is in this queue.
+	 *	- false if the command is not in this queue.
+	 */
+	bool ContainsCommand(const AInfo* CommandActor) const;
+
+	/**
+	 * Inserts a command into this queue at the given position, without enforcing the size limit or notifying listeners.
+	 *
+	 * @param CommandActor
+	 *	The command to insert.
+	 * @param Position
+	 *	The position at which to insert the command.
+	 */
+	void InsertCommand(AInfo* CommandActor, const int32 Position);
+
+	/**
+	 * Removes the command at the given position in this queue, without notifying listeners.
+	 *
+	 * @param Position
+	 *	The position of the command to remove.
+	 *
+	 * @return
+	 *	Either the command that was removed; or, nullptr if the position is out of range.
+	 */
+	AInfo* RemoveCommandAt(const int32 Position);
+
+	/**
+	 * Removes the given command from this queue, without notifying listeners.
+	 *
+	 * @param CommandActor
+	 *	The command to remove.
+	 *
+	 * @return
+	 *	- true if the command was removed.
+	 *	- false if the command was not in this queue.
+	 */
+	bool RemoveCommand(AInfo* CommandActor);
+
 	// =================================================================================================================
 	// Protected Replication Callbacks
 	// =================================================================================================================
@@ -224,4 +224,19 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category="OpenPF2|Components|Characters|Command Queues")
 	virtual TArray<TScriptInterface<IPF2CharacterCommandInterface>> ToArray() const = 0;
+
+	/**
+	 * Finds a command in this queue by its ID.
+	 *
+	 * Commands only have IDs in queues that use lightweight replication. In such queues, clients only have local copies
+	 * of commands, so the ID is how the server and clients refer to the same command.
+	 *
+	 * @param CommandId
+	 *	The ID of the command.
+	 *
+	 * @return
+	 *	Either the command that has the given ID; or, an empty reference if there is no such command in this queue.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Components|Characters|Command Queues")
+	virtual TScriptInterface<IPF2CharacterCommandInterface> FindCommandById(const int32 CommandId) const = 0;
 };
@@ -0,0 +1,342 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayAbilitySpec.h>
+
+#include <Abilities/GameplayAbilityTypes.h>
+
+#include <Containers/RingBuffer.h>
+
+#include <GameFramework/Info.h>
+
+#include <Net/Serialization/FastArraySerializer.h>
+
+#include "Commands/PF2CommandQueuePosition.h"
+
+#include "PF2QueuedCommandList.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class APF2CharacterCommand;
+class UPF2CommandQueueComponent;
+
+struct FPF2QueuedCommandList;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * The replicated state of a single command in a command queue that uses lightweight replication.
+ *
+ * Only the details needed to reconstruct the command on a client are replicated. On the server, each item also holds
+ * the command that was enqueued; on clients, each item holds a local, non-replicated copy of the command that is
+ * created when the item is first received.
+ */
+USTRUCT()
+struct OPENPF2GAMEFRAMEWORK_API FPF2QueuedCommand : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	// =================================================================================================================
+	// Public Fields
+	// =================================================================================================================
+	/**
+	 * The ID of the command, which is unique within the queue that contains it.
+	 */
+	UPROPERTY()
+	int32 CommandId;
+
+	/**
+	 * The relative position of the command in the queue.
+	 *
+	 * Commands with lower sort keys are executed before commands with higher sort keys. Sort keys are not contiguous.
+	 */
+	UPROPERTY()
+	int32 SortKey;
+
+	/**
+	 * The handle of the ability that the command will trigger when it is executed.
+	 */
+	UPROPERTY()
+	FGameplayAbilitySpecHandle AbilitySpecHandle;
+
+	/**
+	 * The payload (if applicable) to provide when invoking the ability.
+	 */
+	UPROPERTY()
+	FGameplayEventData AbilityPayload;
+
+	/**
+	 * The preference for where in a command queue the command should be placed.
+	 */
+	UPROPERTY()
+	EPF2CommandQueuePosition QueuePositionPreference;
+
+	/**
+	 * The command that this item represents.
+	 *
+	 * On the server, this is the command that was enqueued. On clients, this is a local copy of the command.
+	 */
+	UPROPERTY(NotReplicated)
+	AInfo* Command;
+
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor.
+	 */
+	explicit FPF2QueuedCommand() :
+		CommandId(INDEX_NONE),
+		SortKey(0),
+		QueuePositionPreference(EPF2CommandQueuePosition::EndOfQueue),
+		Command(nullptr)
+	{
+	}
+
+	// =================================================================================================================
+	// Public Methods - FFastArraySerializerItem Callbacks
+	// =================================================================================================================
+	void PreReplicatedRemove(const FPF2QueuedCommandList& InArraySerializer);
+	void PostReplicatedAdd(const FPF2QueuedCommandList& InArraySerializer);
+	void PostReplicatedChange(const FPF2QueuedCommandList& InArraySerializer);
+};
+
+/**
+ * A delta-replicated list of the commands in a command queue, for use as an alternative to replicating the commands
+ * themselves.
+ *
+ * On the server, the order of commands is tracked by a ring buffer of command IDs, so that commands can be taken from
+ * or added to either end of the queue without shifting the other commands. Clients reconstruct the order from the sort
+ * key of each item.
+ */
+USTRUCT()
+struct OPENPF2GAMEFRAMEWORK_API FPF2QueuedCommandList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Constants
+	// =================================================================================================================
+	/**
+	 * The distance between the sort keys of adjacent commands when sort keys are reassigned.
+	 *
+	 * This leaves room for commands to be inserted between other commands without having to reassign every key.
+	 */
+	static const int32 SortKeySpacing;
+
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The replicated state of each command in the queue, in no particular order.
+	 */
+	UPROPERTY()
+	TArray<FPF2QueuedCommand> Items;
+
+	/**
+	 * The command queue that contains this list.
+	 *
+	 * This is the object that contains this list, so it does not need to be tracked by the garbage collector.
+	 */
+	UPF2CommandQueueComponent* OwningComponent = nullptr;
+
+	/**
+	 * The IDs of the commands in the queue, in the order that they will be executed. (Server only).
+	 */
+	TRingBuffer<int32> OrderedCommandIds;
+
+	/**
+	 * A map from the ID of each command to the position of its item in Items. (Server only).
+	 */
+	TMap<int32, int32> ItemPositionsByCommandId;
+
+	/**
+	 * A map from each command to its ID. (Server only).
+	 */
+	TMap<const AInfo*, int32> CommandIdsByCommand;
+
+	/**
+	 * The ID to assign to the next command that gets added to this list. (Server only).
+	 */
+	int32 NextCommandId = 1;
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Sets the command queue that contains this list.
+	 *
+	 * @param Component
+	 *	The command queue that owns this list.
+	 */
+	FORCEINLINE void SetOwningComponent(UPF2CommandQueueComponent* Component)
+	{
+		this->OwningComponent = Component;
+	}
+
+	/**
+	 * Gets the command queue that contains this list.
+	 *
+	 * @return
+	 *	The command queue that owns this list.
+	 */
+	FORCEINLINE UPF2CommandQueueComponent* GetOwningComponent() const
+	{
+		return this->OwningComponent;
+	}
+
+	/**
+	 * Gets the number of commands in this list.
+	 *
+	 * @return
+	 *	The number of items in this list.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return this->Items.Num();
+	}
+
+	/**
+	 * Determines whether the given command is in this list. (Server only).
+	 *
+	 * @param Command
+	 *	The command to look for.
+	 *
+	 * @return
+	 *	- true if the command is in this list.
+	 *	- false if the command is not in this list.
+	 */
+	FORCEINLINE bool Contains(const AInfo* Command) const
+	{
+		return this->CommandIdsByCommand.Contains(Command);
+	}
+
+	/**
+	 * Gets the command at the given position in the queue.
+	 *
+	 * @param Position
+	 *	The position of the command in the queue.
+	 *
+	 * @return
+	 *	Either the command at the given position; or, nullptr if the position is out of range.
+	 */
+	AInfo* GetCommandAt(const int32 Position) const;
+
+	/**
+	 * Finds the command that has the given ID.
+	 *
+	 * @param CommandId
+	 *	The ID of the command.
+	 *
+	 * @return
+	 *	Either the command that has the given ID; or, nullptr if there is no such command in this list.
+	 */
+	AInfo* FindCommandById(const int32 CommandId) const;
+
+	/**
+	 * Gets all commands in this list, in the order that they will be executed.
+	 *
+	 * @return
+	 *	The commands in this list.
+	 */
+	TArray<AInfo*> GetCommandsInOrder() const;
+
+	/**
+	 * Inserts a command into this list at the given position in the queue. (Server only).
+	 *
+	 * @param Command
+	 *	The command to insert. The command must not already be in this list.
+	 * @param Position
+	 *	The position in the queue at which to insert the command. This must be between 0 and the number of commands in
+	 *	this list (inclusive).
+	 */
+	void Insert(APF2CharacterCommand* Command, const int32 Position);
+
+	/**
+	 * Removes the command at the given position in the queue. (Server only).
+	 *
+	 * @param Position
+	 *	The position of the command in the queue.
+	 *
+	 * @return
+	 *	Either the command that was removed; or, nullptr if the position is out of range.
+	 */
+	AInfo* RemoveAt(const int32 Position);
+
+	/**
+	 * Removes the given command from this list. (Server only).
+	 *
+	 * @param Command
+	 *	The command to remove.
+	 *
+	 * @return
+	 *	- true if the command was in this list and has been removed.
+	 *	- false if the command was not in this list.
+	 */
+	bool Remove(const AInfo* Command);
+
+	/**
+	 * Removes all commands from this list. (Server only).
+	 */
+	void Reset();
+
+	// =================================================================================================================
+	// Public Methods - FFastArraySerializer Implementation
+	// =================================================================================================================
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters) const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FPF2QueuedCommand, FPF2QueuedCommandList>(this->Items, DeltaParms, *this);
+	}
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Gets the item for the command that has the given ID. (Server only).
+	 *
+	 * @param CommandId
+	 *	The ID of the command.
+	 *
+	 * @return
+	 *	The item for the command.
+	 */
+	FPF2QueuedCommand& GetItemByCommandId(const int32 CommandId);
+
+	/**
+	 * Removes the item for the command that has the given ID. (Server only).
+	 *
+	 * The caller is responsible for removing the ID of the command from OrderedCommandIds.
+	 *
+	 * @param CommandId
+	 *	The ID of the command.
+	 *
+	 * @return
+	 *	The command that was removed.
+	 */
+	AInfo* RemoveItemByCommandId(const int32 CommandId);
+
+	/**
+	 * Assigns new, evenly-spaced sort keys to all commands, in queue order. (Server only).
+	 */
+	void ReassignSortKeys();
+};
+
+template<>
+struct TStructOpsTypeTraits<FPF2QueuedCommandList> : public TStructOpsTypeTraitsBase2<FPF2QueuedCommandList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -0,0 +1,127 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Containers/ArrayView.h>
+
+#include <Math/RandomStream.h>
+
+#include "Dice/PF2DiceExpression.h"
+
+/**
+ * Rolls the same dice expression a very large number of times, for balance tuning and "what-if" previews.
+ *
+ * Unlike UPF2DiceLibrary, which rolls one die at a time from a shared stream, the batch roller owns several independent
+ * random number generators ("lanes") that are stepped together, and it generates random numbers in fixed-size blocks.
+ * All of the inner loops are simple, branch-free passes over contiguous arrays so that the compiler can auto-vectorize
+ * them.
+ *
+ * The sequence of sums produced by a batch roller is NOT the same as the sequence that UPF2DiceLibrary would produce for
+ * the same seed; only the distribution of the results is the same. Batch rollers are not thread-safe; use a separate
+ * roller on each thread.
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2BatchRoller final
+{
+public:
+	// =================================================================================================================
+	// Public Constants
+	// =================================================================================================================
+	/**
+	 * The number of independent generators that are stepped together.
+	 */
+	static constexpr int32 LaneCount = 8;
+
+	/**
+	 * The number of random numbers (and sums) produced by each pass over a block.
+	 *
+	 * This must be a multiple of LaneCount.
+	 */
+	static constexpr int32 BlockSize = 1024;
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The current state of the generator for each lane.
+	 */
+	alignas(32) uint32 LaneStates[LaneCount];
+
+public:
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Constructor for FPF2BatchRoller that seeds all lanes from the given seed.
+	 *
+	 * @param Seed
+	 *	The seed from which the seed of each lane is derived.
+	 */
+	explicit FPF2BatchRoller(const int32 Seed);
+
+	/**
+	 * Constructor for FPF2BatchRoller that seeds all lanes from the given stream.
+	 *
+	 * This allows the roller to be seeded from the stream of a world or character (see UPF2RandomSubsystem).
+	 *
+	 * @param SeedSource
+	 *	The stream from which the seed of each lane is drawn.
+	 */
+	explicit FPF2BatchRoller(FRandomStream& SeedSource);
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Fills the given buffer with sums of independent rolls of the given expression.
+	 *
+	 * @param [in] Expression
+	 *	The expression to roll. If the expression is not valid, every sum is 0.
+	 * @param [out] OutSums
+	 *	The buffer to fill. One roll of the expression is made for each element.
+	 */
+	void RollSums(const FPF2DiceExpression& Expression, TArrayView<int32> OutSums);
+
+	/**
+	 * Rolls the given expression the given number of times and counts how often each sum occurs.
+	 *
+	 * Sums are not retained, so this uses a constant amount of memory regardless of the number of rolls.
+	 *
+	 * @param [in] Expression
+	 *	The expression to roll.
+	 * @param [in] NumRolls
+	 *	The number of times to roll the expression.
+	 * @param [out] OutHistogram
+	 *	A reference to the array to receive the histogram. Element "i" receives the number of rolls that summed to
+	 *	Expression.GetMinSum() + i, so the array has one element for every sum from the minimum to the maximum sum of the
+	 *	expression. The array is empty if the expression is not valid or does not have a valid range of sums.
+	 */
+	void RollHistogram(const FPF2DiceExpression& Expression, const int64 NumRolls, TArray<int64>& OutHistogram);
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Steps every lane as many times as needed to fill a block of random numbers.
+	 *
+	 * @param [out] OutBlock
+	 *	The block to fill. Must have room for BlockSize elements.
+	 */
+	void FillRandomBlock(uint32* OutBlock);
+
+	/**
+	 * Rolls the given expression for a run of up to BlockSize consecutive sums.
+	 *
+	 * @param [in] Expression
+	 *	The expression to roll. Must be valid.
+	 * @param [out] OutSums
+	 *	The sums to fill.
+	 * @param [in] Count
+	 *	The number of sums to fill. Must be no larger than BlockSize.
+	 */
+	void RollBlock(const FPF2DiceExpression& Expression, int32* OutSums, const int32 Count);
+};
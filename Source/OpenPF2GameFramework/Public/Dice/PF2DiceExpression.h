@@ -0,0 +1,225 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Misc/ScopeRWLock.h>
+
+#include "PF2DiceExpression.generated.h"
+
+/**
+ * A dice rolling expression (e.g., "2d6" or "2d8+4") that has been parsed into its numeric components.
+ *
+ * Expressions are in "CdS[+M|-M]" format, where "C" represents the count or number of dice to roll, "S" represents the
+ * number of sides of each die (the die size), and the optional "M" represents a constant modifier to add to or subtract
+ * from the sum of the dice.
+ *
+ * Parsing an expression is comparatively expensive, so code that rolls the same expression repeatedly should obtain
+ * compiled expressions from FPF2DiceExpressionCache rather than parsing the same string on every roll.
+ */
+USTRUCT(BlueprintType)
+struct OPENPF2GAMEFRAMEWORK_API FPF2DiceExpression
+{
+	GENERATED_BODY()
+
+	// =================================================================================================================
+	// Public Constants
+	// =================================================================================================================
+	/**
+	 * The maximum number of digits allowed in any numeric component of an expression.
+	 *
+	 * This guards against overflow when a value does not fit in a signed, 32-bit integer.
+	 */
+	static constexpr int32 MaxDigitsPerComponent = 9;
+
+	// =================================================================================================================
+	// Public Fields
+	// =================================================================================================================
+	/**
+	 * The count or number of dice to roll.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 RollCount;
+
+	/**
+	 * The number of sides of each die.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 DieSize;
+
+	/**
+	 * The constant amount to add to the sum of the dice. This is negative for expressions like "1d4-1".
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Modifier;
+
+	/**
+	 * Whether the source expression could be parsed.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bIsValid;
+
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Parses the string description of a roll into a compiled expression.
+	 *
+	 * Prefer FPF2DiceExpressionCache::Get() for expressions that are rolled more than once.
+	 *
+	 * @param RollExpression
+	 *	The description of the roll, in "CdS[+M|-M]" format.
+	 *
+	 * @return
+	 *	The compiled expression. If the expression could not be parsed, the result is not valid and all of its numeric
+	 *	components are zero.
+	 */
+	static FPF2DiceExpression Parse(const FString& RollExpression);
+
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for FPF2DiceExpression.
+	 *
+	 * The resulting expression is not valid.
+	 */
+	explicit FPF2DiceExpression() : RollCount(0), DieSize(0), Modifier(0), bIsValid(false)
+	{
+	}
+
+	/**
+	 * Constructor for FPF2DiceExpression.
+	 *
+	 * @param RollCount
+	 *	The count or number of dice to roll.
+	 * @param DieSize
+	 *	The number of sides of each die.
+	 * @param Modifier
+	 *	The constant amount to add to the sum of the dice.
+	 */
+	explicit FPF2DiceExpression(const int32 RollCount, const int32 DieSize, const int32 Modifier = 0) :
+		RollCount(RollCount),
+		DieSize(DieSize),
+		Modifier(Modifier),
+		bIsValid(true)
+	{
+	}
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Determines whether this expression has a non-zero constant modifier.
+	 *
+	 * @return
+	 *	true if the expression adds or subtracts a constant from the sum of the dice; or, false otherwise.
+	 */
+	FORCEINLINE bool HasModifier() const
+	{
+		return (this->Modifier != 0);
+	}
+
+	/**
+	 * Gets the smallest sum that rolling this expression can produce.
+	 *
+	 * @return
+	 *	The minimum sum, including the modifier.
+	 */
+	FORCEINLINE int32 GetMinSum() const
+	{
+		return ((this->DieSize == 0) ? 0 : this->RollCount) + this->Modifier;
+	}
+
+	/**
+	 * Gets the largest sum that rolling this expression can produce.
+	 *
+	 * @return
+	 *	The maximum sum, including the modifier.
+	 */
+	FORCEINLINE int32 GetMaxSum() const
+	{
+		return (this->RollCount * this->DieSize) + this->Modifier;
+	}
+
+	/**
+	 * Gets the average sum that rolling this expression produces.
+	 *
+	 * @return
+	 *	The expected value of the sum, including the modifier; or, 0.0 if this expression is not valid.
+	 */
+	FORCEINLINE float GetExpectedSum() const
+	{
+		float Result;
+
+		if (!this->bIsValid)
+		{
+			Result = 0.0f;
+		}
+		else if (this->DieSize == 0)
+		{
+			// A zero-sided die always rolls 0 (see UPF2DiceLibrary::Roll()).
+			Result = static_cast<float>(this->Modifier);
+		}
+		else
+		{
+			// Each die averages to the midpoint of its faces: (1 + DieSize) / 2.
+			Result = (this->RollCount * (this->DieSize + 1) / 2.0f) + this->Modifier;
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Converts this expression back into its canonical string form (e.g., "2d8+4").
+	 *
+	 * @return
+	 *	The canonical string form of this expression, or "0d0" if this expression is not valid.
+	 */
+	FString ToString() const;
+};
+
+/**
+ * A process-wide, thread-safe cache of compiled dice expressions, keyed by the name of each expression.
+ *
+ * Each distinct expression is parsed only once; subsequent lookups of the same expression (including expressions that
+ * could not be parsed) are served from the cache.
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2DiceExpressionCache
+{
+protected:
+	// =================================================================================================================
+	// Protected Static Fields
+	// =================================================================================================================
+	/**
+	 * Lock that guards access to the cache.
+	 */
+	static FRWLock CacheLock;
+
+	/**
+	 * Map of roll expression names to compiled expressions.
+	 */
+	static TMap<FName, FPF2DiceExpression> CompiledExpressions;
+
+public:
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Gets the compiled form of the given roll expression, parsing and caching it if this is the first request for it.
+	 *
+	 * @param RollExpression
+	 *	The description of the roll, in "CdS[+M|-M]" format.
+	 *
+	 * @return
+	 *	The compiled expression.
+	 */
+	static FPF2DiceExpression Get(const FName RollExpression);
+
+	/**
+	 * Removes all compiled expressions from the cache.
+	 */
+	static void Reset();
+};
@@ -0,0 +1,255 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Engine/EngineBaseTypes.h>
+
+#include <Math/RandomStream.h>
+
+#include <Misc/ScopeRWLock.h>
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "PF2RandomSubsystem.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class AActor;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * A world subsystem that owns the random number generators (RNGs) used for dice rolls in a single world.
+ *
+ * Each world has its own seedable stream, so that PIE instances and server worlds running in the same process do not
+ * share (or perturb) each other's rolls. While a world is ticking, its stream is the active source of rolls for
+ * UPF2DiceLibrary (and, by extension, UPF2AttackStatLibrary) on the game thread.
+ *
+ * In addition to the world stream, this subsystem can provide:
+ *	- A stream for each worker (e.g., each task of a parallel loop), so that rolls can be evaluated on worker threads
+ *	  without locking.
+ *	- A stream for each character, so that the sequence of rolls for one character is not affected by how many rolls
+ *	  other characters make.
+ *
+ * All child streams are derived deterministically from the seed of the world stream, so seeding the world (e.g., via
+ * the "-PF2RandomSeed=" command-line switch) makes all of its rolls reproducible.
+ *
+ * To roll from a worker or character stream, bind it with FPF2ScopedRandomStream for the duration of the rolls.
+ */
+UCLASS()
+class OPENPF2GAMEFRAMEWORK_API UPF2RandomSubsystem final : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The stream for rolls made by the game thread for this world.
+	 */
+	FRandomStream WorldStream;
+
+	/**
+	 * Streams for each character that has requested one, keyed by the name of the character actor.
+	 *
+	 * Character streams are keyed by name rather than by pointer so that the seed of each character stream is stable
+	 * across runs of the same map. Streams are heap-allocated so that references to them remain valid as the map grows.
+	 */
+	TMap<FName, TUniquePtr<FRandomStream>> CharacterStreams;
+
+	/**
+	 * Lock that guards access to the character streams.
+	 */
+	mutable FRWLock CharacterStreamsLock;
+
+	/**
+	 * Streams for each worker that has requested one, keyed by the index of the worker.
+	 *
+	 * Worker streams are keyed by an index that the caller controls (rather than by thread) so that the seed of each
+	 * worker stream does not depend on which thread happens to perform the work. Streams are heap-allocated so that
+	 * references to them remain valid as the map grows.
+	 */
+	TMap<int32, TUniquePtr<FRandomStream>> WorkerStreams;
+
+	/**
+	 * Lock that guards access to the worker streams.
+	 */
+	mutable FRWLock WorkerStreamsLock;
+
+	/**
+	 * The stream that was active on the game thread before this world started ticking.
+	 */
+	FRandomStream* PreviousActiveStream;
+
+	/**
+	 * Handle for the callback that binds the world stream when this world starts ticking.
+	 */
+	FDelegateHandle WorldTickStartHandle;
+
+	/**
+	 * Handle for the callback that unbinds the world stream when this world finishes ticking.
+	 */
+	FDelegateHandle WorldTickEndHandle;
+
+public:
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Gets the random subsystem of the world that contains the given object.
+	 *
+	 * @param WorldContextObject
+	 *	An object in the world of interest.
+	 *
+	 * @return
+	 *	The random subsystem of the world; or, nullptr if the object is not in a world.
+	 */
+	static UPF2RandomSubsystem* Get(const UObject* WorldContextObject);
+
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for UPF2RandomSubsystem.
+	 */
+	explicit UPF2RandomSubsystem() : PreviousActiveStream(nullptr)
+	{
+	}
+
+	// =================================================================================================================
+	// Public Methods - USubsystem Overrides
+	// =================================================================================================================
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the initial seed of the stream for this world.
+	 *
+	 * @return
+	 *	The seed from which all streams of this world are derived.
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Dice")
+	int32 GetRandomSeed() const;
+
+	/**
+	 * Re-seeds the stream for this world, and discards all worker and character streams derived from the old seed.
+	 *
+	 * This must only be called from the game thread.
+	 *
+	 * @param Seed
+	 *	The new seed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Dice")
+	void SetRandomSeed(const int32 Seed);
+
+	/**
+	 * Gets the stream for rolls made by the game thread for this world.
+	 *
+	 * This must only be used from the game thread.
+	 *
+	 * @return
+	 *	The world stream.
+	 */
+	FORCEINLINE FRandomStream& GetWorldStream()
+	{
+		check(IsInGameThread());
+
+		return this->WorldStream;
+	}
+
+	/**
+	 * Gets the stream of this world for the given worker.
+	 *
+	 * The stream is created on first use. The seed of the stream depends only on the seed of this world and the index
+	 * of the worker, so parallel work that uses a stable index for each unit of work (e.g., the index of a task in a
+	 * ParallelFor) produces the same rolls regardless of which thread performs it. A worker stream must not be used by
+	 * more than one thread at a time.
+	 *
+	 * @param WorkerIndex
+	 *	The index of the worker for which a stream is desired.
+	 *
+	 * @return
+	 *	The stream for the worker.
+	 */
+	FRandomStream& GetWorkerStream(const int32 WorkerIndex);
+
+	/**
+	 * Gets the stream of this world for the given character.
+	 *
+	 * The stream is created on first use. A character stream must not be used by more than one thread at a time.
+	 *
+	 * @param Character
+	 *	The character for which a stream is desired.
+	 *
+	 * @return
+	 *	The stream for the character.
+	 */
+	FRandomStream& GetCharacterStream(const AActor* Character);
+
+	/**
+	 * Creates a new stream that is derived deterministically from the seed of this world and the given key.
+	 *
+	 * This is safe to call from any thread. Since the caller owns the result, it can be used for parallel work that
+	 * needs to be reproducible regardless of which thread performs it (e.g., by using a task index as the key).
+	 *
+	 * @param StreamKey
+	 *	A value that distinguishes this stream from other streams of this world.
+	 *
+	 * @return
+	 *	The new stream.
+	 */
+	FRandomStream CreateChildStream(const uint32 StreamKey) const;
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Callback invoked when any world starts ticking.
+	 *
+	 * If the world is the world of this subsystem, the world stream becomes the active stream for dice rolls.
+	 *
+	 * @param TickingWorld
+	 *	The world that is starting to tick.
+	 * @param TickType
+	 *	The type of tick.
+	 * @param DeltaSeconds
+	 *	The time since the last tick.
+	 */
+	void OnWorldTickStart(UWorld* TickingWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * Callback invoked when any world finishes ticking.
+	 *
+	 * If the world is the world of this subsystem, the stream that was active before it started ticking becomes active
+	 * again.
+	 *
+	 * @param TickingWorld
+	 *	The world that has finished ticking.
+	 * @param TickType
+	 *	The type of tick.
+	 * @param DeltaSeconds
+	 *	The time since the last tick.
+	 */
+	void OnWorldTickEnd(UWorld* TickingWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * Derives the seed of a child stream from the seed of this world and the given key.
+	 *
+	 * @param StreamKey
+	 *	A value that distinguishes the child stream from other streams of this world.
+	 *
+	 * @return
+	 *	The seed for the child stream.
+	 */
+	int32 DeriveChildSeed(const uint32 StreamKey) const;
+};
@@ -0,0 +1,58 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Math/RandomStream.h>
+
+#include "Libraries/PF2DiceLibrary.h"
+
+/**
+ * RAII helper that makes a random stream the source of all dice rolls on the current thread until it goes out of scope.
+ *
+ * Scopes may be nested; when a scope ends, the stream that was active before it began becomes active again. Each thread
+ * tracks its active stream separately, so worker threads can each bind their own stream without any locking.
+ *
+ * For example, to roll from the stream of a specific character:
+ * @code
+ * {
+ *	FPF2ScopedRandomStream RngScope(RandomSubsystem->GetCharacterStream(Character));
+ *
+ *	UPF2AttackStatLibrary::CalculateAttackRoll(...);
+ * }
+ * @endcode
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2ScopedRandomStream final
+{
+protected:
+	/**
+	 * The stream that was active on this thread before this scope began.
+	 */
+	FRandomStream* PreviousStream;
+
+public:
+	/**
+	 * Constructor for FPF2ScopedRandomStream.
+	 *
+	 * @param Stream
+	 *	The stream to use for dice rolls made on this thread until this object is destroyed. The stream must outlive
+	 *	this object.
+	 */
+	explicit FPF2ScopedRandomStream(FRandomStream& Stream) :
+		PreviousStream(UPF2DiceLibrary::SetActiveRandomStream(&Stream))
+	{
+	}
+
+	/**
+	 * Destructor for FPF2ScopedRandomStream.
+	 */
+	~FPF2ScopedRandomStream()
+	{
+		UPF2DiceLibrary::SetActiveRandomStream(this->PreviousStream);
+	}
+
+	FPF2ScopedRandomStream(const FPF2ScopedRandomStream&)            = delete;
+	FPF2ScopedRandomStream& operator=(const FPF2ScopedRandomStream&) = delete;
+};
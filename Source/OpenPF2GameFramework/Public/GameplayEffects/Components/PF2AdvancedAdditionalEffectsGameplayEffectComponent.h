@@ -69,6 +69,17 @@ public:
 	// =================================================================================================================
 	// Public Methods
 	// =================================================================================================================
+	/**
+	 * Gets the Gameplay Effects (GE) to consider for application to a target when the owning GE gets applied.
+	 *
+	 * @return
+	 *	The conditional GEs of this component.
+	 */
+	FORCEINLINE const TArray<FPF2ConditionalGameplayEffect>& GetOnApplicationGameplayEffects() const
+	{
+		return this->OnApplicationGameplayEffects;
+	}
+
 #if WITH_EDITOR
 	/**
 	 * Validates that the configuration of this component is compatible with its duration policy.
@@ -154,6 +154,16 @@ public:
 		return this->EffectClass;
 	}
 
+	/**
+	 * Gets all of the tags that the requirements of this conditional GE check for on the source or target.
+	 *
+	 * This includes required tags, ignored tags, and every tag that either tag query refers to.
+	 *
+	 * @return
+	 *	The tags that can affect whether the conditional GE is applied.
+	 */
+	FGameplayTagContainer GetQueriedTags() const;
+
 	/**
 	 * Checks whether tags on the source and target meet all requirements, enabling the conditional GE to be applied.
 	 *
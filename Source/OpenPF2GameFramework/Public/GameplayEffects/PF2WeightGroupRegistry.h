@@ -0,0 +1,170 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayEffect.h>
+
+#include <Misc/ScopeRWLock.h>
+
+#include <UObject/ObjectKey.h>
+
+/**
+ * Singleton registry that resolves passive GE weight groups to integer priorities.
+ *
+ * Weight groups are ordered by name (e.g., "GameplayEffect.WeightGroup.00_InitializeBaseStats" is applied before
+ * "GameplayEffect.WeightGroup.05_PostInitializeBaseStats"). Comparing names lexically on every sort and lookup is
+ * comparatively expensive, so the registry assigns each weight group tag registered with the project an integer
+ * priority, once, that sorts in the same order as the name of the group.
+ *
+ * The registry also caches the weight group of each GE class, so that the asset tags of a GE are only filtered the
+ * first time that its weight group is requested.
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2WeightGroupRegistry final
+{
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * Map from the name of each weight group registered with the project to its priority.
+	 *
+	 * This is not modified after the registry has been constructed, so it can be read without a lock.
+	 */
+	TMap<FName, int32> PrioritiesByWeightGroup;
+
+	/**
+	 * Lock that guards access to the cache of weight groups by GE class.
+	 */
+	FRWLock EffectCacheLock;
+
+	/**
+	 * Map from each GE class to the weight group assigned to it by its asset tags.
+	 *
+	 * GEs that do not have a weight group tag are mapped to NAME_None.
+	 */
+	TMap<FObjectKey, FName> WeightGroupsByEffect;
+
+public:
+	// =================================================================================================================
+	// Public Static Methods
+	// =================================================================================================================
+	/**
+	 * Gets an instance of this registry.
+	 *
+	 * @return
+	 *	A reference to the weight group registry.
+	 */
+	FORCEINLINE static FPF2WeightGroupRegistry& GetInstance()
+	{
+		static FPF2WeightGroupRegistry Registry;
+
+		return Registry;
+	}
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the priority of the given weight group.
+	 *
+	 * @param WeightGroup
+	 *	The name of the weight group.
+	 *
+	 * @return
+	 *	The priority of the weight group, which is lower for groups that are applied earlier; or, INDEX_NONE if the
+	 *	weight group is not a tag that has been registered with the project.
+	 */
+	FORCEINLINE int32 GetPriority(const FName WeightGroup) const
+	{
+		const int32* Priority = this->PrioritiesByWeightGroup.Find(WeightGroup);
+
+		return (Priority == nullptr) ? INDEX_NONE : *Priority;
+	}
+
+	/**
+	 * Determines whether GEs in one weight group are applied before GEs in another.
+	 *
+	 * This gives the same result as FName::LexicalLess(), but avoids comparing the names of weight groups that are
+	 * registered with the project.
+	 *
+	 * @param WeightGroup
+	 *	The name of the weight group being compared.
+	 * @param OtherWeightGroup
+	 *	The name of the weight group to which the first weight group is being compared.
+	 *
+	 * @return
+	 *	true if WeightGroup is applied before OtherWeightGroup; or, false, otherwise.
+	 */
+	FORCEINLINE bool IsBefore(const FName WeightGroup, const FName OtherWeightGroup) const
+	{
+		const int32 Priority      = this->GetPriority(WeightGroup),
+		            OtherPriority = this->GetPriority(OtherWeightGroup);
+
+		bool Result;
+
+		if ((Priority == INDEX_NONE) || (OtherPriority == INDEX_NONE))
+		{
+			Result = WeightGroup.LexicalLess(OtherWeightGroup);
+		}
+		else
+		{
+			Result = (Priority < OtherPriority);
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Gets the name of the weight group into which the given GE should be placed.
+	 *
+	 * The weight group of each GE is resolved from its asset tags only once, and then cached.
+	 *
+	 * @param GameplayEffect
+	 *	The effect for which a weight group is desired.
+	 * @param DefaultWeight
+	 *	The weight to return if the gameplay effect does not indicate its weight with a tag.
+	 *
+	 * @return
+	 *	The name of the weight group for the effect.
+	 */
+	FName GetWeightGroupOfGameplayEffect(const TSubclassOf<UGameplayEffect> GameplayEffect, const FName DefaultWeight);
+
+	/**
+	 * Gets the number of weight groups in this registry.
+	 *
+	 * @return
+	 *	The number of weight group tags that have been registered with the project.
+	 */
+	FORCEINLINE int32 GetNumWeightGroups() const
+	{
+		return this->PrioritiesByWeightGroup.Num();
+	}
+
+protected:
+	// =================================================================================================================
+	// Protected Static Methods
+	// =================================================================================================================
+	/**
+	 * Determines the weight group of the given GE from its asset tags.
+	 *
+	 * @param GameplayEffect
+	 *	The effect for which a weight group is desired.
+	 *
+	 * @return
+	 *	The name of the weight group for the effect; or, NAME_None if the effect does not have a weight group tag.
+	 */
+	static FName LookupWeightGroupOfGameplayEffect(const TSubclassOf<UGameplayEffect> GameplayEffect);
+
+	// =================================================================================================================
+	// Protected Constructors
+	// =================================================================================================================
+	/**
+	 * Constructor for FPF2WeightGroupRegistry.
+	 *
+	 * Assigns a priority to every weight group tag registered with the project.
+	 */
+	explicit FPF2WeightGroupRegistry();
+};
@@ -17,10 +17,9 @@
 #include "Actors/Components/PF2ActorComponentBase.h"
 
 #include "Items/PF2InventoryInterface.h"
+#include "Items/PF2InventoryItemList.h"
 #include "Items/PF2ItemInterface.h"
 
-#include "Utilities/PF2ArrayUtilities.h"
-
 #include "PF2InventoryComponent.generated.h"
 
 // =====================================================================================================================
@@ -48,23 +47,30 @@ protected:
 	UPROPERTY(Transient)
 	mutable UPF2InventoryInterfaceEvents* Events;
 
+	/**
+	 * The items this character currently has in their inventory.
+	 *
+	 * Only the asset ID of each item is replicated. Clients load the asset of each item as it arrives.
+	 */
+	UPROPERTY(Replicated)
+	FPF2InventoryItemList InventoryItems;
+
 private:
 	// =================================================================================================================
 	// Private Fields
 	// =================================================================================================================
 	/**
-	 * The IDs of items this character currently has in their inventory.
+	 * The replication IDs of inventory entries that have arrived on this client but have not yet been loaded.
+	 *
+	 * Loads are deferred until the end of each replication update, so that all of the items that arrive in the same
+	 * update are loaded together.
 	 */
-	UPROPERTY(ReplicatedUsing=OnRep_InventoryItemIds)
-	TArray<FPrimaryAssetId> InventoryItemIds;
+	TSet<int32> PendingItemLoads;
 
 	/**
-	 * The locally cached, loaded copy of items this character currently has in their inventory.
-	 *
-	 * This is not replicated. It gets repopulated when the InventoryItems field replicates.
+	 * Whether items have been removed from inventory during the current replication update.
 	 */
-	UPROPERTY()
-	TArray<IPF2ItemInterface*> InventoryItemsLoaded;
+	bool bHaveItemsBeenRemoved;
 
 public:
 	// =================================================================================================================
@@ -75,6 +81,11 @@ public:
 	 */
 	explicit UPF2InventoryComponent();
 
+	// =================================================================================================================
+	// Public Methods - UObject Overrides
+	// =================================================================================================================
+	virtual void PostInitProperties() override;
+
 	// =================================================================================================================
 	// Public Methods - UActorComponent Overrides
 	// =================================================================================================================
@@ -107,58 +118,57 @@ public:
 		return Super::GetIdForLogs();
 	}
 
-protected:
 	// =================================================================================================================
-	// Protected Methods
+	// Public Replication Callbacks
 	// =================================================================================================================
-	static UAssetManager* GetAssetManager();
-
 	/**
-	 * Loads multiple inventory item assets by their IDs, then invokes a lambda with the result.
+	 * Replication callback for an item that has been added to the "InventoryItems" list.
 	 *
-	 * @param ItemAssetIds
-	 *	The IDs of the inventory assets to load.
-	 * @param CompletionCallback
-	 *	Callback lambda to invoke once the items have loaded.
-	 * @param BundlesToLoad
-	 *	An optional restriction on the bundle of assets from which to load the items.
+	 * This schedules the asset of the item to be loaded at the end of the current replication update.
+	 *
+	 * @param Entry
+	 *	The replicated state of the item that was added.
 	 */
-	template<typename FunctorType>
-	void LoadItemsById(const TArray<FPrimaryAssetId>& ItemAssetIds,
-	                   const FunctorType              CompletionCallback,
-	                   const TArray<FName>&           BundlesToLoad = TArray<FName>())
-	{
-		FStreamableDelegate CompletionDelegate;
-
-		CompletionDelegate.BindLambda([this, ItemAssetIds, CompletionCallback]()
-		{
-			const UAssetManager* AssetManager = GetAssetManager();
+	void OnRep_InventoryItemAdded(FPF2InventoryItemEntry& Entry);
 
-			check(AssetManager != nullptr);
-
-			TArray<IPF2ItemInterface*> LoadedItems = PF2ArrayUtilities::ReduceToArray<IPF2ItemInterface*>(
-				ItemAssetIds,
-				[AssetManager](TArray<IPF2ItemInterface*> ResultArray, const FPrimaryAssetId& LoadedAssetId)
-				{
-					UObject*           AssetObject = AssetManager->GetPrimaryAssetObject(LoadedAssetId);
-					IPF2ItemInterface* Item        = Cast<IPF2ItemInterface>(AssetObject);
+	/**
+	 * Replication callback for an item in the "InventoryItems" list that has been replaced by a different item.
+	 *
+	 * This notifies listeners that the old item was removed, then schedules the asset of the new item to be loaded.
+	 *
+	 * @param Entry
+	 *	The replicated state of the item that changed.
+	 */
+	void OnRep_InventoryItemChanged(FPF2InventoryItemEntry& Entry);
 
-					if (Item != nullptr)
-					{
-						ResultArray.Add(Item);
-					}
-				}
-			);
+	/**
+	 * Replication callback for an item that is about to be removed from the "InventoryItems" list.
+	 *
+	 * This notifies listeners that the item was removed.
+	 *
+	 * @param Entry
+	 *	The replicated state of the item that is being removed.
+	 */
+	void OnRep_InventoryItemRemoved(FPF2InventoryItemEntry& Entry);
 
-			CompletionCallback(LoadedItems);
-		});
+	/**
+	 * Replication callback for the "InventoryItems" list, invoked after all changes in an update have been applied.
+	 *
+	 * This loads the assets of all items that arrived during the update, and notifies listeners if items were removed.
+	 */
+	void OnRep_InventoryItems();
 
-		LoadItemsById(ItemAssetIds, CompletionDelegate, BundlesToLoad);
-	}
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	static UAssetManager* GetAssetManager();
 
 	/**
 	 * Loads multiple inventory item assets by their IDs, then invokes a completion delegate with the result.
 	 *
+	 * By default, items are loaded through the asset manager.
+	 *
 	 * @param ItemAssetIds
 	 *	The IDs of the inventory assets to load.
 	 * @param CompletionDelegate
@@ -166,18 +176,22 @@ protected:
 	 * @param BundlesToLoad
 	 *	An optional restriction on the bundle of assets from which to load the items.
 	 */
-	static void LoadItemsById(const TArray<FPrimaryAssetId>& ItemAssetIds,
-	                          const FStreamableDelegate&     CompletionDelegate,
-	                          const TArray<FName>&           BundlesToLoad = TArray<FName>());
+	virtual void LoadItemsById(const TArray<FPrimaryAssetId>& ItemAssetIds,
+	                           const FStreamableDelegate&     CompletionDelegate,
+	                           const TArray<FName>&           BundlesToLoad = TArray<FName>());
 
-	// =================================================================================================================
-	// Protected Replication Callbacks
-	// =================================================================================================================
 	/**
-	 * Notifies this component that the contents of inventory have been replicated.
+	 * Gets an inventory item that has been loaded by LoadItemsById().
+	 *
+	 * By default, items are looked up through the asset manager.
+	 *
+	 * @param ItemAssetId
+	 *	The ID of the inventory asset.
+	 *
+	 * @return
+	 *	The item; or, an empty interface if the asset of the item has not been loaded or is not an item.
 	 */
-	UFUNCTION()
-	void OnRep_InventoryItemIds();
+	virtual TScriptInterface<IPF2ItemInterface> GetLoadedItemById(const FPrimaryAssetId& ItemAssetId) const;
 
 	// =================================================================================================================
 	// Protected Native Event Notifications
@@ -185,14 +199,13 @@ protected:
 	/**
 	 * Callback invoked when inventory items have been loaded asynchronously by the asset manager.
 	 *
-	 * If replication is enabled for this component, this is invoked on both the owning client and the server.
-	 *
-	 * This dispatches appropriate inventory change, add, and remove callbacks.
+	 * This is only invoked on clients. It dispatches item added and inventory change callbacks for each item that is
+	 * still in inventory.
 	 *
-	 * @param NewInventory
-	 *	The items that were loaded.
+	 * @param ReplicationIds
+	 *	The replication IDs of the inventory entries for the items that were loaded.
 	 */
-	void Native_OnInventoryItemsLoaded(const TArray<IPF2ItemInterface*>& NewInventory);
+	void Native_OnInventoryItemsLoaded(const TSet<int32> ReplicationIds);
 
 	/**
 	 * Callback invoked when inventory contents have changed (items added or removed, or inventory cleared).
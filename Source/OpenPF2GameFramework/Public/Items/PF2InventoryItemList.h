@@ -0,0 +1,217 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Net/Serialization/FastArraySerializer.h>
+
+#include <UObject/PrimaryAssetId.h>
+
+#include "Items/PF2ItemInterface.h"
+
+#include "PF2InventoryItemList.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class UPF2InventoryComponent;
+
+struct FPF2InventoryItemList;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * The replicated state of a single item in an inventory.
+ *
+ * Only the ID of the item asset is replicated. On the server, each entry also holds the item that was added; on
+ * clients, each entry holds the item once its asset has been loaded by the asset manager.
+ */
+USTRUCT()
+struct OPENPF2GAMEFRAMEWORK_API FPF2InventoryItemEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	// =================================================================================================================
+	// Public Fields
+	// =================================================================================================================
+	/**
+	 * The ID of the primary asset of the item.
+	 */
+	UPROPERTY()
+	FPrimaryAssetId ItemId;
+
+	/**
+	 * The item that this entry represents.
+	 *
+	 * On clients, this is empty until the asset of the item has finished loading.
+	 */
+	UPROPERTY(NotReplicated)
+	TScriptInterface<IPF2ItemInterface> Item;
+
+	// =================================================================================================================
+	// Public Methods - FFastArraySerializerItem Callbacks
+	// =================================================================================================================
+	void PreReplicatedRemove(const FPF2InventoryItemList& InArraySerializer);
+	void PostReplicatedAdd(const FPF2InventoryItemList& InArraySerializer);
+	void PostReplicatedChange(const FPF2InventoryItemList& InArraySerializer);
+};
+
+/**
+ * A delta-replicated list of the items in an inventory.
+ *
+ * Only the entries that were added, changed, or removed since the last update are sent to clients, so a change to one
+ * item in a large inventory does not require clients to re-examine (or reload) every other item.
+ */
+USTRUCT()
+struct OPENPF2GAMEFRAMEWORK_API FPF2InventoryItemList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The replicated state of each item in the inventory, in no particular order.
+	 */
+	UPROPERTY()
+	TArray<FPF2InventoryItemEntry> Items;
+
+	/**
+	 * The inventory component that contains this list.
+	 *
+	 * This is the object that contains this list, so it does not need to be tracked by the garbage collector.
+	 */
+	UPF2InventoryComponent* OwningComponent = nullptr;
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Sets the inventory component that contains this list.
+	 *
+	 * @param Component
+	 *	The inventory component that owns this list.
+	 */
+	FORCEINLINE void SetOwningComponent(UPF2InventoryComponent* Component)
+	{
+		this->OwningComponent = Component;
+	}
+
+	/**
+	 * Gets the inventory component that contains this list.
+	 *
+	 * @return
+	 *	The inventory component that owns this list.
+	 */
+	FORCEINLINE UPF2InventoryComponent* GetOwningComponent() const
+	{
+		return this->OwningComponent;
+	}
+
+	/**
+	 * Gets the number of items in this list, including items that have not yet been loaded.
+	 *
+	 * @return
+	 *	The number of entries in this list.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return this->Items.Num();
+	}
+
+	/**
+	 * Determines whether an item having the given asset ID is in this list.
+	 *
+	 * @param ItemId
+	 *	The ID of the primary asset of the item.
+	 *
+	 * @return
+	 *	- true if the item is in this list.
+	 *	- false if the item is not in this list.
+	 */
+	bool Contains(const FPrimaryAssetId& ItemId) const;
+
+	/**
+	 * Gets the asset IDs of all items in this list.
+	 *
+	 * @return
+	 *	The IDs of the items in this list, in no particular order.
+	 */
+	TArray<FPrimaryAssetId> GetItemIds() const;
+
+	/**
+	 * Gets all items in this list that have been loaded.
+	 *
+	 * @return
+	 *	The items in this list, in no particular order.
+	 */
+	TArray<TScriptInterface<IPF2ItemInterface>> GetLoadedItems() const;
+
+	/**
+	 * Finds the entries that have the given replication IDs.
+	 *
+	 * The entries that are returned are only valid until this list is next modified or replicated.
+	 *
+	 * @param ReplicationIds
+	 *	The replication IDs of the entries of interest.
+	 *
+	 * @return
+	 *	The entries that are still in this list. Entries that have since been removed are omitted.
+	 */
+	TArray<FPF2InventoryItemEntry*> FindItemsByReplicationId(const TSet<int32>& ReplicationIds);
+
+	/**
+	 * Adds an item to this list. (Server only).
+	 *
+	 * @param ItemId
+	 *	The ID of the primary asset of the item.
+	 * @param Item
+	 *	The item to add.
+	 *
+	 * @return
+	 *	- true if the item was added.
+	 *	- false if an item having the same asset ID was already in this list.
+	 */
+	bool Add(const FPrimaryAssetId& ItemId, const TScriptInterface<IPF2ItemInterface>& Item);
+
+	/**
+	 * Removes the item having the given asset ID from this list. (Server only).
+	 *
+	 * @param ItemId
+	 *	The ID of the primary asset of the item.
+	 *
+	 * @return
+	 *	- true if the item was in this list and has been removed.
+	 *	- false if the item was not in this list.
+	 */
+	bool Remove(const FPrimaryAssetId& ItemId);
+
+	/**
+	 * Removes all items from this list. (Server only).
+	 */
+	void Reset();
+
+	// =================================================================================================================
+	// Public Methods - FFastArraySerializer Implementation
+	// =================================================================================================================
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters) const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FPF2InventoryItemEntry, FPF2InventoryItemList>(this->Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FPF2InventoryItemList> : public TStructOpsTypeTraitsBase2<FPF2InventoryItemList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -276,6 +276,46 @@ public:
 		AActor*                            EffectCauser,
 		const float                        Level = 1.0f);
 
+	/**
+	 * Adds the given damage types to the dynamic asset tags of the specified gameplay effect (GE) spec.
+	 *
+	 * The damage types on a damage GE spec form a sparse mask that UPF2ApplyDamageFromSourceExecution uses to evaluate
+	 * only the damage (and resistance) attributes for the types of damage that the source can actually inflict. If no
+	 * damage types are added to a spec, the execution falls back to evaluating every type of damage.
+	 *
+	 * Only add damage types to a spec when every type of damage that the source could inflict is known, since damage of
+	 * any type that is not added is ignored. For this reason, specs from MakeGameplayEffectSpecForWeaponAttack() are not
+	 * flagged with the damage type of the weapon; other GEs on the attacker can contribute damage of other types.
+	 *
+	 * @param GameplayEffectSpec
+	 *	The handle of the damage GE spec to which damage types are being added.
+	 * @param DamageTypes
+	 *	The tags of the damage types that the GE inflicts (e.g., "DamageType.Energy.Fire").
+	 *
+	 * @return
+	 *	The same GE spec handle that was provided, to allow calls to be chained.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Gameplay Effects")
+	static FGameplayEffectSpecHandle AddDamageTypesToGameplayEffectSpec(
+		const FGameplayEffectSpecHandle& GameplayEffectSpec,
+		const FGameplayTagContainer&     DamageTypes);
+
+	/**
+	 * Gets the damage of each type that was inflicted on a target from the parameters of an "inflict damage" cue.
+	 *
+	 * This works both for cues that carry the damage of a single type and for cues that carry the damage of several
+	 * types at once (see UPF2ApplyDamageFromSourceExecution::bCoalesceDamageCues).
+	 *
+	 * @param Parameters
+	 *	The parameters that were passed to the gameplay cue.
+	 *
+	 * @return
+	 *	A map from the tag of each type of damage that was inflicted to the amount of that type of damage. This is
+	 *	empty if the cue is reporting a miss (i.e., no damage).
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Gameplay Cues")
+	static TMap<FGameplayTag, float> GetDamageByTypeFromGameplayCue(const FGameplayCueParameters& Parameters);
+
 	/**
 	 * Builds context for a gameplay effect activation triggered by the specified ability, instigator, and causer.
 	 *
@@ -17,6 +17,7 @@
 #include <Kismet/BlueprintFunctionLibrary.h>
 
 #include "Abilities/PF2DegreeOfSuccess.h"
+#include "Abilities/PF2DegreeOfSuccessDistribution.h"
 
 #include "PF2AttackStatLibrary.generated.h"
 
@@ -75,6 +76,22 @@ protected:
 	 */
 	static constexpr float MaxRangePenalty = (MaxRangeIncrement - 1.0f) * RangePenaltyPerIncrement;
 
+	/**
+	 * The smallest margin (check modifier minus DC) that has its own entry in the d20 degree-of-success table.
+	 *
+	 * Every margin at or below this value has the same outcome distribution: everything is a critical failure except a
+	 * natural 20, which is upgraded to a failure.
+	 */
+	static constexpr int32 MinTabulatedCheckMargin = -30;
+
+	/**
+	 * The largest margin (check modifier minus DC) that has its own entry in the d20 degree-of-success table.
+	 *
+	 * Every margin at or above this value has the same outcome distribution: everything is a critical success except a
+	 * natural 1, which is downgraded to a success.
+	 */
+	static constexpr int32 MaxTabulatedCheckMargin = 30;
+
 public:
 	/**
 	 * Gets the default maximum distance (in centimeters) at which movement to a location is considered acceptable.
@@ -220,6 +237,32 @@ public:
 	UFUNCTION(BlueprintPure, Category="OpenPF2|Attack Stats")
 	static EPF2DegreeOfSuccess DetermineDegreeOfSuccessForCheck(const float Value, const float DifficultyClass);
 
+	/**
+	 * Gets the exact probability of each degree of success for a d20 check with the given modifier against a DC.
+	 *
+	 * This does not roll any dice; the result comes from a table of all twenty outcomes of the d20 for each margin
+	 * between the modifier and the DC, which is computed once. Both the "natural 20" and "natural 1" adjustments are
+	 * included.
+	 *
+	 * From the Pathfinder 2E Core Rulebook, Chapter 9, page 445, "Step 4: Determine the Degree of Success and Effect":
+	 * "If you rolled a 20 on the die (a 'natural 20'), your result is one degree of success better than it would be by
+	 * numbers alone. If you roll a 1 on the d20 (a 'natural 1'), your result is one degree worse. This means that a
+	 * natural 20 usually results in a critical success and natural 1 usually results in a critical failure."
+	 *
+	 * @param Modifier
+	 *	The total modifier that gets added to the d20 roll (e.g., the attack modifier, including proficiency, bonuses,
+	 *	and penalties). PF2 modifiers are whole numbers; any fractional part of the difference between the modifier and
+	 *	the DC is rounded down, as with any other fractional result in PF2.
+	 * @param DifficultyClass
+	 *	The difficulty class to check against.
+	 *
+	 * @return
+	 *	The probability of each degree of success.
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Attack Stats")
+	static FPF2DegreeOfSuccessDistribution GetDegreeOfSuccessDistribution(const float Modifier,
+	                                                                       const float DifficultyClass);
+
 	/**
 	 * Upgrades a check result to one degree of success better, up to a maximum of "critical success".
 	 *
@@ -328,7 +371,8 @@ public:
 	 * Source: Pathfinder 2E Core Rulebook, Chapter 6, page 278, "Damage Rolls".
 	 *
 	 * @param DamageDie
-	 *	The damage die of the weapon or unarmed attack.
+	 *	The damage die of the weapon or unarmed attack (e.g., "1d8"). The expression may include a constant modifier
+	 *	(e.g., "2d8+4"), which gets added to the damage roll along with the damage ability modifier.
 	 * @param DamageAbilityModifier
 	 *	The modifier for the type of damage (e.g., Strength modifier or Strength modifier for thrown weapons).
 	 *
@@ -368,6 +412,45 @@ public:
 	                                 const int   RollSize,
 	                                 const float DamageAbilityModifier);
 
+	/**
+	 * Calculates the average damage roll for the given damage die and damage ability modifier, without rolling dice.
+	 *
+	 * This is the expected value of CalculateDamageRoll() for the same inputs.
+	 *
+	 * @param DamageDie
+	 *	The damage die of the weapon or unarmed attack (e.g., "1d8" or "2d8+4").
+	 * @param DamageAbilityModifier
+	 *	The modifier for the type of damage (e.g., Strength modifier or Strength modifier for thrown weapons).
+	 *
+	 * @return
+	 *	The average damage roll value.
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Attack Stats")
+	static float CalculateExpectedDamageRoll(const FName DamageDie, const float DamageAbilityModifier);
+
+	/**
+	 * Calculates the average damage of a Strike, accounting for the chance of missing and of critically hitting.
+	 *
+	 * From the Pathfinder 2E Core Rulebook, Chapter 6, page 278, "Critical Hits":
+	 * "When you make an attack and succeed with a natural 20 (the number on the die is 20), or if the result of your
+	 * attack exceeds the target’s AC by 10, you achieve a critical success (also known as a critical hit). If you
+	 * critically succeed at a Strike, your attack deals double damage."
+	 *
+	 * @param AttackDistribution
+	 *	The distribution of outcomes for the attack roll, as returned by GetDegreeOfSuccessDistribution().
+	 * @param DamageDie
+	 *	The damage die of the weapon or unarmed attack (e.g., "1d8" or "2d8+4").
+	 * @param DamageAbilityModifier
+	 *	The modifier for the type of damage (e.g., Strength modifier or Strength modifier for thrown weapons).
+	 *
+	 * @return
+	 *	The expected damage of a single Strike.
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Attack Stats")
+	static float CalculateExpectedStrikeDamage(const FPF2DegreeOfSuccessDistribution& AttackDistribution,
+	                                           const FName                            DamageDie,
+	                                           const float                            DamageAbilityModifier);
+
 	/**
 	 * Performs a recovery flat check and returns the result.
 	 *
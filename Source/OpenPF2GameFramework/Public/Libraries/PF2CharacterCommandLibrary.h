@@ -12,6 +12,11 @@
 
 #include "PF2CharacterCommandLibrary.generated.h"
 
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class IPF2CharacterCommandInterface;
+
 // =====================================================================================================================
 // Normal Declarations
 // =====================================================================================================================
@@ -36,4 +41,16 @@ public:
 	UFUNCTION(BlueprintPure, Category="OpenPF2|Character Commands")
 	static EPF2CommandExecuteOrQueueResult ImmediateResultToExecuteOrQueueResult(
 		const EPF2CommandExecuteImmediatelyResult ImmediateResult);
+
+	/**
+	 * Returns a command that is no longer needed to the command pool of its world, so that it can be reused.
+	 *
+	 * The command must not be in any command queue, and must not be used after it has been released. Commands that are
+	 * not of type APF2CharacterCommand are ignored.
+	 *
+	 * @param Command
+	 *	The command to release.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Character Commands")
+	static void ReleaseCommand(const TScriptInterface<IPF2CharacterCommandInterface>& Command);
 };
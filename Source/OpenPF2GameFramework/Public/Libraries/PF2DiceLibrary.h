@@ -5,14 +5,27 @@
 
 #pragma once
 
-#include <Internationalization/Regex.h>
-
 #include <Kismet/BlueprintFunctionLibrary.h>
 
 #include <Math/RandomStream.h>
 
+#include "Dice/PF2DiceExpression.h"
+
 #include "PF2DiceLibrary.generated.h"
 
+// =====================================================================================================================
+// Type Aliases
+// =====================================================================================================================
+/**
+ * An array of individual die results that is stored inline (without a heap allocation) for typical roll counts.
+ *
+ * Rolls that exceed the inline capacity still succeed, but spill over to the heap.
+ */
+using FPF2InlineDiceRolls = TArray<int32, TInlineAllocator<32>>;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
 /**
  * Simple function library for rolling dice of any size.
  *
@@ -23,28 +36,27 @@
  *	- RollString("1d4") and Roll(1,4) - Roll one, four-sided dice.
  *	- RollString("10d12") and Roll(10,12) - Roll ten, twelve-sided dice.
  *
- * Unlike other RPG systems like Dungeons and Dragons, P2E game rules do *not* appear to require the ability to evaluate
- * complex dice rolling expressions like "5d4+3", "3d6x10", or "d6/2". Consequently, these types of expressions are not
- * supported at this time.
+ * Roll expressions may also include a constant modifier, as in "2d8+4" or "1d4-1". Unlike other RPG systems like
+ * Dungeons and Dragons, P2E game rules do *not* appear to require the ability to evaluate more complex dice rolling
+ * expressions like "3d6x10" or "d6/2". Consequently, these types of expressions are not supported at this time.
+ *
+ * Roll expression strings are parsed once and then cached in compiled form (see FPF2DiceExpressionCache), so repeatedly
+ * rolling the same expression does not re-parse it.
  */
 UCLASS()
 class OPENPF2GAMEFRAMEWORK_API UPF2DiceLibrary final : public UBlueprintFunctionLibrary {
 	GENERATED_BODY()
 
 protected:
-	// =================================================================================================================
-	// Protected Constants
-	// =================================================================================================================
-	/**
-	 * Regular expression pattern used to parse dice rolling expressions.
-	 */
-	static const FRegexPattern DiceRollPattern;
-
 	// =================================================================================================================
 	// Protected Static Fields
 	// =================================================================================================================
 	/**
-	 * The random number generator (RNG) used for dice rolls.
+	 * The fallback random number generator (RNG) used for dice rolls made on the game thread.
+	 *
+	 * This is only used when no other stream is active on the game thread (e.g., by code that runs outside of any world
+	 * tick, such as automation tests). While a world ticks, rolls instead come from the stream of that world's
+	 * UPF2RandomSubsystem.
 	 *
 	 * This is a random stream so that dice rolls can be seeded deterministically during tests.
 	 */
@@ -60,12 +72,13 @@ public:
 	 * Complex roll expressions like "3d6x10" are not supported at this time.
 	 *
 	 * @param RollExpression
-	 *	The description of the roll, in "CdS" format, where "C" represents the count or number of dice to roll, and "S"
-	 *	represents the number of sides of each die (the die size). For example, "1d6" represents a single roll of a
-	 *	six-sided die, while "2d4" represents rolling two dice having four sides each.
+	 *	The description of the roll, in "CdS[+M|-M]" format, where "C" represents the count or number of dice to roll,
+	 *	"S" represents the number of sides of each die (the die size), and the optional "M" represents a constant to add
+	 *	to or subtract from the sum. For example, "1d6" represents a single roll of a six-sided die, while "2d4+1"
+	 *	represents rolling two dice having four sides each and adding one to the result.
 	 *
 	* @return
-	 *	The sum of the dice roll(s).
+	 *	The sum of the dice roll(s), including any constant modifier.
 	 */
 	UFUNCTION(BlueprintPure=false, Category="OpenPF2|Dice", DisplayName="Roll Dice (Roll Expression) and Sum")
 	static int32 RollStringSum(const FName RollExpression);
@@ -73,6 +86,9 @@ public:
 	/**
 	 * Returns the sum of a dice roll for the given numeric parameters.
 	 *
+	 * This does not allocate any memory, so it is preferred over summing the result of Roll() in performance-sensitive
+	 * code. Given the same random seed, this produces the same sum as the results of Roll() would.
+	 *
 	 * @param RollCount
 	 *	The count or number of dice to roll.
 	 * @param DieSize
@@ -84,15 +100,42 @@ public:
 	UFUNCTION(BlueprintPure=false, Category="OpenPF2|Dice", DisplayName="Roll Dice and Sum")
 	static int32 RollSum(const int32 RollCount, const int32 DieSize);
 
+	/**
+	 * Returns the sum of a dice roll for the given compiled dice roll expression.
+	 *
+	 * @param Expression
+	 *	The compiled roll expression, as returned by CompileRollExpression().
+	 *
+	 * @return
+	 *	The sum of the dice roll(s), including the constant modifier of the expression. If the expression is not valid,
+	 *	the result is 0.
+	 */
+	UFUNCTION(BlueprintPure=false, Category="OpenPF2|Dice", DisplayName="Roll Dice (Compiled Expression) and Sum")
+	static int32 RollExpressionSum(const FPF2DiceExpression& Expression);
+
+	/**
+	 * Returns the average sum of a dice roll for the given dice roll expression string, without rolling any dice.
+	 *
+	 * @param RollExpression
+	 *	The description of the roll, in "CdS[+M|-M]" format.
+	 *
+	 * @return
+	 *	The expected value of RollStringSum() for the same expression; or, 0.0 if the expression cannot be parsed.
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Dice", DisplayName="Expected Dice Sum (Roll Expression)")
+	static float GetExpectedRollStringSum(const FName RollExpression);
+
 	/**
 	 * Returns the result of a dice roll for the given dice roll expression string.
 	 *
-	 * Complex roll expressions like "3d6x10" are not supported at this time.
+	 * Complex roll expressions like "3d6x10" are not supported at this time. The constant modifier of an expression
+	 * like "2d8+4" does not affect the result of any individual die, so it is not reflected in the result.
 	 *
 	 * @param RollExpression
-	 *	The description of the roll, in "CdS" format, where "C" represents the count or number of dice to roll, and "S"
-	 *	represents the number of sides of each die (the die size). For example, "1d6" represents a single roll of a
-	 *	six-sided die, while "2d4" represents rolling two dice having four sides each.
+	 *	The description of the roll, in "CdS[+M|-M]" format, where "C" represents the count or number of dice to roll,
+	 *	"S" represents the number of sides of each die (the die size), and the optional "M" represents a constant to add
+	 *	to or subtract from the sum. For example, "1d6" represents a single roll of a six-sided die, while "2d4"
+	 *	represents rolling two dice having four sides each.
 	 *
 	* @return
 	 *	The result of each dice roll.
@@ -114,13 +157,29 @@ public:
 	UFUNCTION(BlueprintPure=false, Category="OpenPF2|Dice", DisplayName="Roll Dice")
 	static TArray<int32> Roll(const int32 RollCount, const int32 DieSize);
 
+	/**
+	 * Rolls dice for the given numeric parameters into an array that stores typical roll counts inline.
+	 *
+	 * This is equivalent to Roll(), but avoids a heap allocation for rolls of up to 32 dice when the output array lives
+	 * on the stack.
+	 *
+	 * @param [in] RollCount
+	 *	The count or number of dice to roll.
+	 * @param [in] DieSize
+	 *	The number of sides of each die.
+	 * @param [out] OutRolls
+	 *	A reference to the array to receive the result of each dice roll. Any existing contents are replaced.
+	 */
+	static void RollInline(const int32 RollCount, const int32 DieSize, FPF2InlineDiceRolls& OutRolls);
+
 	/**
 	 * Increases the size of a given dice expression, returning the next dice size up,
 	 *
 	 * @param RollExpression
 	 *	The description of the roll, in "CdS" format, where "C" represents the count or number of dice to roll, and "S"
 	 *	represents the number of sides of each die (the die size). For example, "1d6" represents a single roll of a
-	 *	six-sided die, while "2d4" represents rolling two dice having four sides each.
+	 *	six-sided die, while "2d4" represents rolling two dice having four sides each. A constant modifier (e.g.,
+	 *	"2d4+1") is preserved as-is.
 	 *
 	 * @return
 	 *	A roll expression for the next size up (for example, given "1d6" this would return "1d8"; given "2d4", this
@@ -141,9 +200,28 @@ public:
 	UFUNCTION(BlueprintPure=false, Category="OpenPF2|Dice", DisplayName="Next Die Size")
 	static int32 NextSize(const int32 DieSize);
 
+	/**
+	 * Gets the compiled form of the given roll expression.
+	 *
+	 * The expression is parsed only the first time it is encountered; later calls for the same expression return the
+	 * cached result. Callers that roll the same expression repeatedly should hold on to the compiled expression and
+	 * pass it to RollExpressionSum() instead of passing the string form to RollStringSum().
+	 *
+	 * @param RollExpression
+	 *	The description of the roll, in "CdS[+M|-M]" format.
+	 *
+	 * @return
+	 *	The compiled expression. The "Is Valid" flag of the result indicates whether the expression could be parsed.
+	 */
+	UFUNCTION(BlueprintPure, Category="OpenPF2|Dice")
+	static FPF2DiceExpression CompileRollExpression(const FName RollExpression);
+
 	/**
 	 * Parses the string description of a roll into distinct roll count and die size components.
 	 *
+	 * Only "CdS" expressions can be represented by the outputs of this method, so expressions that include a constant
+	 * modifier (e.g., "2d8+4") are not considered parsable here. Use CompileRollExpression() for such expressions.
+	 *
 	 * @param [in] RollExpression
 	 *	The description of the roll, in "CdS" format, where "C" represents the count or number of dice to roll, and "S"
 	 *	represents the number of sides of each die (the die size). For example, "1d6" represents a single roll of a
@@ -164,6 +242,8 @@ public:
 	/**
 	 * Gets the random seed of the random number generator (RNG) being used to generate dice rolls.
 	 *
+	 * This is the seed of the stream that is currently active on the calling thread.
+	 *
 	 * @return
 	 *	The current random seed.
 	 */
@@ -178,26 +258,79 @@ public:
 	 * automatically generate a random seed based on the current system time during the first dice roll of the current
 	 * session.
 	 *
+	 * This re-seeds the stream that is currently active on the calling thread. To seed the rolls of a specific world,
+	 * use UPF2RandomSubsystem::SetRandomSeed() instead.
+	 *
 	 * @param Seed
 	 *	The random seed to set.
 	 */
 	UFUNCTION(BlueprintPure=false, Category="OpenPF2|Dice")
 	static void SetRandomSeed(const int32 Seed);
 
+	/**
+	 * Gets the stream that is the source of dice rolls on the calling thread, if one has been bound.
+	 *
+	 * @return
+	 *	The active stream; or, nullptr if no stream has been bound on this thread and rolls will come from a fallback
+	 *	stream.
+	 */
+	static FRandomStream* GetActiveRandomStream();
+
+	/**
+	 * Binds the stream that will be the source of dice rolls on the calling thread.
+	 *
+	 * Most code should use FPF2ScopedRandomStream rather than calling this directly, so that the previous stream gets
+	 * restored automatically.
+	 *
+	 * @param Stream
+	 *	The stream to bind; or, nullptr to revert to the fallback stream. The stream must remain valid until it has been
+	 *	unbound.
+	 *
+	 * @return
+	 *	The stream that was active on this thread before the call.
+	 */
+	static FRandomStream* SetActiveRandomStream(FRandomStream* Stream);
+
 protected:
 	// =================================================================================================================
 	// Protected Static Methods
 	// =================================================================================================================
 	/**
-	 * Returns a reference to the RNG for dice rolls.
+	 * Returns a reference to the RNG for dice rolls on the calling thread.
 	 *
 	 * @return
-	 *	The pre-initialized RNG for dice rolls.
+	 *	The stream that has been bound to the calling thread, if there is one. Otherwise, the fallback stream for the
+	 *	game thread (if called from the game thread) or a private, randomly-seeded fallback stream for the calling
+	 *	thread.
 	 */
-	[[nodiscard]] FORCEINLINE static FRandomStream& GetDiceRng()
+	[[nodiscard]] static FRandomStream& GetDiceRng();
+
+	/**
+	 * Rolls a single die using the given RNG.
+	 *
+	 * @param Rng
+	 *	The RNG from which to roll.
+	 * @param DieSize
+	 *	The number of sides of the die.
+	 *
+	 * @return
+	 *	The result of the roll.
+	 */
+	FORCEINLINE static int32 RollDie(FRandomStream& Rng, const int32 DieSize)
 	{
-		check(DiceRng.GetInitialSeed() != 0);
+		int32 Roll;
+
+		if (DieSize == 0)
+		{
+			// Edge case: Unlikely to happen, but just in case, we need to make sure that rolling a zero-sided die does
+			// not return 1. Could happen if the die size is passed in dynamically.
+			Roll = 0;
+		}
+		else
+		{
+			Roll = Rng.RandRange(1, DieSize);
+		}
 
-		return DiceRng;
+		return Roll;
 	}
 };
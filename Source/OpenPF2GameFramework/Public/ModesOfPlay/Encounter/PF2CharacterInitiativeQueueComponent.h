@@ -29,6 +29,77 @@ class IPF2PlayerControllerInterface;
 // =====================================================================================================================
 // Normal Declarations
 // =====================================================================================================================
+/**
+ * The position of a single character in a character initiative queue.
+ *
+ * From the Pathfinder 2E Core Rulebook, page 468, "Step 1: Roll Initiative":
+ * "If your result is tied with a foe’s result, the adversary goes first. If your result is tied with another PC’s,
+ * you can decide between yourselves who goes first when you reach that place in the initiative order. After that,
+ * your places in the initiative order usually don’t change during the encounter."
+ *
+ * Per OpenPF2 rules, Playable Characters (PCs) with the same initiative as Non-Playable Characters (NPCs) are ordered
+ * after the NPCs so that NPCs take turns first. Characters of the same type with the same initiative keep the order in
+ * which their initiative was set, rather than prompting players to choose an order. This helps to keep combat fluid by
+ * avoiding having to prompt players for input at the start of encounters.
+ */
+struct FPF2CharacterInitiativeQueueEntry
+{
+	/**
+	 * The character occupying this position in the queue.
+	 */
+	IPF2CharacterInterface* Character;
+
+	/**
+	 * The initiative of the character.
+	 */
+	int32 Initiative;
+
+	/**
+	 * Whether the character was controllable by a player at the time that its initiative was set.
+	 */
+	bool bIsPlayable;
+
+	/**
+	 * A number that increases every time that initiative is set for a character, used to break ties between characters
+	 * of the same type that have the same initiative.
+	 */
+	uint32 InsertionSequence;
+
+	/**
+	 * Determines whether this entry comes before another entry in initiative order.
+	 *
+	 * @param Other
+	 *	The entry to compare against.
+	 *
+	 * @return
+	 *	- true if the character of this entry takes its turn before the character of the other entry.
+	 *	- false if the character of this entry takes its turn after the character of the other entry, or if the entries
+	 *	  are the same.
+	 */
+	FORCEINLINE bool ComesBefore(const FPF2CharacterInitiativeQueueEntry& Other) const
+	{
+		bool bResult;
+
+		if (this->Initiative != Other.Initiative)
+		{
+			// Higher initiative goes first.
+			bResult = (this->Initiative > Other.Initiative);
+		}
+		else if (this->bIsPlayable != Other.bIsPlayable)
+		{
+			// NPCs come before PCs.
+			bResult = !this->bIsPlayable;
+		}
+		else
+		{
+			// Characters of the same type retain their positions based on insertion order.
+			bResult = (this->InsertionSequence < Other.InsertionSequence);
+		}
+
+		return bResult;
+	}
+};
+
 UCLASS(ClassGroup="OpenPF2-ModeOfPlayRuleSets", meta=(BlueprintSpawnableComponent))
 class OPENPF2GAMEFRAMEWORK_API UPF2CharacterInitiativeQueueComponent final :
 	public UPF2ActorComponentBase,
@@ -41,25 +112,29 @@ protected:
 	// Protected Fields
 	// =================================================================================================================
 	/**
-	 * A map of initiative to characters.
+	 * All of the characters in the queue, in initiative order (see FPF2CharacterInitiativeQueueEntry::ComesBefore()).
 	 *
 	 * From the Pathfinder 2E Core Rulebook, page 13, "Initiative":
 	 * "At the start of an encounter, all creatures involved roll for initiative to determine the order in which they
 	 * act. The higher the result of its roll, the earlier a creature gets to act."
 	 *
-	 * From the Pathfinder 2E Core Rulebook, page 468, "Step 1: Roll Initiative":
-	 * "If your result is tied with a foe’s result, the adversary goes first. If your result is tied with another PC’s,
-	 * you can decide between yourselves who goes first when you reach that place in the initiative order. After that,
-	 * your places in the initiative order usually don’t change during the encounter."
+	 * This array is always kept sorted. The position of an entry is located by binary search, so adding or removing a
+	 * character does not require the rest of the sequence to be sorted again.
 	 */
-	TMultiMap<int, IPF2CharacterInterface*> CharactersByInitiatives;
+	TArray<FPF2CharacterInitiativeQueueEntry> CurrentCharacterSequence;
 
 	/**
-	 * All of the characters in the queue, ordered from highest to lowest initiative.
+	 * The entry of each character in the queue, keyed by character.
 	 *
-	 * This array is rebuilt whenever characters are added or removed from the queue.
+	 * This provides constant-time lookups of the initiative of a character, and provides the key for locating the
+	 * position of a character in CurrentCharacterSequence.
 	 */
-	TArray<IPF2CharacterInterface*> CurrentCharacterSequence;
+	TMap<const IPF2CharacterInterface*, FPF2CharacterInitiativeQueueEntry> EntriesByCharacter;
+
+	/**
+	 * The insertion sequence to assign to the next character whose initiative gets set.
+	 */
+	uint32 NextInsertionSequence;
 
 	/**
 	 * The last character that was returned by GetNextCharacterByInitiative().
@@ -79,6 +154,7 @@ public:
 	 * Default constructor for UPF2CharacterInitiativeQueueComponent.
 	 */
 	explicit UPF2CharacterInitiativeQueueComponent() :
+		NextInsertionSequence(0),
 		PreviousCharacter(nullptr),
 		PreviousCharacterIndex(-1)
 	{
@@ -94,6 +170,9 @@ public:
 	virtual void SetCharacterInitiative(const TScriptInterface<IPF2CharacterInterface>& Character,
 	                                    const int32                                     Initiative) override;
 
+	virtual void SetCharacterInitiatives(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters,
+	                                     const TArray<int32>&                                     Initiatives) override;
+
 	virtual bool IsInitiativeSetForCharacter(const TScriptInterface<IPF2CharacterInterface>& Character) const override;
 
 	virtual void InsertCharacterAtOrAboveInitiative(
@@ -148,40 +227,82 @@ protected:
 	TArray<TScriptInterface<IPF2CharacterInterface>> GetPlayerControlledCharacters() const;
 
 	/**
-	 * Rebuilds the sequence of characters according to initiative order.
+	 * Determines whether the given character is controllable by any player.
+	 *
+	 * @param Character
+	 *	The character to check.
+	 *
+	 * @return
+	 *	- true if the character is a Playable Character (PC).
+	 *	- false if the character is a Non-Playable Character (NPC).
+	 */
+	bool IsPlayableCharacter(const IPF2CharacterInterface* Character) const;
+
+	/**
+	 * Determines whether at least one character in the queue has the specified initiative.
 	 *
-	 * All characters are sorted from highest to lowest initiative order in the rebuilt list. If two characters have the
-	 * same initiative, their order will be adjusted so that one goes before the other. Per OpenPF2 rules (see below),
-	 * Playable Characters (PCs) with the same initiative as Non-Playable Characters (NPCs) are sorted after NPCs so
-	 * that NPCs take turns first. Unlike with standard OpenPF2 rules, though, if multiple characters of the same
-	 * type -- either two PCs or two NPCs -- we randomize their order rather than give each character a choice of
-	 * preferred order. This helps to keep combat fluid by avoiding having to prompt players for input at the start of
-	 * encounters.
+	 * @param Initiative
+	 *	The initiative score to look for.
 	 *
-	 * From the Pathfinder 2E Core Rulebook, page 13, "Initiative":
-	 * "At the start of an encounter, all creatures involved roll for initiative to determine the order in which they
-	 * act. The higher the result of its roll, the earlier a creature gets to act."
+	 * @return
+	 *	- true if the initiative score is occupied.
+	 *	- false if no character has the initiative score.
+	 */
+	bool IsInitiativeOccupied(const int32 Initiative) const;
+
+	/**
+	 * Gets the position of the given entry in the character sequence.
 	 *
-	 * From the Pathfinder 2E Core Rulebook, page 468, "Step 1: Roll Initiative":
-	 * "If your result is tied with a foe’s result, the adversary goes first. If your result is tied with another PC’s,
-	 * you can decide between yourselves who goes first when you reach that place in the initiative order. After that,
-	 * your places in the initiative order usually don’t change during the encounter."
+	 * @param Entry
+	 *	The entry to locate.
 	 *
-	 * This method performs a lot of sorting and is expensive. It should only be called when the list of characters has
-	 * changed.
+	 * @return
+	 *	The index in CurrentCharacterSequence at which the entry is located or would be inserted.
 	 */
-	void RebuildCharacterSequence();
+	int32 FindPositionInSequence(const FPF2CharacterInitiativeQueueEntry& Entry) const;
 
 	/**
-	 * Attempts to locate the specified character in the initiative map and then remove them.
+	 * Adds the specified character to the queue at the position that corresponds to the given initiative.
 	 *
-	 * This method does not rebuild the character sequence. In most cases, you will want to use
-	 * ClearInitiativeForCharacter() instead, as that method calls this method and then rebuilds the character sequence.
+	 * The character must not already be in the queue.
 	 *
 	 * @param Character
-	 *	The character being removed from the map.
+	 *	The character being added to the queue.
+	 * @param Initiative
+	 *	The initiative of the character.
+	 * @param bIsPlayable
+	 *	Whether the character is controllable by a player.
+	 */
+	void AddCharacterToSequence(IPF2CharacterInterface* Character, const int32 Initiative, const bool bIsPlayable);
+
+	/**
+	 * Attempts to locate the specified character in the queue and then remove them.
+	 *
+	 * If the character being removed is the character that was last returned by GetNextCharacterByInitiative(), the
+	 * character before it in the sequence becomes the previous character, so that the turn order is not disturbed.
+	 *
+	 * @param Character
+	 *	The character being removed from the queue.
+	 */
+	void RemoveCharacterFromSequence(const IPF2CharacterInterface* Character);
+
+	/**
+	 * Multiplies the initiative score of every character in the queue by the given factor.
+	 *
+	 * The factor must be greater than zero. Since this cannot change the relative order of characters, the sequence is
+	 * updated in place without being sorted again.
+	 *
+	 * @param Factor
+	 *	The amount by which to multiply all initiative scores.
+	 */
+	void ScaleAllInitiatives(const int32 Factor);
+
+	/**
+	 * Updates the index of the previous character to account for characters having been added or removed.
+	 *
+	 * This maintains where we're pointing in the sequence after everything shuffled around.
 	 */
-	void RemoveCharacterFromInitiativeMap(const IPF2CharacterInterface* Character);
+	void FixUpPreviousCharacterIndex();
 
 	/**
 	 * Adjusts a character's initiative to occupy the specified initiative score or an offset above or below it.
@@ -83,6 +83,28 @@ public:
 	virtual void SetCharacterInitiative(const TScriptInterface<IPF2CharacterInterface>& Character,
 	                                    const int32                                     Initiative) = 0;
 
+	/**
+	 * Sets the initiative of several characters at once.
+	 *
+	 * This has the same effect as calling SetCharacterInitiative() for each character in turn, except that the
+	 * initiative order is built only once, after all initiatives have been set. This is the most efficient way to add
+	 * a large number of characters to the queue (e.g., when everyone rolls initiative at the start of an encounter).
+	 * If the initiative of the character whose turn it is to act changes, the turn order rewinds to the character
+	 * before it, just as it does for SetCharacterInitiative(), so that no other character gains or loses a turn.
+	 * Characters are added in the order that they appear in the given array, and each initiative score must be greater
+	 * than zero; any character with an invalid initiative score is skipped and an error is logged.
+	 *
+	 * If the two arrays are not the same length, an error is logged and no changes to initiative score are made.
+	 *
+	 * @param Characters
+	 *	The characters for which initiative is being set.
+	 * @param Initiatives
+	 *	The initiative value to use for each character, in the same order as Characters. Each must be greater than 0.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Components|Mode of Play Rule Sets|Character Initiative Queues")
+	virtual void SetCharacterInitiatives(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters,
+	                                     const TArray<int32>&                                     Initiatives) = 0;
+
 	/**
 	 * Determines if the specified character has an initiative set.
 	 *
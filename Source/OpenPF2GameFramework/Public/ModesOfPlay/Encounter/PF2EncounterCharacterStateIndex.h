@@ -0,0 +1,269 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class IPF2CharacterInterface;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * A snapshot of the encounter-relevant states of a single character.
+ */
+struct OPENPF2GAMEFRAMEWORK_API FPF2EncounterCharacterStates
+{
+	/**
+	 * Whether the character has hit points remaining.
+	 */
+	bool bIsAlive;
+
+	/**
+	 * Whether the character has the dying condition.
+	 */
+	bool bIsDying;
+
+	/**
+	 * Whether the character has the unconscious condition.
+	 */
+	bool bIsUnconscious;
+
+	/**
+	 * Whether the character has the dead condition.
+	 */
+	bool bIsDead;
+
+	/**
+	 * Whether the character is controlled by a player.
+	 */
+	bool bIsPlayerControlled;
+
+	/**
+	 * Default constructor for FPF2EncounterCharacterStates.
+	 */
+	explicit FPF2EncounterCharacterStates() :
+		bIsAlive(false),
+		bIsDying(false),
+		bIsUnconscious(false),
+		bIsDead(false),
+		bIsPlayerControlled(false)
+	{
+	}
+};
+
+/**
+ * An index of the characters in an encounter by state, which keeps a running count of characters in each state.
+ *
+ * The index does not observe characters itself; the owner of the index is expected to update the states of a character
+ * whenever they change (e.g., when a condition tag is added to or removed from the character). In exchange, questions
+ * like "are any player-controlled characters still alive?" can be answered without visiting every character in the
+ * encounter.
+ */
+class OPENPF2GAMEFRAMEWORK_API FPF2EncounterCharacterStateIndex final
+{
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * Map from each character in the index to the last states recorded for that character.
+	 */
+	TMap<const IPF2CharacterInterface*, FPF2EncounterCharacterStates> StatesByCharacter;
+
+	/**
+	 * The number of characters in the index who are alive.
+	 */
+	int32 NumAlive = 0;
+
+	/**
+	 * The number of characters in the index who are dying.
+	 */
+	int32 NumDying = 0;
+
+	/**
+	 * The number of characters in the index who are unconscious.
+	 */
+	int32 NumUnconscious = 0;
+
+	/**
+	 * The number of characters in the index who are dead.
+	 */
+	int32 NumDead = 0;
+
+	/**
+	 * The number of characters in the index who are controlled by a player.
+	 */
+	int32 NumPlayerControlled = 0;
+
+	/**
+	 * The number of characters in the index who are both alive and controlled by a player.
+	 */
+	int32 NumAlivePlayerControlled = 0;
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the number of characters in this index.
+	 *
+	 * @return
+	 *	The number of characters being tracked.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return this->StatesByCharacter.Num();
+	}
+
+	/**
+	 * Determines whether the given character is in this index.
+	 *
+	 * @param Character
+	 *	The character to look for.
+	 *
+	 * @return
+	 *	- true if the character is being tracked by this index.
+	 *	- false if the character is not being tracked by this index.
+	 */
+	FORCEINLINE bool Contains(const IPF2CharacterInterface* Character) const
+	{
+		return this->StatesByCharacter.Contains(Character);
+	}
+
+	/**
+	 * Gets the last states recorded for the given character.
+	 *
+	 * @param Character
+	 *	The character of interest.
+	 *
+	 * @return
+	 *	Either the states of the character; or, nullptr if the character is not in this index.
+	 */
+	FORCEINLINE const FPF2EncounterCharacterStates* FindStates(const IPF2CharacterInterface* Character) const
+	{
+		return this->StatesByCharacter.Find(Character);
+	}
+
+	/**
+	 * Gets the number of characters in this index who are alive.
+	 *
+	 * @return
+	 *	The number of living characters.
+	 */
+	FORCEINLINE int32 GetNumAlive() const
+	{
+		return this->NumAlive;
+	}
+
+	/**
+	 * Gets the number of characters in this index who are dying.
+	 *
+	 * @return
+	 *	The number of dying characters.
+	 */
+	FORCEINLINE int32 GetNumDying() const
+	{
+		return this->NumDying;
+	}
+
+	/**
+	 * Gets the number of characters in this index who are unconscious.
+	 *
+	 * @return
+	 *	The number of unconscious characters.
+	 */
+	FORCEINLINE int32 GetNumUnconscious() const
+	{
+		return this->NumUnconscious;
+	}
+
+	/**
+	 * Gets the number of characters in this index who are dead.
+	 *
+	 * @return
+	 *	The number of dead characters.
+	 */
+	FORCEINLINE int32 GetNumDead() const
+	{
+		return this->NumDead;
+	}
+
+	/**
+	 * Gets the number of characters in this index who are controlled by a player.
+	 *
+	 * @return
+	 *	The number of player-controlled characters.
+	 */
+	FORCEINLINE int32 GetNumPlayerControlled() const
+	{
+		return this->NumPlayerControlled;
+	}
+
+	/**
+	 * Gets the number of characters in this index who are alive and controlled by a player.
+	 *
+	 * @return
+	 *	The number of living, player-controlled characters.
+	 */
+	FORCEINLINE int32 GetNumAlivePlayerControlled() const
+	{
+		return this->NumAlivePlayerControlled;
+	}
+
+	/**
+	 * Gets the number of characters in this index who are alive and not controlled by a player.
+	 *
+	 * @return
+	 *	The number of living non-player characters (NPCs).
+	 */
+	FORCEINLINE int32 GetNumAliveNonPlayerControlled() const
+	{
+		return this->NumAlive - this->NumAlivePlayerControlled;
+	}
+
+	/**
+	 * Records the states of a character, adding the character to this index if it is not already in it.
+	 *
+	 * @param Character
+	 *	The character whose states are being recorded.
+	 * @param States
+	 *	The current states of the character.
+	 */
+	void SetCharacterStates(const IPF2CharacterInterface* Character, const FPF2EncounterCharacterStates& States);
+
+	/**
+	 * Removes a character from this index.
+	 *
+	 * @param Character
+	 *	The character to remove.
+	 *
+	 * @return
+	 *	- true if the character was in this index and has been removed.
+	 *	- false if the character was not in this index.
+	 */
+	bool RemoveCharacter(const IPF2CharacterInterface* Character);
+
+	/**
+	 * Removes all characters from this index.
+	 */
+	void Reset();
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Adds or subtracts the given states from the running count of characters in each state.
+	 *
+	 * @param States
+	 *	The states to count.
+	 * @param Delta
+	 *	1 to count a character that has the given states; or, -1 to stop counting a character that had them.
+	 */
+	void AdjustCounts(const FPF2EncounterCharacterStates& States, const int32 Delta);
+};
@@ -11,6 +11,8 @@
 
 #include "ModesOfPlay/PF2ModeOfPlayRuleSetBase.h"
 #include "ModesOfPlay/Encounter/PF2CharacterInitiativeQueueInterface.h"
+#include "ModesOfPlay/Encounter/PF2EncounterCharacterStateIndex.h"
+#include "ModesOfPlay/Encounter/PF2EncounterSnapshot.h"
 #include "ModesOfPlay/Encounter/PF2EncounterModeOfPlayRuleSetInterface.h"
 
 #include "PF2EncounterModeOfPlayRuleSetBase.generated.h"
@@ -20,6 +22,7 @@
 // =====================================================================================================================
 class IPF2CharacterCommandInterface;
 class IPF2CharacterInterface;
+struct FOnAttributeChangeData;
 
 // =====================================================================================================================
 // Normal Declarations
@@ -58,10 +61,67 @@ protected:
 	/**
 	 * The character whose turn it is in the encounter.
 	 *
-	 * Can be null if in between turns or no character has started a turn.
+	 * Can be null if in between turns, no character has started a turn, or the encounter is suspended.
 	 */
+	UPROPERTY()
 	TScriptInterface<IPF2CharacterInterface> ActiveCharacter;
 
+	/**
+	 * An index of the characters in the encounter by state (alive, dying, unconscious, etc.).
+	 *
+	 * This is kept up to date by the condition tag and hit point callbacks that this MoPRS registers for each character
+	 * in the encounter, so that checks on the state of the encounter as a whole do not have to visit every character.
+	 */
+	FPF2EncounterCharacterStateIndex CharacterStates;
+
+	/**
+	 * Map from each character in the encounter to the handle of the delegate that tracks changes to its hit points.
+	 *
+	 * Whether a character is alive depends on its hit points rather than on a condition tag, so the condition tag
+	 * callbacks alone cannot keep CharacterStates up to date.
+	 */
+	TMap<TWeakObjectPtr<AActor>, FDelegateHandle> HitPointsDelegateHandles;
+
+	/**
+	 * Whether the turns of non-player characters (NPCs) should be planned in advance.
+	 *
+	 * If true, the first time that an NPC starts its turn without up-to-date plans, the turns of all NPCs in the
+	 * encounter are planned at once, in parallel, by their AI controllers. The plans are kept until the encounter
+	 * changes (e.g., a character joins or leaves the encounter, the conditions or hit points of a character change, or
+	 * a character moves).
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="OpenPF2 - Encounters")
+	bool bPlanNonPlayerTurnsInAdvance;
+
+	/**
+	 * How far (in centimeters) any character in the encounter can move before planned turns are considered stale.
+	 */
+	UPROPERTY(
+		EditDefaultsOnly,
+		BlueprintReadOnly,
+		Category="OpenPF2 - Encounters",
+		meta=(EditCondition="bPlanNonPlayerTurnsInAdvance", ClampMin=0.0f)
+	)
+	float PlannedTurnsMovementTolerance;
+
+	/**
+	 * Whether PlannedTurns reflects the current state of the encounter.
+	 *
+	 * This is cleared whenever the encounter changes in a way that the rule set is notified about. Movement is not
+	 * reported to the rule set, so it is instead detected by comparing against PlannedSnapshot.
+	 */
+	bool bArePlannedTurnsCurrent;
+
+	/**
+	 * The snapshot of the encounter from which PlannedTurns were made.
+	 */
+	FPF2EncounterSnapshot PlannedSnapshot;
+
+	/**
+	 * Map from each NPC to the plan for its next turn.
+	 */
+	TMap<TWeakObjectPtr<AActor>, FPF2AITurnPlan> PlannedTurns;
+
 public:
 	// =================================================================================================================
 	// Public Constructors
@@ -76,6 +136,8 @@ public:
 	// =================================================================================================================
 	virtual void OnModeOfPlayEnd(const EPF2ModeOfPlayType ModeOfPlay) override;
 
+	virtual void OnModeSuspended(const EPF2ModeOfPlayType ModeOfPlay) override;
+
 	// =================================================================================================================
 	// Public Methods - IPF2EncounterModeOfPlayRuleSetInterface Implementation
 	// =================================================================================================================
@@ -130,6 +192,26 @@ public:
 		TScriptInterface<IPF2CharacterCommandInterface>& NextCommand) override;
 
 protected:
+	// =================================================================================================================
+	// Protected Methods - APF2ModeOfPlayRuleSetBase Overrides
+	// =================================================================================================================
+	virtual void OnCharactersAddedToEncounter(
+		const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters) override;
+
+	virtual void OnCharactersRemovedFromEncounter(
+		const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters) override;
+
+	virtual void Native_OnCharacterUnconscious(const TScriptInterface<IPF2CharacterInterface>& Character) override;
+
+	virtual void Native_OnCharacterConscious(const TScriptInterface<IPF2CharacterInterface>& Character) override;
+
+	virtual void Native_OnCharacterDying(const TScriptInterface<IPF2CharacterInterface>& Character) override;
+
+	virtual void Native_OnCharacterRecoveredFromDying(
+		const TScriptInterface<IPF2CharacterInterface>& Character) override;
+
+	virtual void Native_OnCharacterDead(const TScriptInterface<IPF2CharacterInterface>& Character) override;
+
 	// =================================================================================================================
 	// Blueprint Implementable Events
 	// =================================================================================================================
@@ -173,6 +255,149 @@ protected:
 		return this->CharacterInitiativeQueue;
 	}
 
+	/**
+	 * Gets the index of the characters in the encounter by state.
+	 *
+	 * @return
+	 *	The character state index.
+	 */
+	FORCEINLINE const FPF2EncounterCharacterStateIndex& GetCharacterStates() const
+	{
+		return this->CharacterStates;
+	}
+
+	/**
+	 * Gets whether any character controlled by a player is still alive in this encounter.
+	 *
+	 * @return
+	 *	- true if at least one player-controlled character in the encounter has hit points remaining.
+	 *	- false if all player-controlled characters in the encounter are down, or there are none in the encounter.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Mode of Play Rule Sets|Encounters")
+	bool HaveLivingPlayerControlledCharacters() const;
+
+	/**
+	 * Gets whether any character not controlled by a player is still alive in this encounter.
+	 *
+	 * @return
+	 *	- true if at least one non-player character (NPC) in the encounter has hit points remaining.
+	 *	- false if all NPCs in the encounter are down, or there are none in the encounter.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Mode of Play Rule Sets|Encounters")
+	bool HaveLivingNonPlayerCharacters() const;
+
+	/**
+	 * Re-records the states of a character in the character state index.
+	 *
+	 * This has no effect if the character is not part of the encounter. Otherwise, any planned turns are discarded,
+	 * since they were based on the previous states of the character.
+	 *
+	 * @param Character
+	 *	The character whose states may have changed.
+	 */
+	void UpdateCharacterStates(const TScriptInterface<IPF2CharacterInterface>& Character);
+
+	/**
+	 * Determines the current encounter-relevant states of a character.
+	 *
+	 * @param Character
+	 *	The character of interest.
+	 *
+	 * @return
+	 *	The states of the character.
+	 */
+	FPF2EncounterCharacterStates GetCurrentStatesOfCharacter(
+		const TScriptInterface<IPF2CharacterInterface>& Character) const;
+
+	/**
+	 * Starts tracking changes to the hit points of a character, so that the character state index stays up to date.
+	 *
+	 * This has no effect if the hit points of the character are already being tracked.
+	 *
+	 * @param Character
+	 *	The character whose hit points should be tracked.
+	 */
+	void RegisterHitPointsCallback(const TScriptInterface<IPF2CharacterInterface>& Character);
+
+	/**
+	 * Stops tracking changes to the hit points of a character.
+	 *
+	 * This has no effect if the hit points of the character are not being tracked. If the character has been garbage
+	 * collected, its callback is forgotten without having to be unbound.
+	 *
+	 * @param CharacterPtr
+	 *	A weak pointer to the character whose hit points should no longer be tracked.
+	 */
+	void UnregisterHitPointsCallback(const TWeakObjectPtr<AActor>& CharacterPtr);
+
+	/**
+	 * Stops tracking changes to the hit points of every character.
+	 */
+	void UnregisterAllHitPointsCallbacks();
+
+	/**
+	 * Callback invoked when the hit points of a character in the encounter have changed.
+	 *
+	 * @param ChangeData
+	 *	Information about the change in hit points.
+	 * @param CharacterPtr
+	 *	A weak pointer to the character whose hit points changed.
+	 */
+	void OnCharacterHitPointsChanged(const FOnAttributeChangeData& ChangeData, TWeakObjectPtr<AActor> CharacterPtr);
+
+	/**
+	 * Plans the next turn of every NPC in the encounter, replacing any existing plans.
+	 *
+	 * The state of the encounter is captured on the game thread, and then the AI controller of each NPC evaluates its
+	 * options against that snapshot on a worker thread. This call returns once all NPCs have been planned.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Mode of Play Rule Sets|Encounters")
+	void PlanNonPlayerTurns();
+
+	/**
+	 * Determines whether the planned turns of NPCs still reflect the state of the encounter.
+	 *
+	 * @return
+	 *	- true if turns have been planned and nothing relevant to the plans has changed since, including the locations
+	 *	  of the characters in the encounter.
+	 *	- false if turns need to be planned again before they are used.
+	 */
+	bool ArePlannedTurnsCurrent() const;
+
+	/**
+	 * Discards the planned turns of all NPCs, so that they are re-planned before they are next needed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Mode of Play Rule Sets|Encounters")
+	void InvalidatePlannedTurns();
+
+	/**
+	 * Gets the character that an NPC was planning to act against on its next turn.
+	 *
+	 * @param Character
+	 *	The NPC whose plan is desired.
+	 * @param bHasPlan
+	 *	Set to true if a plan was available for the NPC; or, false if the NPC has not been planned.
+	 *
+	 * @return
+	 *	The character the NPC intends to target.
+	 */
+	UFUNCTION(BlueprintCallable, Category="OpenPF2|Mode of Play Rule Sets|Encounters")
+	TScriptInterface<IPF2CharacterInterface> GetPlannedTargetForCharacter(
+		const TScriptInterface<IPF2CharacterInterface>& Character,
+		bool&                                           bHasPlan) const;
+
+	/**
+	 * Captures a read-only copy of the state of the given characters, for turn planning.
+	 *
+	 * @param Characters
+	 *	The characters to capture.
+	 *
+	 * @return
+	 *	A snapshot that contains the state of each character, in the same order as the given characters.
+	 */
+	FPF2EncounterSnapshot CaptureEncounterSnapshot(
+		const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters) const;
+
 	/**
 	 * Sets the character whose turn it is.
 	 *
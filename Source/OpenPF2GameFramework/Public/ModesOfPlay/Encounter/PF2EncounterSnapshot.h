@@ -0,0 +1,118 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayTagContainer.h>
+
+#include <UObject/WeakInterfacePtr.h>
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class IPF2CharacterInterface;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * A read-only copy of the state of a single character in an encounter, captured for turn planning.
+ *
+ * Snapshots are captured on the game thread and then read from worker threads, so they hold copies of everything that
+ * planning needs rather than references to the character's components.
+ */
+struct OPENPF2GAMEFRAMEWORK_API FPF2EncounterCharacterSnapshot
+{
+	/**
+	 * The character that this snapshot describes.
+	 *
+	 * This is only for identifying the character; it must not be resolved off of the game thread.
+	 */
+	TWeakInterfacePtr<IPF2CharacterInterface> Character;
+
+	/**
+	 * The location of the character in the world.
+	 */
+	FVector Location;
+
+	/**
+	 * The current hit points of the character.
+	 */
+	float HitPoints;
+
+	/**
+	 * The maximum hit points of the character.
+	 */
+	float MaxHitPoints;
+
+	/**
+	 * The armor class (AC) of the character.
+	 */
+	float ArmorClass;
+
+	/**
+	 * All of the gameplay tags that the character had (e.g., conditions, traits, proficiencies, etc.).
+	 */
+	FGameplayTagContainer OwnedTags;
+
+	/**
+	 * Whether the character had hit points remaining.
+	 */
+	bool bIsAlive;
+
+	/**
+	 * Whether the character was controlled by a player.
+	 */
+	bool bIsPlayerControlled;
+
+	/**
+	 * Default constructor for FPF2EncounterCharacterSnapshot.
+	 */
+	explicit FPF2EncounterCharacterSnapshot() :
+		Location(FVector::ZeroVector),
+		HitPoints(0.0f),
+		MaxHitPoints(0.0f),
+		ArmorClass(0.0f),
+		bIsAlive(false),
+		bIsPlayerControlled(false)
+	{
+	}
+};
+
+/**
+ * A read-only copy of the state of every character in an encounter, captured for turn planning.
+ */
+struct OPENPF2GAMEFRAMEWORK_API FPF2EncounterSnapshot
+{
+	/**
+	 * The state of each character in the encounter, in initiative order.
+	 */
+	TArray<FPF2EncounterCharacterSnapshot> Characters;
+};
+
+/**
+ * The result of planning the next encounter turn of a character.
+ */
+struct OPENPF2GAMEFRAMEWORK_API FPF2AITurnPlan
+{
+	/**
+	 * The character that the planning character intends to act against.
+	 *
+	 * This is only for identifying the character; it must not be resolved off of the game thread.
+	 */
+	TWeakInterfacePtr<IPF2CharacterInterface> TargetCharacter;
+
+	/**
+	 * How desirable the plan was judged to be, relative to the other candidates that were evaluated.
+	 */
+	float Score;
+
+	/**
+	 * Default constructor for FPF2AITurnPlan.
+	 */
+	explicit FPF2AITurnPlan() : Score(0.0f)
+	{
+	}
+};
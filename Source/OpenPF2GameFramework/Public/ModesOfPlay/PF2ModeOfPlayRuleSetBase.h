@@ -15,6 +15,70 @@
 
 #include "PF2ModeOfPlayRuleSetBase.generated.h"
 
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class UAbilitySystemComponent;
+
+// =====================================================================================================================
+// Normal Declarations - Delegates
+// =====================================================================================================================
+/**
+ * Delegate for a MoPRS to react to a condition tag having been added to or removed from a character.
+ *
+ * @param Character
+ *	The character whose tags changed.
+ */
+DECLARE_DELEGATE_OneParam(
+	FPF2CharacterTagCallbackDelegate,
+	const TScriptInterface<IPF2CharacterInterface>& /* Character */
+);
+
+// =====================================================================================================================
+// Normal Declarations - Types
+// =====================================================================================================================
+/**
+ * The callbacks that a MoPRS invokes when a particular tag is added to or removed from a character.
+ */
+struct FPF2TagCallbackBinding
+{
+	/**
+	 * The tag to react to.
+	 */
+	FGameplayTag Tag;
+
+	/**
+	 * The callback to invoke when the tag has been added. May be unbound.
+	 */
+	FPF2CharacterTagCallbackDelegate OnTagAdded;
+
+	/**
+	 * The callback to invoke when the tag has been removed. May be unbound.
+	 */
+	FPF2CharacterTagCallbackDelegate OnTagRemoved;
+};
+
+/**
+ * A character for which a MoPRS has registered tag callbacks.
+ */
+struct FPF2TagCallbackCharacter
+{
+	/**
+	 * The character, as an actor.
+	 */
+	TWeakObjectPtr<AActor> CharacterPtr;
+
+	/**
+	 * The ASC of the character, to which the tag change delegate of the MoPRS is bound.
+	 */
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+
+	/**
+	 * The handle of the tag change delegate that is bound to the ASC of the character.
+	 */
+	FDelegateHandle DelegateHandle;
+};
+
 /**
  * Default base class for OpenPF2 Mode of Play Rule Sets (MoPRS).
  *
@@ -72,9 +136,48 @@ protected:
 	FGameplayTag UnconsciousConditionTag;
 
 	/**
-	 * Map of handles for callback delegates on condition tags.
+	 * The tags to which this MoPRS reacts, along with the callbacks to invoke for each one.
+	 *
+	 * The position of each binding in this array is the "tag index" of its tag in EnabledTagCallbacks.
+	 */
+	TArray<FPF2TagCallbackBinding> TagCallbackBindings;
+
+	/**
+	 * Map from each tag in TagCallbackBindings to its tag index.
+	 */
+	TMap<FGameplayTag, int32> TagCallbackIndicesByTag;
+
+	/**
+	 * The characters for which tag callbacks have been registered.
+	 *
+	 * The position of each character in this array is the "character index" of the character in EnabledTagCallbacks.
+	 * The slots of characters whose callbacks have been unregistered are left empty for reuse.
 	 */
-	TMap<const TWeakObjectPtr<AActor>, TMap<FGameplayTag, FDelegateHandle>> ConditionCallbackHandles;
+	TArray<FPF2TagCallbackCharacter> TagCallbackCharacters;
+
+	/**
+	 * The character indices of empty slots in TagCallbackCharacters.
+	 */
+	TArray<int32> FreeTagCallbackCharacterIndices;
+
+	/**
+	 * Map from each character in TagCallbackCharacters to its character index.
+	 */
+	TMap<TWeakObjectPtr<AActor>, int32> TagCallbackCharacterIndicesByActor;
+
+	/**
+	 * A flat table of the tag callbacks that are active for each character.
+	 *
+	 * The bit for a given character and tag is at (character index * number of tag bindings) + tag index.
+	 */
+	TBitArray<> EnabledTagCallbacks;
+
+	/**
+	 * Whether this MoPRS has been suspended by the game mode and not yet resumed.
+	 *
+	 * No characters are tracked while suspended, but the tag callback tables stay allocated for reuse once resumed.
+	 */
+	bool bIsSuspended;
 
 public:
 	// =================================================================================================================
@@ -98,6 +201,10 @@ public:
 
 	virtual void OnModeOfPlayEnd(const EPF2ModeOfPlayType ModeOfPlay) override;
 
+	virtual void OnModeSuspended(const EPF2ModeOfPlayType ModeOfPlay) override;
+
+	virtual void OnModeResumed(const EPF2ModeOfPlayType ModeOfPlay) override;
+
 	virtual EPF2CommandExecuteOrQueueResult AttemptToExecuteOrQueueCommand_Implementation(
 		const TScriptInterface<IPF2CharacterCommandInterface>& Command) override;
 
@@ -107,56 +214,118 @@ public:
 	virtual void AttemptToCancelCommand_Implementation(
 		const TScriptInterface<IPF2CharacterCommandInterface>& Command) override;
 
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Determines whether this MoPRS has been suspended by the game mode.
+	 *
+	 * @return
+	 *	- true if this MoPRS has been suspended and not yet resumed.
+	 *	- false if this MoPRS is active, or has never been suspended.
+	 */
+	FORCEINLINE bool IsSuspended() const
+	{
+		return this->bIsSuspended;
+	}
+
 protected:
 	// =================================================================================================================
 	// Protected Methods
 	// =================================================================================================================
 	/**
-	 * Registers callbacks to invoke when a tag is added or removed from the specified character.
+	 * Notifies this rule set that several characters have been added to the current encounter at once.
 	 *
-	 * If the character has been garbage collected, this method has no effect.
+	 * OnCharacterAddedToEncounter() is equivalent to calling this with a single character, so sub-classes that need to
+	 * react to characters joining the encounter should override this method rather than that one. Tag callbacks for
+	 * the entire batch are registered at once.
+	 *
+	 * @param Characters
+	 *	The characters being added to the encounter.
+	 */
+	virtual void OnCharactersAddedToEncounter(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters);
+
+	/**
+	 * Notifies this rule set that several characters have been removed from the current encounter at once.
+	 *
+	 * OnCharacterRemovedFromEncounter() is equivalent to calling this with a single character, so sub-classes that
+	 * need to react to characters leaving the encounter should override this method rather than that one. Tag callbacks
+	 * for the entire batch are unregistered at once.
+	 *
+	 * @param Characters
+	 *	The characters being removed from the encounter.
+	 */
+	virtual void OnCharactersRemovedFromEncounter(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters);
+
+	/**
+	 * Binds callbacks to invoke when a tag is added to or removed from any character tracked by this MoPRS.
+	 *
+	 * This must be called before callbacks are registered for any character (e.g., from a constructor).
 	 *
-	 * @param CharacterPtr
-	 *	A weak pointer to the character for which a callback will be registered.
 	 * @param Tag
 	 *	The tag to react to.
 	 * @param OnTagAdded
-	 *	The callback to invoke when the tag has been added.
+	 *	The callback to invoke when the tag has been added. May be unbound.
 	 * @param OnTagRemoved
-	 *	The callback to invoke when the tag has been removed.
+	 *	The callback to invoke when the tag has been removed. May be unbound.
 	 */
-	void RegisterTagCallback(
-		const TWeakObjectPtr<AActor>      CharacterPtr,
-		const FGameplayTag&               Tag,
-		void (APF2ModeOfPlayRuleSetBase::*OnTagAdded)(const TScriptInterface<IPF2CharacterInterface>&),
-		void (APF2ModeOfPlayRuleSetBase::*OnTagRemoved)(const TScriptInterface<IPF2CharacterInterface>&));
+	void BindTagCallback(const FGameplayTag&                     Tag,
+	                     const FPF2CharacterTagCallbackDelegate& OnTagAdded,
+	                     const FPF2CharacterTagCallbackDelegate& OnTagRemoved);
 
 	/**
-	 * Unregisters all tag callbacks for the specified character.
-	 *
-	 * If the character has been garbage collected, this method has no effect.
+	 * Determines whether tag callbacks have been registered for the specified character.
 	 *
 	 * @param CharacterPtr
-	 *	A weak pointer to the character for which callbacks are being unregistered.
+	 *	A weak pointer to the character of interest.
+	 *
+	 * @return
+	 *	- true if callbacks have been registered for the character.
+	 *	- false if callbacks have not been registered for the character.
 	 */
-	void UnregisterAllTagCallbacksForCharacter(const TWeakObjectPtr<AActor> CharacterPtr);
+	FORCEINLINE bool HasTagCallbacksForCharacter(const TWeakObjectPtr<AActor> CharacterPtr) const
+	{
+		return this->TagCallbackCharacterIndicesByActor.Contains(CharacterPtr);
+	}
 
 	/**
-	 * Unregisters callbacks from being invoked when a tag is added or removed from the specified character.
+	 * Registers all bound tag callbacks for each of the specified characters.
 	 *
-	 * If the character has been garbage collected, this method has no effect.
+	 * A single delegate is bound to the ASC of each character, which dispatches to the callbacks of each tag.
+	 * Characters that already have callbacks registered are skipped.
+	 *
+	 * @param Characters
+	 *	The characters for which callbacks will be registered.
+	 */
+	void RegisterTagCallbacks(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters);
+
+	/**
+	 * Unregisters all tag callbacks for each of the specified characters.
+	 *
+	 * Characters that do not have callbacks registered are skipped. If a character has been garbage collected, its
+	 * callbacks are forgotten without having to be unbound.
+	 *
+	 * @param CharacterPtrs
+	 *	Weak pointers to the characters for which callbacks are being unregistered.
+	 */
+	void UnregisterTagCallbacks(const TArray<TWeakObjectPtr<AActor>>& CharacterPtrs);
+
+	/**
+	 * Unregisters the tag callbacks of every character.
+	 */
+	void UnregisterAllTagCallbacks();
+
+	/**
+	 * Dispatches a change in the tags of a tracked character to the callbacks bound for the tag.
 	 *
-	 * @param CharacterPtr
-	 *	A weak pointer to the character for which a callback will be unregistered.
 	 * @param Tag
-	 *	The tag to no longer react to.
-	 * @param DelegateHandle
-	 *	The handle to unregister.
+	 *	The tag that was added or removed.
+	 * @param NewCount
+	 *	The new count of the tag on the character.
+	 * @param CharacterIndex
+	 *	The character index of the character whose tags changed.
 	 */
-	void UnregisterTagCallback(
-		const TWeakObjectPtr<AActor> CharacterPtr,
-		const FGameplayTag&          Tag,
-		const FDelegateHandle&       DelegateHandle);
+	void OnTrackedCharacterTagChanged(const FGameplayTag Tag, const int32 NewCount, const int32 CharacterIndex);
 
 	// =================================================================================================================
 	// Native Events
@@ -384,6 +553,42 @@ protected:
 	)
 	void BP_OnModeOfPlayEnd(EPF2ModeOfPlayType ModeOfPlay);
 
+	/**
+	 * Callback to notify this rule set that it is being deactivated, but will be kept for reuse when its mode of play
+	 * becomes active again.
+	 *
+	 * This is only invoked if the game mode persists rule sets across changes in mode of play. By the time this event
+	 * fires, the native implementation has removed every character from the encounter (invoking On Character Removed
+	 * from Encounter for each) and has invoked On Mode of Play End, so nothing from the current session of the mode
+	 * carries over into the next one.
+	 *
+	 * @param ModeOfPlay
+	 *	The mode of play that is being suspended.
+	 */
+	UFUNCTION(
+		BlueprintImplementableEvent,
+		Category="OpenPF2|Mode of Play Rule Sets",
+		meta=(DisplayName="On Mode Suspended")
+	)
+	void BP_OnModeSuspended(EPF2ModeOfPlayType ModeOfPlay);
+
+	/**
+	 * Callback to notify this rule set that the mode of play that invoked it is active again after being suspended.
+	 *
+	 * This is only invoked if the game mode persists rule sets across changes in mode of play. By the time this event
+	 * fires, the native implementation has already invoked On Mode of Play Start, so any setup done there runs every
+	 * time the mode becomes active.
+	 *
+	 * @param ModeOfPlay
+	 *	The mode of play that is resuming.
+	 */
+	UFUNCTION(
+		BlueprintImplementableEvent,
+		Category="OpenPF2|Mode of Play Rule Sets",
+		meta=(DisplayName="On Mode Resumed")
+	)
+	void BP_OnModeResumed(EPF2ModeOfPlayType ModeOfPlay);
+
 	// =================================================================================================================
 	// Protected Methods
 	// =================================================================================================================
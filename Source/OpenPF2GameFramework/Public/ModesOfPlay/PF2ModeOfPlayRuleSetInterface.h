@@ -29,8 +29,9 @@ class UPF2ModeOfPlayRuleSetInterface : public UInterface
  * MoPRS not only provide logic that control how different gameplay events are handled, but also can act as an extension
  * to game state by storing and maintaining variables that are relevant for the current mode of play. For example,
  * encounter modes maintain initiative order, number of enemies left standing, etc. which are not relevant in other game
- * modes like exploration mode. A new MoPRS instance is created each time that the mode of play changes, so this state
- * is only maintained while it is relevant.
+ * modes like exploration mode. By default, a new MoPRS instance is created each time that the mode of play changes, so
+ * this state is only maintained while it is relevant. If the game mode has been configured to persist rule sets, each
+ * MoPRS is instead created only once per world and is suspended and resumed as the mode of play changes.
  *
  * @see EPF2ModeOfPlayType
  */
@@ -98,6 +99,32 @@ public:
 	 */
 	virtual void OnModeOfPlayEnd(const EPF2ModeOfPlayType ModeOfPlay) = 0;
 
+	/**
+	 * Callback to notify this rule set that it is being deactivated, but will be kept for reuse when its mode of play
+	 * becomes active again.
+	 *
+	 * This is only invoked if the game mode persists rule sets across changes in mode of play. It is invoked instead of
+	 * OnModeOfPlayEnd(), and should wrap-up the mode the same way, except that allocations that can be reused the next
+	 * time the mode is active may be kept. No characters or other state from the current session of the mode should
+	 * carry over after it has been resumed.
+	 *
+	 * @param ModeOfPlay
+	 *	The mode of play that is being suspended.
+	 */
+	virtual void OnModeSuspended(const EPF2ModeOfPlayType ModeOfPlay) = 0;
+
+	/**
+	 * Callback to notify this rule set that the mode of play that invoked it is active again after being suspended.
+	 *
+	 * This is only invoked if the game mode persists rule sets across changes in mode of play. It is invoked instead of
+	 * OnModeOfPlayStart() every time the mode of play becomes active after the first, and should start the mode the
+	 * same way.
+	 *
+	 * @param ModeOfPlay
+	 *	The mode of play that is resuming.
+	 */
+	virtual void OnModeResumed(const EPF2ModeOfPlayType ModeOfPlay) = 0;
+
 	/**
 	 * Notifies this rule set that a character wishes to perform a command (e.g., use an ability).
 	 *
@@ -12,6 +12,8 @@
 
 #include "PF2AIControllerInterface.h"
 
+#include "ModesOfPlay/Encounter/PF2EncounterSnapshot.h"
+
 #include "PF2AIControllerBase.generated.h"
 
 // =====================================================================================================================
@@ -33,4 +35,32 @@ public:
 	// Public Methods - IPF2LogIdentifiableInterface Implementation
 	// =================================================================================================================
 	virtual FString GetIdForLogs() const override;
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Evaluates candidate actions for the next encounter turn of the character that this controller is controlling.
+	 *
+	 * This is invoked on a worker thread, in parallel with the planning of other characters, when an encounter plans
+	 * turns in advance. Implementations must only read from the given snapshot; they must not access this controller,
+	 * the character, or any other UObject, and must not modify any shared state.
+	 *
+	 * The default implementation targets the closest living character on the opposing side (player-controlled vs.
+	 * non-player-controlled), preferring the character with the fewest hit points when two are equally close.
+	 *
+	 * @param Snapshot
+	 *	A read-only copy of the state of every character in the encounter.
+	 * @param CharacterIndex
+	 *	The index in the snapshot of the character whose turn is being planned.
+	 * @param OutPlan
+	 *	The plan for the turn of the character.
+	 *
+	 * @return
+	 *	- true if a plan was made.
+	 *	- false if there was nothing worth planning for the character (e.g., there are no opponents left).
+	 */
+	virtual bool PlanEncounterTurn(const FPF2EncounterSnapshot& Snapshot,
+	                               const int32                  CharacterIndex,
+	                               FPF2AITurnPlan&              OutPlan) const;
 };
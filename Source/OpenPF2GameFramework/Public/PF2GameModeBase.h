@@ -49,6 +49,25 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="OpenPF2 - Game Modes")
 	TMap<EPF2ModeOfPlayType, TSubclassOf<APF2ModeOfPlayRuleSetBase>> ModeRuleSets;
 
+	/**
+	 * Whether rule sets should be kept alive when the mode of play changes.
+	 *
+	 * If false (the default), a new rule set is created every time the mode of play changes and the rule set of the
+	 * previous mode is destroyed. If true, the rule set for each mode of play is created only once per world; the rule
+	 * set of the previous mode is suspended instead of being destroyed, and then resumed the next time that its mode of
+	 * play becomes active.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="OpenPF2 - Game Modes")
+	bool bPersistModeOfPlayRuleSets;
+
+	/**
+	 * Map from Modes of Play to the Rule Set that has been created for each mode.
+	 *
+	 * This is only populated if bPersistModeOfPlayRuleSets is true.
+	 */
+	UPROPERTY()
+	TMap<EPF2ModeOfPlayType, TScriptInterface<IPF2ModeOfPlayRuleSetInterface>> PersistentModeRuleSets;
+
 public:
 	// =================================================================================================================
 	// Public Methods - IPF2GameModeInterface Implementation
@@ -190,8 +209,30 @@ protected:
 	 *
 	 * All player controllers are notified of the change in mode via game state replication.
 	 *
+	 * If rule sets are being persisted, the rule set of the current mode is suspended rather than ended, and the rule
+	 * set of the new mode is resumed if it has been active before.
+	 *
 	 * @param NewModeOfPlay
 	 *	The mode of play to switch to.
 	 */
 	void ForceSwitchModeOfPlay(const EPF2ModeOfPlayType NewModeOfPlay);
+
+protected:
+	// =================================================================================================================
+	// Protected Methods
+	// =================================================================================================================
+	/**
+	 * Gets the persistent rule set for the given mode of play, creating it if it has not yet been created.
+	 *
+	 * @param ModeOfPlay
+	 *	The mode of play for which a rule set is desired.
+	 * @param bOutWasCreated
+	 *	Set to true if the rule set was created by this call; or, false if it already existed.
+	 *
+	 * @return
+	 *	The rule set for the mode of play; or, an empty interface if there is no rule set configured for the mode.
+	 */
+	TScriptInterface<IPF2ModeOfPlayRuleSetInterface> FindOrCreatePersistentModeOfPlayRuleSet(
+		const EPF2ModeOfPlayType ModeOfPlay,
+		bool&                    bOutWasCreated);
 };
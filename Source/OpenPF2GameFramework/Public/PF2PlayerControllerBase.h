@@ -36,6 +36,17 @@ class OPENPF2GAMEFRAMEWORK_API APF2PlayerControllerBase : public APlayerControll
 {
 	GENERATED_BODY()
 
+public:
+	// =================================================================================================================
+	// Public Constants
+	// =================================================================================================================
+	/**
+	 * The maximum number of commands that a client can submit in a single call to Server_ExecuteCharacterCommands().
+	 *
+	 * Larger batches are rejected in their entirety without disconnecting the client.
+	 */
+	static const int32 MaxCommandsPerBatch;
+
 protected:
 	// =================================================================================================================
 	// Protected Fields
@@ -111,7 +122,13 @@ public:
 		const FGameplayEventData&        AbilityPayload) override;
 
 	UFUNCTION(Server, Reliable, WithValidation)
-	virtual void Server_CancelCharacterCommand(AInfo* Command) override;
+	virtual void Server_ExecuteCharacterCommands(const TArray<FPF2CharacterCommandDescriptor>& Commands) override;
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	virtual void Server_CancelCharacterCommand(AInfo* Command, const int32 CommandGeneration) override;
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	virtual void Server_CancelQueuedCharacterCommand(AActor* CharacterActor, const int32 CommandId) override;
 
 	UFUNCTION(NetMulticast, Reliable)
 	virtual void Multicast_OnEncounterTurnStarted() override;
@@ -149,6 +166,38 @@ protected:
 	 */
 	bool IsControllableCharacterPawn(AActor* CharacterActor) const;
 
+	/**
+	 * Determines whether a request from a client refers to an earlier use of a command that has since been recycled.
+	 *
+	 * @param Command
+	 *	The command that the request refers to.
+	 * @param CommandGeneration
+	 *	The generation of the command that the client observed when it sent the request.
+	 *
+	 * @return
+	 *	- true if the command is a pooled command that has been released since the client observed it.
+	 *	- false if the request refers to the current use of the command, or the command is not pooled.
+	 */
+	static bool IsStaleCommandRequest(const AInfo* Command, const int32 CommandGeneration);
+
+	/**
+	 * Creates a command for the given character and ability, then either executes it or queues it. (Server only).
+	 *
+	 * The character must already have been validated as controllable by this player controller.
+	 *
+	 * This is virtual so that tests can observe the commands that a player controller executes.
+	 *
+	 * @param CharacterActor
+	 *	The character upon which the ability should be activated. The given actor must implement IPF2CharacterInterface.
+	 * @param AbilitySpecHandle
+	 *	The handle for the ability to wrap in the command.
+	 * @param AbilityPayload
+	 *	The payload to pass to the ability when it is executed.
+	 */
+	virtual void ExecuteAbilitySpecAsCharacterCommand(AActor*                          CharacterActor,
+	                                                  const FGameplayAbilitySpecHandle AbilitySpecHandle,
+	                                                  const FGameplayEventData&        AbilityPayload);
+
 	/**
 	 * Gets the enhanced input component of this player controller.
 	 *
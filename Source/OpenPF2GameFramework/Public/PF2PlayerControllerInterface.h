@@ -9,6 +9,8 @@
 
 #include <GameFramework/Info.h>
 
+#include "Commands/PF2CharacterCommandDescriptor.h"
+
 #include "ModesOfPlay/PF2ModeOfPlayType.h"
 
 #include "Utilities/PF2LogIdentifiableInterface.h"
@@ -203,6 +205,26 @@ public:
 		AActor*                          CharacterActor,
 		const FGameplayEventData&        AbilityPayload) = 0;
 
+	/**
+	 * Requests that the server execute or queue several commands at once for characters this player controller can
+	 * control.
+	 *
+	 * This is equivalent to calling Server_ExecuteAbilitySpecAsCharacterCommandWithPayload() once for each command, but
+	 * uses only a single RPC. Commands are executed or queued in the order they appear in the array.
+	 *
+	 * The entire batch is rejected if:
+	 * - Any command targets a character that this player controller cannot control. This is treated as cheating, so
+	 *   the client is also disconnected.
+	 * - The batch contains more commands than the server allows (see APF2PlayerControllerBase::MaxCommandsPerBatch).
+	 *   An error is logged on the server but the client remains connected, and none of the commands are executed or
+	 *   queued.
+	 *
+	 * @param Commands
+	 *	Descriptions of the commands to execute or queue.
+	 */
+	UFUNCTION(BlueprintCallable, Server, Reliable, Category="OpenPF2|Player Controllers")
+	virtual void Server_ExecuteCharacterCommands(const TArray<FPF2CharacterCommandDescriptor>& Commands) = 0;
+
 	/**
 	 * Requests to cancel a command on the server for one of the characters this player controller can control.
 	 *
@@ -211,12 +233,33 @@ public:
 	 * instead of as an interface reference because UE will not replicate actors if they are declared/referenced through
 	 * an interface property.
 	 *
+	 * Command actors are pooled and reused, so by the time this request reaches the server, the command may have been
+	 * recycled for another character or destroyed. Such stale requests are ignored rather than treated as invalid.
+	 *
 	 * @param Command
 	 *	The command that should be cancelled. The given actor must implement the
 	 *	IPF2CharacterCommandInterface interface.
+	 * @param CommandGeneration
+	 *	The generation of the command that the client observed (see APF2CharacterCommand::GetGeneration()). This is
+	 *	ignored for commands that are not APF2CharacterCommands.
+	 */
+	UFUNCTION(BlueprintCallable, Server, Reliable, Category="OpenPF2|Player Controllers")
+	virtual void Server_CancelCharacterCommand(AInfo* Command, const int32 CommandGeneration) = 0;
+
+	/**
+	 * Requests to cancel a queued command, by ID, on the server for one of the characters this player controller can
+	 * control.
+	 *
+	 * This is used instead of Server_CancelCharacterCommand() when the command queue of the character uses lightweight
+	 * replication, since clients only have local copies of queued commands in that case.
+	 *
+	 * @param CharacterActor
+	 *	The character whose command queue contains the command. The given actor must implement IPF2CharacterInterface.
+	 * @param CommandId
+	 *	The ID of the command in the command queue of the character.
 	 */
 	UFUNCTION(BlueprintCallable, Server, Reliable, Category="OpenPF2|Player Controllers")
-	virtual void Server_CancelCharacterCommand(AInfo* Command) = 0;
+	virtual void Server_CancelQueuedCharacterCommand(AActor* CharacterActor, const int32 CommandId) = 0;
 
 	// =================================================================================================================
 	// Public Event Notifications from the Game Mode
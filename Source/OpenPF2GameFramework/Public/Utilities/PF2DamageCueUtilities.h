@@ -0,0 +1,58 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayEffectTypes.h>
+#include <GameplayTagContainer.h>
+
+/**
+ * Utility logic for packing the damage of several types into the parameters of a single "inflict damage" cue.
+ *
+ * A coalesced cue carries:
+ * - The tag of each type of damage that was inflicted, in AggregatedSourceTags.
+ * - The total amount of damage inflicted, in RawMagnitude.
+ * - When more than one type of damage was inflicted, the amount of each type as a 16-bit integer "lane". The lanes
+ *   are packed into GameplayEffectLevel and AbilityLevel, which therefore do not hold levels for such cues. Lanes are
+ *   ordered by the index of each damage type in FPF2AttackAttributeStatics::GetAllDamageCaptures(), so the damage
+ *   types do not need to replicate in any particular order.
+ *
+ * A cue that carries only one type of damage is identical to the cue that is emitted per type of damage when damage
+ * cues are not being coalesced, so UnpackDamageByType() works for cues emitted in either mode.
+ */
+namespace PF2DamageCueUtilities
+{
+	/**
+	 * The largest number of damage types that can be packed into the parameters of a single gameplay cue.
+	 */
+	constexpr int32 MaxDamageTypesPerCue = 4;
+
+	/**
+	 * Packs the damage of up to MaxDamageTypesPerCue types into the given gameplay cue parameters.
+	 *
+	 * Amounts are rounded to the nearest whole number and clamped to [0, 65535] when more than one type of damage is
+	 * being packed. The total in RawMagnitude is never rounded.
+	 *
+	 * @param DamageByType
+	 *	The damage type tag and amount of each type of damage to pack. Tags that are not damage types are ignored.
+	 * @param OutCueParameters
+	 *	The parameters of the gameplay cue into which the damage is packed.
+	 */
+	OPENPF2GAMEFRAMEWORK_API void PackDamageByType(
+		const TConstArrayView<TPair<FGameplayTag, float>>& DamageByType,
+		FGameplayCueParameters&                            OutCueParameters);
+
+	/**
+	 * Unpacks the damage of each type from the parameters of an "inflict damage" gameplay cue.
+	 *
+	 * @param CueParameters
+	 *	The parameters of the gameplay cue from which damage is being unpacked.
+	 *
+	 * @return
+	 *	A map from the tag of each type of damage that the cue carries to the amount of that type of damage. This is
+	 *	empty for a cue that reports a miss (i.e., no damage).
+	 */
+	OPENPF2GAMEFRAMEWORK_API TMap<FGameplayTag, float> UnpackDamageByType(const FGameplayCueParameters& CueParameters);
+}
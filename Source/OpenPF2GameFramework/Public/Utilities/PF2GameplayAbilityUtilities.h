@@ -111,6 +111,8 @@ namespace PF2GameplayAbilityUtilities
 	 * If the GE does not define a default weight group, PF2CharacterConstants::GeWeightGroups::PreAbilityBoosts is
 	 * returned.
 	 *
+	 * The weight group of each GE class is resolved only once and then cached (see FPF2WeightGroupRegistry).
+	 *
 	 * @param GameplayEffect
 	 *	The effect for which a weight group is desired.
 	 * @param DefaultWeight
@@ -124,6 +126,29 @@ namespace PF2GameplayAbilityUtilities
 		const FName DefaultWeight = PF2CharacterConstants::GeWeightGroups::PreAbilityBoosts
 	);
 
+	/**
+	 * Gets the tags that the given GE checks for when it is applied or when its modifiers are calculated.
+	 *
+	 * This covers the application, ongoing, and removal tag requirements of the GE; the tag requirements of its
+	 * modifiers and of the scoped modifiers of its executions; the source and target tag filters of any attribute-based
+	 * magnitudes; the requirements of any conditional GEs it applies (see
+	 * UPF2AdvancedAdditionalEffectsGameplayEffectComponent); and the tags that its MMCs and executions declare through
+	 * IPF2TagDependentCalculationInterface.
+	 *
+	 * @param [in] GameplayEffect
+	 *	The effect for which queried tags are desired.
+	 * @param [out] OutQueriedTags
+	 *	A reference to the container to which all of the tags that the GE is known to check are appended.
+	 *
+	 * @return
+	 *	- true if all of the tags that the GE can check are known.
+	 *	- false if the GE uses a calculation that does not implement IPF2TagDependentCalculationInterface. Such a GE
+	 *	  must be assumed to depend on every tag.
+	 */
+	OPENPF2GAMEFRAMEWORK_API bool GetTagsQueriedByGameplayEffect(
+		const TSubclassOf<UGameplayEffect> GameplayEffect,
+		FGameplayTagContainer&             OutQueriedTags);
+
 	/**
 	 * Gets the ASC of the given actor, as an implementation of IPF2CharacterAbilitySystemInterface.
 	 *
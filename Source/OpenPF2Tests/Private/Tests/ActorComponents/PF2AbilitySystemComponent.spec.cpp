@@ -0,0 +1,375 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "PF2CharacterConstants.h"
+
+#include "Actors/Components/PF2AbilitySystemComponent.h"
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestGameplayEffect.h"
+#include "Tests/PF2TestTagDependentCalculation.h"
+#include "Tests/PF2TestTagDependentGameplayEffect.h"
+
+#include "Utilities/PF2GameplayAbilityUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2AbilitySystemComponentSpec,
+                     "OpenPF2.AbilitySystemComponent",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	/**
+	 * A weight group containing a passive GE that does not depend on any tags.
+	 */
+	const FName EarlyWeightGroup = PF2CharacterConstants::GeWeightGroups::PreAbilityBoosts;
+
+	/**
+	 * A weight group containing a passive GE that depends on UPF2TestTagDependentCalculation::QueriedTagName.
+	 */
+	const FName DependentWeightGroup = PF2CharacterConstants::GeWeightGroups::PreFinalizeStats;
+
+	/**
+	 * A weight group after DependentWeightGroup containing a passive GE that does not depend on any tags.
+	 */
+	const FName LateWeightGroup = PF2CharacterConstants::GeWeightGroups::FinalizeStats;
+
+	UPF2AbilitySystemComponent* PassiveAsc;
+	TMap<FName, int32>          ApplicationCounts;
+
+	void SetupPassiveAsc();
+	FActiveGameplayEffectHandle FindPassiveEffectHandle(const TSubclassOf<UGameplayEffect>& Effect,
+	                                                    const FName                         WeightGroup) const;
+	TArray<FActiveGameplayEffectHandle> FindPassiveEffectHandles(const TSubclassOf<UGameplayEffect>& Effect,
+	                                                             const FName                         WeightGroup) const;
+END_DEFINE_PF_SPEC(FPF2AbilitySystemComponentSpec)
+
+void FPF2AbilitySystemComponentSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+		this->SetupTestPawn();
+		this->SetupPassiveAsc();
+	});
+
+	AfterEach([=, this]
+	{
+		this->PassiveAsc = nullptr;
+
+		this->DestroyTestPawn();
+		this->DestroyWorld();
+	});
+
+	Describe("AddDynamicTag", [=, this]
+	{
+		Describe("when a passive GE depends on the tag", [=, this]
+		{
+			It("re-applies the weight group of that GE and all weight groups after it", [=, this]
+			{
+				this->PassiveAsc->AddDynamicTag(
+					FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+				);
+
+				TestEqual(
+					"Applications of DependentWeightGroup",
+					this->ApplicationCounts[this->DependentWeightGroup],
+					1
+				);
+				TestEqual("Applications of LateWeightGroup", this->ApplicationCounts[this->LateWeightGroup], 1);
+			});
+
+			It("leaves weight groups before the affected weight group untouched", [=, this]
+			{
+				const FActiveGameplayEffectHandle OldHandle =
+					this->FindPassiveEffectHandle(UPF2TestGameplayEffect::StaticClass(), this->EarlyWeightGroup);
+
+				this->PassiveAsc->AddDynamicTag(
+					FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+				);
+
+				TestEqual("Applications of EarlyWeightGroup", this->ApplicationCounts[this->EarlyWeightGroup], 0);
+
+				TestTrue(
+					"Handle of GE in EarlyWeightGroup is unchanged",
+					this->FindPassiveEffectHandle(UPF2TestGameplayEffect::StaticClass(), this->EarlyWeightGroup) ==
+					OldHandle
+				);
+			});
+
+			It("re-evaluates the GE that depends on the tag", [=, this]
+			{
+				this->PassiveAsc->AddDynamicTag(
+					FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+				);
+
+				TestEqual(
+					"AbBoostCount",
+					this->PassiveAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetAbBoostCountAttribute()),
+					1.0f
+				);
+			});
+		});
+
+		Describe("when no passive GE depends on the tag", [=, this]
+		{
+			It("does not re-apply any weight group", [=, this]
+			{
+				this->PassiveAsc->AddDynamicTag(FGameplayTag::RequestGameplayTag("Armor.Equipped.Light"));
+
+				TestEqual("Applications of EarlyWeightGroup", this->ApplicationCounts[this->EarlyWeightGroup], 0);
+				TestEqual(
+					"Applications of DependentWeightGroup",
+					this->ApplicationCounts[this->DependentWeightGroup],
+					0
+				);
+				TestEqual("Applications of LateWeightGroup", this->ApplicationCounts[this->LateWeightGroup], 0);
+			});
+
+			It("still grants the tag", [=, this]
+			{
+				const FGameplayTag Tag = FGameplayTag::RequestGameplayTag("Armor.Equipped.Light");
+
+				this->PassiveAsc->AddDynamicTag(Tag);
+
+				TestTrue("HasMatchingGameplayTag(Armor.Equipped.Light)", this->PassiveAsc->HasMatchingGameplayTag(Tag));
+			});
+		});
+	});
+
+	Describe("BeginDynamicTagBatch", [=, this]
+	{
+		It("defers re-applying weight groups until the batch ends", [=, this]
+		{
+			this->PassiveAsc->BeginDynamicTagBatch();
+
+			this->PassiveAsc->AddDynamicTag(
+				FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+			);
+
+			TestEqual(
+				"Applications of DependentWeightGroup before EndDynamicTagBatch()",
+				this->ApplicationCounts[this->DependentWeightGroup],
+				0
+			);
+
+			this->PassiveAsc->EndDynamicTagBatch();
+
+			TestEqual(
+				"Applications of DependentWeightGroup after EndDynamicTagBatch()",
+				this->ApplicationCounts[this->DependentWeightGroup],
+				1
+			);
+		});
+
+		It("re-applies affected weight groups only once for all changes made during the batch", [=, this]
+		{
+			const FGameplayTag DependentTag =
+				FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName);
+
+			this->PassiveAsc->BeginDynamicTagBatch();
+
+			this->PassiveAsc->AddDynamicTag(DependentTag);
+			this->PassiveAsc->RemoveDynamicTag(DependentTag);
+			this->PassiveAsc->AddDynamicTag(DependentTag);
+			this->PassiveAsc->AddDynamicTag(FGameplayTag::RequestGameplayTag("Armor.Equipped.Light"));
+
+			this->PassiveAsc->EndDynamicTagBatch();
+
+			TestEqual("Applications of EarlyWeightGroup", this->ApplicationCounts[this->EarlyWeightGroup], 0);
+			TestEqual(
+				"Applications of DependentWeightGroup",
+				this->ApplicationCounts[this->DependentWeightGroup],
+				1
+			);
+			TestEqual("Applications of LateWeightGroup", this->ApplicationCounts[this->LateWeightGroup], 1);
+
+			TestEqual(
+				"AbBoostCount",
+				this->PassiveAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetAbBoostCountAttribute()),
+				1.0f
+			);
+		});
+
+		It("only commits the batch when the outermost batch ends", [=, this]
+		{
+			this->PassiveAsc->BeginDynamicTagBatch();
+			this->PassiveAsc->BeginDynamicTagBatch();
+
+			this->PassiveAsc->AddDynamicTag(
+				FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+			);
+
+			this->PassiveAsc->EndDynamicTagBatch();
+
+			TestEqual(
+				"Applications of DependentWeightGroup after inner EndDynamicTagBatch()",
+				this->ApplicationCounts[this->DependentWeightGroup],
+				0
+			);
+
+			this->PassiveAsc->EndDynamicTagBatch();
+
+			TestEqual(
+				"Applications of DependentWeightGroup after outer EndDynamicTagBatch()",
+				this->ApplicationCounts[this->DependentWeightGroup],
+				1
+			);
+		});
+
+		It("defers activating passive GEs added during the batch until the batch ends", [=, this]
+		{
+			this->PassiveAsc->BeginDynamicTagBatch();
+
+			this->PassiveAsc->AddPassiveGameplayEffectWithWeight(
+				this->EarlyWeightGroup,
+				UPF2TestGameplayEffect::StaticClass()
+			);
+
+			TestEqual(
+				"Active GEs in EarlyWeightGroup before EndDynamicTagBatch()",
+				this->FindPassiveEffectHandles(UPF2TestGameplayEffect::StaticClass(), this->EarlyWeightGroup).Num(),
+				1
+			);
+
+			TestEqual(
+				"Applications of EarlyWeightGroup before EndDynamicTagBatch()",
+				this->ApplicationCounts[this->EarlyWeightGroup],
+				0
+			);
+
+			this->PassiveAsc->EndDynamicTagBatch();
+
+			TestEqual(
+				"Active GEs in EarlyWeightGroup after EndDynamicTagBatch()",
+				this->FindPassiveEffectHandles(UPF2TestGameplayEffect::StaticClass(), this->EarlyWeightGroup).Num(),
+				2
+			);
+
+			// The weight groups after the one that received the new GE get re-applied once, when the batch ends.
+			TestEqual(
+				"Applications of DependentWeightGroup",
+				this->ApplicationCounts[this->DependentWeightGroup],
+				1
+			);
+			TestEqual("Applications of LateWeightGroup", this->ApplicationCounts[this->LateWeightGroup], 1);
+		});
+	});
+
+	Describe("EndDynamicTagBatch", [=, this]
+	{
+		Describe("when called without a matching call to BeginDynamicTagBatch()", [=, this]
+		{
+			It("logs an error and does not re-apply any weight group", [=, this]
+			{
+				this->AddExpectedError(
+					"without a matching call to BeginDynamicTagBatch\\(\\)",
+					EAutomationExpectedMessageFlags::Contains
+				);
+
+				this->PassiveAsc->EndDynamicTagBatch();
+
+				TestEqual("Applications of EarlyWeightGroup", this->ApplicationCounts[this->EarlyWeightGroup], 0);
+				TestEqual(
+					"Applications of DependentWeightGroup",
+					this->ApplicationCounts[this->DependentWeightGroup],
+					0
+				);
+				TestEqual("Applications of LateWeightGroup", this->ApplicationCounts[this->LateWeightGroup], 0);
+			});
+
+			It("does not leave the ASC in a batch", [=, this]
+			{
+				this->AddExpectedError(
+					"without a matching call to BeginDynamicTagBatch\\(\\)",
+					EAutomationExpectedMessageFlags::Contains
+				);
+
+				this->PassiveAsc->EndDynamicTagBatch();
+
+				// Tag changes should take effect immediately instead of waiting on another EndDynamicTagBatch().
+				this->PassiveAsc->AddDynamicTag(
+					FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+				);
+
+				TestEqual(
+					"Applications of DependentWeightGroup",
+					this->ApplicationCounts[this->DependentWeightGroup],
+					1
+				);
+			});
+		});
+	});
+}
+
+void FPF2AbilitySystemComponentSpec::SetupPassiveAsc()
+{
+	this->PassiveAsc = this->SpawnActorComponent<UPF2AbilitySystemComponent>();
+
+	this->PassiveAsc->InitAbilityActorInfo(this->TestPawn, this->TestPawn);
+	this->PassiveAsc->InitStats(UPF2CharacterAttributeSet::StaticClass(), nullptr);
+
+	this->PassiveAsc->AddPassiveGameplayEffectWithWeight(
+		this->EarlyWeightGroup,
+		UPF2TestGameplayEffect::StaticClass()
+	);
+
+	this->PassiveAsc->AddPassiveGameplayEffectWithWeight(
+		this->DependentWeightGroup,
+		UPF2TestTagDependentGameplayEffect::StaticClass()
+	);
+
+	this->PassiveAsc->AddPassiveGameplayEffectWithWeight(
+		this->LateWeightGroup,
+		UPF2TestGameplayEffect::StaticClass()
+	);
+
+	this->PassiveAsc->ActivateAllPassiveGameplayEffects();
+
+	// Only count applications that happen after the passive GEs have been activated the first time.
+	this->ApplicationCounts.Add(this->EarlyWeightGroup,     0);
+	this->ApplicationCounts.Add(this->DependentWeightGroup, 0);
+	this->ApplicationCounts.Add(this->LateWeightGroup,      0);
+
+	this->PassiveAsc->OnActiveGameplayEffectAddedDelegateToSelf.AddLambda(
+		[this](UAbilitySystemComponent*, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle)
+		{
+			for (TPair<FName, int32>& Count : this->ApplicationCounts)
+			{
+				if (Spec.GetDynamicAssetTags().HasTagExact(PF2GameplayAbilityUtilities::GetTag(Count.Key)))
+				{
+					++Count.Value;
+				}
+			}
+		});
+}
+
+FActiveGameplayEffectHandle FPF2AbilitySystemComponentSpec::FindPassiveEffectHandle(
+	const TSubclassOf<UGameplayEffect>& Effect,
+	const FName                         WeightGroup) const
+{
+	const TArray<FActiveGameplayEffectHandle> Handles = this->FindPassiveEffectHandles(Effect, WeightGroup);
+	FActiveGameplayEffectHandle               Result;
+
+	if (Handles.Num() != 0)
+	{
+		Result = Handles[0];
+	}
+
+	return Result;
+}
+
+TArray<FActiveGameplayEffectHandle> FPF2AbilitySystemComponentSpec::FindPassiveEffectHandles(
+	const TSubclassOf<UGameplayEffect>& Effect,
+	const FName                         WeightGroup) const
+{
+	FGameplayEffectQuery Query;
+
+	Query.EffectDefinition = Effect;
+	Query.EffectTagQuery   =
+		FGameplayTagQuery::MakeQuery_MatchAnyTags(
+			FGameplayTagContainer(PF2GameplayAbilityUtilities::GetTag(WeightGroup))
+		);
+
+	return this->PassiveAsc->GetActiveEffects(Query);
+}
@@ -445,6 +445,236 @@ void FPF2CharacterInitiativeQueueComponentSpec::Define()
 		});
 	});
 
+	Describe("SetCharacterInitiatives", [this]
+	{
+		Describe("when given a different number of characters than initiatives", [this]
+		{
+			It("makes no changes to initiative for any character", [this]
+			{
+				const TScriptInterface<IPF2CharacterInterface> Character1 =
+					PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+
+				const TScriptInterface<IPF2CharacterInterface> Character2 =
+					PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+
+				AddExpectedError(
+					TEXT("Number of characters \\('2'\\) must match number of initiatives \\('1'\\)\\."),
+					EAutomationExpectedErrorFlags::Contains,
+					1
+				);
+
+				this->Component->SetCharacterInitiatives({Character1, Character2}, {10});
+
+				TestTrue("IsEmpty()", this->Component->IsEmpty());
+			});
+		});
+
+		Describe("when given the same number of characters and initiatives", [this]
+		{
+			static TScriptInterface<IPF2CharacterInterface> Character1,
+			                                                Character2,
+			                                                Character3,
+			                                                Character4;
+
+			BeforeEach([=, this]
+			{
+				Character1 = PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+				Character2 = PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+				Character3 = PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+				Character4 = PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+			});
+
+			It("orders all characters from highest to lowest initiative, keeping ties in the order given", [this]
+			{
+				this->Component->SetCharacterInitiatives(
+					{Character1, Character2, Character3, Character4},
+					{8, 15, 23, 15}
+				);
+
+				TestArrayEquals(
+					"GetCharactersInInitiativeOrder()",
+					this->Component->GetCharactersInInitiativeOrder(),
+					{
+						Character3,
+						Character2,
+						Character4,
+						Character1,
+					}
+				);
+			});
+
+			It("skips characters that are given an initiative that is not greater than 0", [this]
+			{
+				AddExpectedError(
+					TEXT("must be greater than 0; attempted to set it to '0'\\."),
+					EAutomationExpectedErrorFlags::Contains,
+					1
+				);
+
+				this->Component->SetCharacterInitiatives(
+					{Character1, Character2, Character3},
+					{8, 0, 23}
+				);
+
+				TestEqual(
+					"GetCharacterInitiative(Character1)",
+					this->Component->GetCharacterInitiative(Character1),
+					8
+				);
+
+				TestEqual(
+					"GetCharacterInitiative(Character2)",
+					this->Component->GetCharacterInitiative(Character2),
+					INDEX_NONE
+				);
+
+				TestEqual(
+					"GetCharacterInitiative(Character3)",
+					this->Component->GetCharacterInitiative(Character3),
+					23
+				);
+			});
+
+			It("merges the characters into any characters that already have initiative set", [this]
+			{
+				this->Component->SetCharacterInitiative(Character1, 10);
+				this->Component->SetCharacterInitiative(Character2, 20);
+
+				this->Component->SetCharacterInitiatives({Character3, Character1}, {15, 5});
+
+				TestArrayEquals(
+					"GetCharactersInInitiativeOrder()",
+					this->Component->GetCharactersInInitiativeOrder(),
+					{
+						Character2,
+						Character3,
+						Character1,
+					}
+				);
+			});
+
+			It("uses the last valid initiative given for a character that appears more than once", [this]
+			{
+				AddExpectedError(
+					TEXT("must be greater than 0; attempted to set it to '0'\\."),
+					EAutomationExpectedErrorFlags::Contains,
+					1
+				);
+
+				this->Component->SetCharacterInitiatives(
+					{Character1, Character2, Character1, Character3, Character1},
+					{5, 15, 25, 10, 0}
+				);
+
+				TestEqual(
+					"GetCharacterInitiative(Character1)",
+					this->Component->GetCharacterInitiative(Character1),
+					25
+				);
+
+				TestArrayEquals(
+					"GetCharactersInInitiativeOrder()",
+					this->Component->GetCharactersInInitiativeOrder(),
+					{
+						Character1,
+						Character2,
+						Character3,
+					}
+				);
+			});
+
+			It("does not skip or repeat any turn when the previous character returned appears more than once", [this]
+			{
+				this->Component->SetCharacterInitiatives(
+					{Character1, Character2, Character3, Character4},
+					{20, 15, 10, 5}
+				);
+
+				// Returns Character1.
+				this->Component->GetNextCharacterByInitiative();
+
+				// Returns Character2.
+				this->Component->GetNextCharacterByInitiative();
+
+				// Move Character2 below Character3 (after first moving it to the top) and Character4 above Character1.
+				this->Component->SetCharacterInitiatives({Character2, Character4, Character2}, {25, 25, 8});
+
+				// Cycle 3 times to confirm that the same sequence is returned multiple times.
+				for (int32 i = 0; i < 3; ++i)
+				{
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character3",
+						this->Component->GetNextCharacterByInitiative(),
+						Character3
+					);
+
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character2",
+						this->Component->GetNextCharacterByInitiative(),
+						Character2
+					);
+
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character4",
+						this->Component->GetNextCharacterByInitiative(),
+						Character4
+					);
+
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character1",
+						this->Component->GetNextCharacterByInitiative(),
+						Character1
+					);
+				}
+			});
+
+			It("does not skip or repeat any turn when the initiative of the previous character returned changes", [this]
+			{
+				this->Component->SetCharacterInitiatives(
+					{Character1, Character2, Character3, Character4},
+					{20, 15, 10, 5}
+				);
+
+				// Returns Character1.
+				this->Component->GetNextCharacterByInitiative();
+
+				// Returns Character2.
+				this->Component->GetNextCharacterByInitiative();
+
+				// Move Character2 below Character3 and Character4 above Character1.
+				this->Component->SetCharacterInitiatives({Character2, Character4}, {8, 25});
+
+				// Cycle 3 times to confirm that the same sequence is returned multiple times.
+				for (int32 i = 0; i < 3; ++i)
+				{
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character3",
+						this->Component->GetNextCharacterByInitiative(),
+						Character3
+					);
+
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character2",
+						this->Component->GetNextCharacterByInitiative(),
+						Character2
+					);
+
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character4",
+						this->Component->GetNextCharacterByInitiative(),
+						Character4
+					);
+
+					TestEqual(
+						"GetNextCharacterByInitiative() = Character1",
+						this->Component->GetNextCharacterByInitiative(),
+						Character1
+					);
+				}
+			});
+		});
+	});
+
 	Describe("IsInitiativeSetForCharacter", [this]
 	{
 		Describe("when the queue is empty", [this]
@@ -0,0 +1,191 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Commands/PF2CharacterCommand.h"
+#include "Commands/PF2CharacterCommandInterface.h"
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestLightweightCommandQueueComponent.h"
+
+#include "Utilities/PF2InterfaceUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2CommandQueueComponentSpec,
+                     "OpenPF2.CommandQueueComponent",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	UPF2TestLightweightCommandQueueComponent*                Component;
+	TArray<TScriptInterface<IPF2CharacterCommandInterface>> Commands;
+
+	TScriptInterface<IPF2CharacterCommandInterface> CreateCommand() const;
+END_DEFINE_PF_SPEC(FPF2CommandQueueComponentSpec)
+
+void FPF2CommandQueueComponentSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+		this->SetupTestPawn();
+		this->SetupTestCharacter();
+
+		this->Component = this->SpawnActorComponent<UPF2TestLightweightCommandQueueComponent>();
+
+		this->Commands.Empty();
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			this->Commands.Add(this->CreateCommand());
+		}
+	});
+
+	AfterEach([=, this]
+	{
+		this->Component = nullptr;
+
+		this->Commands.Empty();
+
+		this->DestroyTestCharacter();
+		this->DestroyTestPawn();
+		this->DestroyWorld();
+	});
+
+	Describe("when lightweight replication is enabled", [=, this]
+	{
+		Describe("Enqueue", [=, this]
+		{
+			It("adds commands to the end of the queue in the order they were added", [=, this]
+			{
+				this->Component->Enqueue(this->Commands[0]);
+				this->Component->Enqueue(this->Commands[1]);
+				this->Component->Enqueue(this->Commands[2]);
+
+				TestArrayEquals(
+					"ToArray()",
+					this->Component->ToArray(),
+					{ this->Commands[0], this->Commands[1], this->Commands[2] }
+				);
+			});
+
+			It("stops replicating each command as an actor", [=, this]
+			{
+				this->Component->Enqueue(this->Commands[0]);
+
+				TestFalse("GetIsReplicated()", this->Commands[0]->ToActor()->GetIsReplicated());
+			});
+
+			Describe("when the queue is at its size limit", [=, this]
+			{
+				It("does not add the command", [=, this]
+				{
+					this->Component->SetSizeLimit(2);
+
+					this->Component->Enqueue(this->Commands[0]);
+					this->Component->Enqueue(this->Commands[1]);
+					this->Component->Enqueue(this->Commands[2]);
+
+					TestArrayEquals(
+						"ToArray()",
+						this->Component->ToArray(),
+						{ this->Commands[0], this->Commands[1] }
+					);
+				});
+			});
+		});
+
+		Describe("EnqueueAt", [=, this]
+		{
+			It("adds the command at the requested position", [=, this]
+			{
+				this->Component->Enqueue(this->Commands[0]);
+				this->Component->Enqueue(this->Commands[1]);
+
+				this->Component->EnqueueAt(this->Commands[2], 1);
+				this->Component->EnqueueAt(this->Commands[3], 0);
+
+				TestArrayEquals(
+					"ToArray()",
+					this->Component->ToArray(),
+					{ this->Commands[3], this->Commands[0], this->Commands[2], this->Commands[1] }
+				);
+			});
+
+			Describe("when the queue is at its size limit", [=, this]
+			{
+				It("adds the command and drops the last command in the queue", [=, this]
+				{
+					this->Component->SetSizeLimit(2);
+
+					this->Component->Enqueue(this->Commands[0]);
+					this->Component->Enqueue(this->Commands[1]);
+
+					this->Component->EnqueueAt(this->Commands[2], 0);
+
+					TestArrayEquals(
+						"ToArray()",
+						this->Component->ToArray(),
+						{ this->Commands[2], this->Commands[0] }
+					);
+
+					TestEqual("Count()", this->Component->Count(), 2);
+				});
+			});
+
+			Describe("when the queue is below its size limit", [=, this]
+			{
+				It("adds the command without dropping any command", [=, this]
+				{
+					this->Component->SetSizeLimit(3);
+
+					this->Component->Enqueue(this->Commands[0]);
+					this->Component->Enqueue(this->Commands[1]);
+
+					this->Component->EnqueueAt(this->Commands[2], 0);
+
+					TestArrayEquals(
+						"ToArray()",
+						this->Component->ToArray(),
+						{ this->Commands[2], this->Commands[0], this->Commands[1] }
+					);
+				});
+			});
+		});
+
+		Describe("PopNext", [=, this]
+		{
+			It("removes and returns commands in queue order", [=, this]
+			{
+				TScriptInterface<IPF2CharacterCommandInterface> FirstCommand,
+				                                                SecondCommand;
+
+				this->Component->Enqueue(this->Commands[0]);
+				this->Component->Enqueue(this->Commands[1]);
+
+				this->Component->PopNext(FirstCommand);
+				this->Component->PopNext(SecondCommand);
+
+				TestEqual("FirstCommand", FirstCommand, this->Commands[0]);
+				TestEqual("SecondCommand", SecondCommand, this->Commands[1]);
+				TestEqual("Count()", this->Component->Count(), 0);
+			});
+
+			It("does not return a command when the queue is empty", [=, this]
+			{
+				TScriptInterface<IPF2CharacterCommandInterface> NextCommand;
+
+				this->Component->PopNext(NextCommand);
+
+				TestNull("NextCommand", NextCommand.GetObject());
+			});
+		});
+	});
+}
+
+TScriptInterface<IPF2CharacterCommandInterface> FPF2CommandQueueComponentSpec::CreateCommand() const
+{
+	return PF2InterfaceUtilities::ToScriptInterface(
+		APF2CharacterCommand::Create(
+			PF2InterfaceUtilities::FromScriptInterface(this->TestCharacter),
+			FGameplayAbilitySpecHandle()
+		)
+	);
+}
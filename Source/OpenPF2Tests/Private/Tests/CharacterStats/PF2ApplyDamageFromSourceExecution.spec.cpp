@@ -0,0 +1,133 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "CharacterStats/PF2ApplyDamageFromSourceExecution.h"
+
+#include "Abilities/Attacks/PF2AttackAttributeSet.h"
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
+#include "Libraries/PF2AbilitySystemLibrary.h"
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestDamageGameplayEffect.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2ApplyDamageFromSourceExecutionSpec,
+                     "OpenPF2.CharacterStats.ApplyDamageFromSourceExecution",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	/**
+	 * The hit points that the test character has before any damage is inflicted.
+	 */
+	const float StartingHitPoints = 100.0f;
+
+	/**
+	 * The slashing damage that the test character is attempting to inflict (e.g., from the weapon).
+	 */
+	const float SlashingDamage = 5.0f;
+
+	/**
+	 * The fire damage that the test character is attempting to inflict (e.g., from a flaming rune on the weapon).
+	 */
+	const float FireDamage = 3.0f;
+
+	void InflictDamage(const FGameplayTagContainer& DamageTypes) const;
+END_DEFINE_PF_SPEC(FPF2ApplyDamageFromSourceExecutionSpec)
+
+void FPF2ApplyDamageFromSourceExecutionSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+		this->SetupTestCharacter();
+
+		this->BeginPlay();
+
+		this->TestCharacterAsc->SetNumericAttributeBase(
+			UPF2CharacterAttributeSet::GetMaxHitPointsAttribute(),
+			this->StartingHitPoints
+		);
+
+		this->TestCharacterAsc->SetNumericAttributeBase(
+			UPF2CharacterAttributeSet::GetHitPointsAttribute(),
+			this->StartingHitPoints
+		);
+
+		// The test character is both the source and the target of the damage.
+		this->TestCharacterAsc->SetNumericAttributeBase(
+			UPF2AttackAttributeSet::GetTmpDmgTypePhysicalSlashingAttribute(),
+			this->SlashingDamage
+		);
+
+		this->TestCharacterAsc->SetNumericAttributeBase(
+			UPF2AttackAttributeSet::GetTmpDmgTypeEnergyFireAttribute(),
+			this->FireDamage
+		);
+	});
+
+	AfterEach([=, this]
+	{
+		this->DestroyTestCharacter();
+		this->DestroyWorld();
+	});
+
+	Describe("when the spec is not flagged with any damage types", [=, this]
+	{
+		It("inflicts every type of damage that the source has accumulated", [=, this]
+		{
+			this->InflictDamage(FGameplayTagContainer());
+
+			TestEqual(
+				"HitPoints",
+				this->TestCharacterAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetHitPointsAttribute()),
+				this->StartingHitPoints - this->SlashingDamage - this->FireDamage
+			);
+		});
+	});
+
+	Describe("when the spec is flagged with every type of damage that the source has accumulated", [=, this]
+	{
+		It("inflicts every type of damage that the source has accumulated", [=, this]
+		{
+			FGameplayTagContainer DamageTypes;
+
+			DamageTypes.AddTag(FGameplayTag::RequestGameplayTag("DamageType.Physical.Slashing"));
+			DamageTypes.AddTag(FGameplayTag::RequestGameplayTag("DamageType.Energy.Fire"));
+
+			this->InflictDamage(DamageTypes);
+
+			TestEqual(
+				"HitPoints",
+				this->TestCharacterAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetHitPointsAttribute()),
+				this->StartingHitPoints - this->SlashingDamage - this->FireDamage
+			);
+		});
+	});
+
+	Describe("when the spec is flagged with only some of the types of damage that the source has accumulated", [=, this]
+	{
+		It("inflicts only the types of damage that the spec is flagged with", [=, this]
+		{
+			this->InflictDamage(FGameplayTagContainer(FGameplayTag::RequestGameplayTag("DamageType.Energy.Fire")));
+
+			TestEqual(
+				"HitPoints",
+				this->TestCharacterAsc->GetNumericAttribute(UPF2CharacterAttributeSet::GetHitPointsAttribute()),
+				this->StartingHitPoints - this->FireDamage
+			);
+		});
+	});
+}
+
+void FPF2ApplyDamageFromSourceExecutionSpec::InflictDamage(const FGameplayTagContainer& DamageTypes) const
+{
+	FGameplayEffectSpecHandle EffectSpec = this->BuildEffectSpec(UPF2TestDamageGameplayEffect::StaticClass());
+
+	if (!DamageTypes.IsEmpty())
+	{
+		EffectSpec = UPF2AbilitySystemLibrary::AddDamageTypesToGameplayEffectSpec(EffectSpec, DamageTypes);
+	}
+
+	this->TestCharacterAsc->ApplyGameplayEffectSpecToSelf(*EffectSpec.Data.Get());
+}
@@ -0,0 +1,205 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "CharacterStats/PF2AttributeSnapshot.h"
+
+#include <UObject/CoreNet.h>
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2AttributeSnapshotSpec,
+                     "OpenPF2.CharacterStats.AttributeSnapshot",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	static FPF2AttributeSnapshotItem RoundTrip(const FPF2AttributeSnapshotItem& Item, int64& OutNumBits);
+END_DEFINE_PF_SPEC(FPF2AttributeSnapshotSpec)
+
+void FPF2AttributeSnapshotSpec::Define()
+{
+	Describe(TEXT("GetAttributeIndex"), [=, this]
+	{
+		It(TEXT("maps each replicated attribute to an index that resolves back to the same attribute"), [=, this]
+		{
+			const UClass*    AttributeSetClass = UPF2CharacterAttributeSet::StaticClass();
+			const FProperty* HitPointsProperty = UPF2CharacterAttributeSet::GetHitPointsAttribute().GetUProperty();
+			const int32      AttributeIndex    =
+				FPF2AttributeSnapshot::GetAttributeIndex(AttributeSetClass, HitPointsProperty);
+
+			if (TestNotEqual("AttributeIndex", AttributeIndex, static_cast<int32>(INDEX_NONE)))
+			{
+				TestEqual(
+					"GetSnapshotAttributes()[AttributeIndex]",
+					FPF2AttributeSnapshot::GetSnapshotAttributes(AttributeSetClass)[AttributeIndex],
+					HitPointsProperty
+				);
+			}
+		});
+
+		It(TEXT("does not map attributes that are not replicated"), [=, this]
+		{
+			const UClass*    AttributeSetClass      = UPF2CharacterAttributeSet::StaticClass();
+			const FProperty* DamageIncomingProperty =
+				UPF2CharacterAttributeSet::GetTmpDamageIncomingAttribute().GetUProperty();
+
+			TestEqual(
+				"GetAttributeIndex(TmpDamageIncoming)",
+				FPF2AttributeSnapshot::GetAttributeIndex(AttributeSetClass, DamageIncomingProperty),
+				static_cast<int32>(INDEX_NONE)
+			);
+		});
+	});
+
+	Describe(TEXT("RecordAttribute"), [=, this]
+	{
+		It(TEXT("only reports a change when the value of the attribute has changed since it was recorded"), [=, this]
+		{
+			UPF2CharacterAttributeSet* AttributeSet       = NewObject<UPF2CharacterAttributeSet>();
+			const FGameplayAttribute   HitPointsAttribute = UPF2CharacterAttributeSet::GetHitPointsAttribute();
+			FGameplayAttributeData*    HitPointsData      = HitPointsAttribute.GetGameplayAttributeData(AttributeSet);
+			FPF2AttributeSnapshot      Snapshot;
+
+			Snapshot.SetOwningAttributeSet(AttributeSet);
+
+			TestTrue("RecordAttribute() (first time)", Snapshot.RecordAttribute(HitPointsAttribute.GetUProperty()));
+			TestFalse("RecordAttribute() (unchanged)", Snapshot.RecordAttribute(HitPointsAttribute.GetUProperty()));
+
+			HitPointsData->SetCurrentValue(5.0f);
+
+			TestTrue("RecordAttribute() (changed)", Snapshot.RecordAttribute(HitPointsAttribute.GetUProperty()));
+			TestEqual("Num()", Snapshot.Num(), 1);
+		});
+
+		It(TEXT("reports a change when only the base value of the attribute has changed"), [=, this]
+		{
+			UPF2CharacterAttributeSet* AttributeSet       = NewObject<UPF2CharacterAttributeSet>();
+			const FGameplayAttribute   HitPointsAttribute = UPF2CharacterAttributeSet::GetHitPointsAttribute();
+			FGameplayAttributeData*    HitPointsData      = HitPointsAttribute.GetGameplayAttributeData(AttributeSet);
+			FPF2AttributeSnapshot      Snapshot;
+
+			Snapshot.SetOwningAttributeSet(AttributeSet);
+
+			TestTrue("RecordAttribute() (first time)", Snapshot.RecordAttribute(HitPointsAttribute.GetUProperty()));
+
+			HitPointsData->SetBaseValue(5.0f);
+
+			TestTrue("RecordAttribute() (base changed)", Snapshot.RecordAttribute(HitPointsAttribute.GetUProperty()));
+			TestEqual("Num()", Snapshot.Num(), 1);
+		});
+
+		It(TEXT("ignores attributes that are not replicated"), [=, this]
+		{
+			UPF2CharacterAttributeSet* AttributeSet = NewObject<UPF2CharacterAttributeSet>();
+			FPF2AttributeSnapshot      Snapshot;
+
+			Snapshot.SetOwningAttributeSet(AttributeSet);
+
+			TestFalse(
+				"RecordAttribute(TmpDamageIncoming)",
+				Snapshot.RecordAttribute(UPF2CharacterAttributeSet::GetTmpDamageIncomingAttribute().GetUProperty())
+			);
+			TestEqual("Num()", Snapshot.Num(), 0);
+		});
+	});
+
+	Describe(TEXT("ApplyItem"), [=, this]
+	{
+		It(TEXT("updates the base and current value of the corresponding attribute"), [=, this]
+		{
+			UPF2CharacterAttributeSet* AttributeSet       = NewObject<UPF2CharacterAttributeSet>();
+			const FGameplayAttribute   HitPointsAttribute = UPF2CharacterAttributeSet::GetHitPointsAttribute();
+			FPF2AttributeSnapshotItem  Item;
+			FPF2AttributeSnapshot      Snapshot;
+
+			Item.AttributeIndex = FPF2AttributeSnapshot::GetAttributeIndex(
+				UPF2CharacterAttributeSet::StaticClass(),
+				HitPointsAttribute.GetUProperty()
+			);
+
+			Item.BaseValue    = 12.0f;
+			Item.CurrentValue = 9.0f;
+
+			Snapshot.SetOwningAttributeSet(AttributeSet);
+			Snapshot.ApplyItem(Item);
+
+			TestEqual("HitPoints.BaseValue", AttributeSet->HitPoints.GetBaseValue(), 12.0f);
+			TestEqual("HitPoints.CurrentValue", AttributeSet->HitPoints.GetCurrentValue(), 9.0f);
+		});
+	});
+
+	Describe(TEXT("NetSerialize"), [=, this]
+	{
+		It(TEXT("preserves whole-number values while using fewer bits than full precision"), [=, this]
+		{
+			FPF2AttributeSnapshotItem Item;
+			int64                     NumBits;
+
+			Item.AttributeIndex = 7;
+			Item.BaseValue      = -3.0f;
+			Item.CurrentValue   = 250.0f;
+
+			const FPF2AttributeSnapshotItem Result = RoundTrip(Item, NumBits);
+
+			TestEqual("AttributeIndex", Result.AttributeIndex, Item.AttributeIndex);
+			TestEqual("BaseValue", Result.BaseValue, Item.BaseValue);
+			TestEqual("CurrentValue", Result.CurrentValue, Item.CurrentValue);
+			TestTrue("NumBits < 8 + (2 * 32)", NumBits < (8 + (2 * 32)));
+		});
+
+		It(TEXT("preserves fractional values"), [=, this]
+		{
+			FPF2AttributeSnapshotItem Item;
+			int64                     NumBits;
+
+			Item.AttributeIndex = 3;
+			Item.BaseValue      = 1.5f;
+			Item.CurrentValue   = 0.25f;
+
+			const FPF2AttributeSnapshotItem Result = RoundTrip(Item, NumBits);
+
+			TestEqual("AttributeIndex", Result.AttributeIndex, Item.AttributeIndex);
+			TestEqual("BaseValue", Result.BaseValue, Item.BaseValue);
+			TestEqual("CurrentValue", Result.CurrentValue, Item.CurrentValue);
+		});
+
+		It(TEXT("sends the current value only when it differs from the base value"), [=, this]
+		{
+			FPF2AttributeSnapshotItem SameItem,
+			                          DifferentItem;
+			int64                     SameNumBits,
+			                          DifferentNumBits;
+
+			SameItem.BaseValue         = 4.0f;
+			SameItem.CurrentValue      = 4.0f;
+			DifferentItem.BaseValue    = 4.0f;
+			DifferentItem.CurrentValue = 6.0f;
+
+			const FPF2AttributeSnapshotItem Result = RoundTrip(SameItem, SameNumBits);
+
+			RoundTrip(DifferentItem, DifferentNumBits);
+
+			TestEqual("CurrentValue", Result.CurrentValue, 4.0f);
+			TestTrue("SameNumBits < DifferentNumBits", SameNumBits < DifferentNumBits);
+		});
+	});
+}
+
+FPF2AttributeSnapshotItem FPF2AttributeSnapshotSpec::RoundTrip(const FPF2AttributeSnapshotItem& Item, int64& OutNumBits)
+{
+	FPF2AttributeSnapshotItem SourceItem = Item,
+	                          Result;
+	FNetBitWriter             Writer(nullptr, 1024);
+	bool                      bSuccess = false;
+
+	SourceItem.NetSerialize(Writer, nullptr, bSuccess);
+
+	OutNumBits = Writer.GetNumBits();
+
+	FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+
+	Result.NetSerialize(Reader, nullptr, bSuccess);
+
+	return Result;
+}
@@ -111,4 +111,148 @@ void FPF2CharacterAttributeSetSpec::Define()
 			TestEqual(TEXT("TmpLastIncomingAttackDegreeOfSuccess"), AttributeSet->GetTmpDamageIncoming(),           0.0f);
 		});
 	});
+
+	Describe("When replicating UPF2CharacterAttributeSet", [this]()
+	{
+		It("replicates all attributes with push-model replication", [this]()
+		{
+			const UPF2CharacterAttributeSet* AttributeSet = this->TestPawnAsc->GetSet<UPF2CharacterAttributeSet>();
+			TArray<FLifetimeProperty>        LifetimeProps;
+
+			AttributeSet->GetLifetimeReplicatedProps(LifetimeProps);
+
+			TestTrue(TEXT("LifetimeProps.Num() > 0"), LifetimeProps.Num() > 0);
+
+			for (const FLifetimeProperty& LifetimeProp : LifetimeProps)
+			{
+				TestTrue(
+					FString::Format(TEXT("Property with RepIndex {0} is push-based"), {LifetimeProp.RepIndex}),
+					LifetimeProp.bIsPushBased
+				);
+			}
+		});
+
+		It("replicates attributes that only matter to the owning player to only the owner", [this]()
+		{
+			const UPF2CharacterAttributeSet* AttributeSet = this->TestPawnAsc->GetSet<UPF2CharacterAttributeSet>();
+
+			TestEqual(
+				TEXT("GetReplicationTierOfAttribute(Experience)"),
+				AttributeSet->GetReplicationTierOfAttribute(TEXT("Experience")),
+				EPF2AttributeReplicationTier::Owner
+			);
+
+			TestEqual(
+				TEXT("GetReplicationTierOfAttribute(FeAncestryFeatLimit)"),
+				AttributeSet->GetReplicationTierOfAttribute(TEXT("FeAncestryFeatLimit")),
+				EPF2AttributeReplicationTier::Owner
+			);
+		});
+
+		It("replicates attributes that matter to all players to everyone", [this]()
+		{
+			const UPF2CharacterAttributeSet* AttributeSet = this->TestPawnAsc->GetSet<UPF2CharacterAttributeSet>();
+
+			TestEqual(
+				TEXT("GetReplicationTierOfAttribute(HitPoints)"),
+				AttributeSet->GetReplicationTierOfAttribute(TEXT("HitPoints")),
+				EPF2AttributeReplicationTier::Everyone
+			);
+
+			TestEqual(
+				TEXT("GetReplicationTierOfAttribute(ArmorClass)"),
+				AttributeSet->GetReplicationTierOfAttribute(TEXT("ArmorClass")),
+				EPF2AttributeReplicationTier::Everyone
+			);
+		});
+
+		It("registers each attribute with the replication condition of its tier", [this]()
+		{
+			const UPF2CharacterAttributeSet* AttributeSet = this->TestPawnAsc->GetSet<UPF2CharacterAttributeSet>();
+			TArray<FLifetimeProperty>        LifetimeProps;
+
+			const TMap<FName, ELifetimeCondition> ExpectedConditions = {
+				{ "Experience", COND_OwnerOnly },
+				{ "HitPoints",  COND_None      },
+			};
+
+			AttributeSet->GetLifetimeReplicatedProps(LifetimeProps);
+
+			for (const auto& [AttributeName, ExpectedCondition] : ExpectedConditions)
+			{
+				const FProperty* Property =
+					FindFProperty<FProperty>(UPF2CharacterAttributeSet::StaticClass(), AttributeName);
+
+				const FLifetimeProperty* LifetimeProp =
+					LifetimeProps.FindByPredicate([Property](const FLifetimeProperty& Candidate)
+					{
+						return (Property != nullptr) && (Candidate.RepIndex == Property->RepIndex);
+					});
+
+				if (TestNotNull(AttributeName.ToString(), LifetimeProp))
+				{
+					TestEqual(AttributeName.ToString(), LifetimeProp->Condition, ExpectedCondition);
+				}
+			}
+		});
+	});
+
+	Describe("When a Gameplay Effect is executed against an attribute of UPF2CharacterAttributeSet", [this]()
+	{
+		It("invokes the handler registered for that attribute with the change in value", [this]()
+		{
+			UPF2CharacterAttributeSet* AttributeSet =
+				const_cast<UPF2CharacterAttributeSet*>(this->TestPawnAsc->GetSet<UPF2CharacterAttributeSet>());
+
+			int32 InvocationCount = 0;
+			float ReceivedDelta   = 0.0f;
+
+			AttributeSet->RegisterAttributeExecutedHandler(
+				UPF2CharacterAttributeSet::GetAbStrengthAttribute(),
+				FPF2AttributeExecutedDelegate::CreateLambda(
+					[&InvocationCount, &ReceivedDelta](const FGameplayEffectSpec&, IPF2CharacterInterface*,
+					                                   const float ValueDelta)
+					{
+						++InvocationCount;
+						ReceivedDelta = ValueDelta;
+					}
+				)
+			);
+
+			this->TestPawnAsc->ApplyModToAttribute(
+				UPF2CharacterAttributeSet::GetAbStrengthAttribute(),
+				EGameplayModOp::Additive,
+				2.0f
+			);
+
+			TestEqual(TEXT("InvocationCount"), InvocationCount, 1);
+			TestEqual(TEXT("ReceivedDelta"),   ReceivedDelta,   2.0f);
+		});
+
+		It("does not invoke handlers registered for other attributes", [this]()
+		{
+			UPF2CharacterAttributeSet* AttributeSet =
+				const_cast<UPF2CharacterAttributeSet*>(this->TestPawnAsc->GetSet<UPF2CharacterAttributeSet>());
+
+			int32 InvocationCount = 0;
+
+			AttributeSet->RegisterAttributeExecutedHandler(
+				UPF2CharacterAttributeSet::GetAbStrengthAttribute(),
+				FPF2AttributeExecutedDelegate::CreateLambda(
+					[&InvocationCount](const FGameplayEffectSpec&, IPF2CharacterInterface*, const float)
+					{
+						++InvocationCount;
+					}
+				)
+			);
+
+			this->TestPawnAsc->ApplyModToAttribute(
+				UPF2CharacterAttributeSet::GetAbDexterityAttribute(),
+				EGameplayModOp::Additive,
+				2.0f
+			);
+
+			TestEqual(TEXT("InvocationCount"), InvocationCount, 0);
+		});
+	});
 }
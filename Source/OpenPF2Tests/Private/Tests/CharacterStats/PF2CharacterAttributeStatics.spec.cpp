@@ -0,0 +1,247 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Abilities/Attacks/PF2AttackAttributeSet.h"
+#include "Abilities/Attacks/PF2AttackAttributeStatics.h"
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+#include "CharacterStats/PF2SourceCharacterAttributeStatics.h"
+#include "CharacterStats/PF2TargetCharacterAttributeStatics.h"
+
+#include "Tests/PF2SpecBase.h"
+
+#include "Utilities/PF2EnumUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2CharacterAttributeStaticsSpec,
+                     "OpenPF2.CharacterStats.AttributeStatics",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2CharacterAttributeStaticsSpec)
+
+void FPF2CharacterAttributeStaticsSpec::Define()
+{
+	static const TMap<FString, FString> DamageTypeToAttributeNames = {
+		{ "DamageType.Physical.Bludgeoning", "PhysicalBludgeoning" },
+		{ "DamageType.Energy.Fire",          "EnergyFire"          },
+		{ "DamageType.Alignment.Lawful",     "AlignmentLawful"     },
+		{ "DamageType.Precision",            "Precision"           },
+	};
+
+	Describe(TEXT("GetCaptureBySlot"), [=, this]
+	{
+		It(TEXT("returns the capture definition for the attribute that was assigned each slot"), [=, this]
+		{
+			const FPF2SourceCharacterAttributeStatics& SourceCaptures = FPF2SourceCharacterAttributeStatics::GetInstance();
+
+			for (int32 Slot = 0; Slot < SourceCaptures.GetNumCaptureSlots(); ++Slot)
+			{
+				const FGameplayEffectAttributeCaptureDefinition* Capture = SourceCaptures.GetCaptureBySlot(Slot);
+
+				if (TestNotNull(FString::Format(TEXT("Slot {0}"), {Slot}), Capture))
+				{
+					TestEqual(
+						Capture->AttributeToCapture.GetName(),
+						SourceCaptures.GetSlotOfAttribute(Capture->AttributeToCapture),
+						Slot
+					);
+				}
+			}
+		});
+
+		It(TEXT("returns nullptr for a slot that is out of range"), [=, this]
+		{
+			const FPF2SourceCharacterAttributeStatics& SourceCaptures = FPF2SourceCharacterAttributeStatics::GetInstance();
+
+			TestNull("GetCaptureBySlot(INDEX_NONE)", SourceCaptures.GetCaptureBySlot(INDEX_NONE));
+			TestNull(
+				"GetCaptureBySlot(GetNumCaptureSlots())",
+				SourceCaptures.GetCaptureBySlot(SourceCaptures.GetNumCaptureSlots())
+			);
+		});
+	});
+
+	Describe(TEXT("GetCaptureByAbilityScoreType"), [=, this]
+	{
+		for (const EPF2CharacterAbilityScoreType AbilityScoreType : TEnumRange<EPF2CharacterAbilityScoreType>())
+		{
+			const FString AbilityScoreName = PF2EnumUtilities::ToString(AbilityScoreType);
+
+			Describe(FString::Format(TEXT("when given '{0}'"), {AbilityScoreName}), [=, this]
+			{
+				It(TEXT("returns the capture for the ability score and its modifier"), [=, this]
+				{
+					const FPF2SourceCharacterAttributeStatics& SourceCaptures =
+						FPF2SourceCharacterAttributeStatics::GetInstance();
+
+					const FGameplayEffectAttributeCaptureDefinition* ScoreCapture =
+						SourceCaptures.GetCaptureByAbilityScoreType(AbilityScoreType);
+
+					const FGameplayEffectAttributeCaptureDefinition* ModifierCapture =
+						SourceCaptures.GetModifierCaptureByAbilityScoreType(AbilityScoreType);
+
+					if (TestNotNull("ScoreCapture", ScoreCapture))
+					{
+						TestEqual("ScoreCapture", ScoreCapture->AttributeToCapture.GetName(), AbilityScoreName);
+					}
+
+					if (TestNotNull("ModifierCapture", ModifierCapture))
+					{
+						TestEqual(
+							"ModifierCapture",
+							ModifierCapture->AttributeToCapture.GetName(),
+							AbilityScoreName + TEXT("Modifier")
+						);
+					}
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("GetResistanceCaptureForDamageType"), [=, this]
+	{
+		for (const auto& [DamageTypeName, AttributeSuffix] : DamageTypeToAttributeNames)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {DamageTypeName}), [=, this]
+			{
+				It(FString::Format(TEXT("returns the capture for 'Rst{0}'"), {AttributeSuffix}), [=, this]
+				{
+					const FGameplayEffectAttributeCaptureDefinition* Capture =
+						FPF2TargetCharacterAttributeStatics::GetInstance().GetResistanceCaptureForDamageType(
+							FGameplayTag::RequestGameplayTag(FName(DamageTypeName))
+						);
+
+					if (TestNotNull("Capture", Capture))
+					{
+						TestEqual("Capture", Capture->AttributeToCapture.GetName(), TEXT("Rst") + AttributeSuffix);
+					}
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("GetResistanceCaptureForDamageAttribute"), [=, this]
+	{
+		for (const auto& [DamageTypeName, AttributeSuffix] : DamageTypeToAttributeNames)
+		{
+			Describe(FString::Format(TEXT("when given 'TmpDmgType{0}'"), {AttributeSuffix}), [=, this]
+			{
+				It(FString::Format(TEXT("returns the capture for 'Rst{0}'"), {AttributeSuffix}), [=, this]
+				{
+					const FProperty* DamageProperty = FindFProperty<FProperty>(
+						UPF2AttackAttributeSet::StaticClass(),
+						*(TEXT("TmpDmgType") + AttributeSuffix)
+					);
+
+					const FGameplayEffectAttributeCaptureDefinition* Capture =
+						FPF2TargetCharacterAttributeStatics::GetInstance().GetResistanceCaptureForDamageAttribute(
+							FGameplayAttribute(DamageProperty)
+						);
+
+					if (TestNotNull("Capture", Capture))
+					{
+						TestEqual("Capture", Capture->AttributeToCapture.GetName(), TEXT("Rst") + AttributeSuffix);
+					}
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("GetDamageCaptureForDamageType"), [=, this]
+	{
+		for (const auto& [DamageTypeName, AttributeSuffix] : DamageTypeToAttributeNames)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {DamageTypeName}), [=, this]
+			{
+				It(TEXT("returns a capture that maps back to the same damage type"), [=, this]
+				{
+					const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+					const FGameplayTag                DamageType     =
+						FGameplayTag::RequestGameplayTag(FName(DamageTypeName));
+
+					const FGameplayEffectAttributeCaptureDefinition* Capture =
+						AttackCaptures.GetDamageCaptureForDamageType(DamageType);
+
+					if (TestNotNull("Capture", Capture))
+					{
+						TestEqual(
+							"Capture",
+							Capture->AttributeToCapture.GetName(),
+							TEXT("TmpDmgType") + AttributeSuffix
+						);
+
+						TestEqual(
+							"GetDamageTypeForDamageAttribute()",
+							AttackCaptures.GetDamageTypeForDamageAttribute(Capture->AttributeToCapture),
+							DamageType
+						);
+					}
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("GetDamageTypeMask"), [=, this]
+	{
+		It(TEXT("returns a mask with one bit set for each damage type among the tags"), [=, this]
+		{
+			const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+			FGameplayTagContainer             DamageTypes;
+
+			for (const auto& [DamageTypeName, AttributeSuffix] : DamageTypeToAttributeNames)
+			{
+				DamageTypes.AddTag(FGameplayTag::RequestGameplayTag(FName(DamageTypeName)));
+			}
+
+			const uint32 Mask = AttackCaptures.GetDamageTypeMask(DamageTypes);
+
+			TestEqual(
+				"Number of bits set",
+				FMath::CountBits(Mask),
+				static_cast<uint64>(DamageTypeToAttributeNames.Num())
+			);
+
+			for (const auto& [DamageTypeName, AttributeSuffix] : DamageTypeToAttributeNames)
+			{
+				const FGameplayEffectAttributeCaptureDefinition* Capture =
+					AttackCaptures.GetDamageCaptureForDamageType(FName(DamageTypeName));
+
+				const int32 DamageIndex = AttackCaptures.GetAllDamageCaptures().IndexOfByKey(Capture);
+
+				if (TestNotEqual(DamageTypeName, DamageIndex, INDEX_NONE))
+				{
+					TestTrue(DamageTypeName, (Mask & (1u << DamageIndex)) != 0);
+				}
+			}
+		});
+
+		It(TEXT("ignores tags that are not damage types"), [=, this]
+		{
+			const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+			FGameplayTagContainer             Tags;
+
+			Tags.AddTag(FGameplayTag::RequestGameplayTag(FName("GameplayCue.Character.InflictDamage")));
+
+			TestEqual("GetDamageTypeMask()", AttackCaptures.GetDamageTypeMask(Tags), 0u);
+		});
+
+		It(TEXT("returns the mask for all damage types when given every damage type"), [=, this]
+		{
+			const FPF2AttackAttributeStatics& AttackCaptures = FPF2AttackAttributeStatics::GetInstance();
+			const uint32                      AllTypesMask   = AttackCaptures.GetAllDamageTypesMask();
+			FGameplayTagContainer             DamageTypes;
+
+			for (const FGameplayEffectAttributeCaptureDefinition* Capture : AttackCaptures.GetAllDamageCaptures())
+			{
+				DamageTypes.AddTag(AttackCaptures.GetDamageTypeForDamageAttribute(Capture->AttributeToCapture));
+			}
+
+			TestEqual("GetDamageTypeMask()", AttackCaptures.GetDamageTypeMask(DamageTypes), AllTypesMask);
+			TestEqual(
+				"Number of bits set",
+				FMath::CountBits(AllTypesMask),
+				static_cast<uint64>(AttackCaptures.GetAllDamageCaptures().Num())
+			);
+		});
+	});
+}
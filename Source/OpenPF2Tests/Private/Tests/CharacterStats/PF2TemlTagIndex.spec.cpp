@@ -0,0 +1,57 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "CharacterStats/PF2TemlTagIndex.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2TemlTagIndexSpec,
+                     "OpenPF2.CharacterStats.TemlTagIndex",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2TemlTagIndexSpec)
+
+void FPF2TemlTagIndexSpec::Define()
+{
+	static const TArray<FString> TagPrefixes = {
+		"Armor.Category.Unarmored",
+		"Armor.Category.Heavy",
+		"Perception",
+		"SavingThrow.Reflex",
+	};
+
+	Describe(TEXT("GetRankTags"), [=, this]
+	{
+		for (const FString& TagPrefix : TagPrefixes)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {TagPrefix}), [=, this]
+			{
+				It(TEXT("returns the tag for each TEML rank under the prefix"), [=, this]
+				{
+					const FPF2TemlRankTags RankTags =
+						FPF2TemlTagIndex::GetInstance().GetRankTags(FGameplayTag::RequestGameplayTag(FName(TagPrefix)));
+
+					TestEqual("TrainedTag", RankTags.TrainedTag.ToString(), TagPrefix + ".Trained");
+					TestEqual("ExpertTag", RankTags.ExpertTag.ToString(), TagPrefix + ".Expert");
+					TestEqual("MasterTag", RankTags.MasterTag.ToString(), TagPrefix + ".Master");
+					TestEqual("LegendaryTag", RankTags.LegendaryTag.ToString(), TagPrefix + ".Legendary");
+				});
+			});
+		}
+
+		Describe(TEXT("when given a tag that has no rank tags"), [=, this]
+		{
+			It(TEXT("returns empty rank tags"), [=, this]
+			{
+				const FPF2TemlRankTags RankTags =
+					FPF2TemlTagIndex::GetInstance().GetRankTags(FGameplayTag::RequestGameplayTag("Armor.Equipped.Heavy"));
+
+				TestFalse("TrainedTag.IsValid()", RankTags.TrainedTag.IsValid());
+				TestFalse("ExpertTag.IsValid()", RankTags.ExpertTag.IsValid());
+				TestFalse("MasterTag.IsValid()", RankTags.MasterTag.IsValid());
+				TestFalse("LegendaryTag.IsValid()", RankTags.LegendaryTag.IsValid());
+			});
+		});
+	});
+}
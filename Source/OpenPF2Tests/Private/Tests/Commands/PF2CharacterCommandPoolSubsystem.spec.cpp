@@ -0,0 +1,151 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Commands/PF2CharacterCommandPoolSubsystem.h"
+
+#include "PF2CharacterInterface.h"
+
+#include "Commands/PF2CharacterCommand.h"
+#include "Commands/PF2CommandQueueInterface.h"
+
+#include "Libraries/PF2CharacterCommandLibrary.h"
+
+#include "Tests/PF2SpecBase.h"
+
+#include "Utilities/PF2InterfaceUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2CharacterCommandPoolSubsystemSpec,
+                     "OpenPF2.CharacterCommandPoolSubsystem",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2CharacterCommandPoolSubsystemSpec)
+
+void FPF2CharacterCommandPoolSubsystemSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+	});
+
+	AfterEach([=, this]
+	{
+		this->DestroyWorld();
+	});
+
+	It("reuses a released command for the next command that is created", [=, this]
+	{
+		const UPF2CharacterCommandPoolSubsystem* CommandPool = UPF2CharacterCommandPoolSubsystem::Get(this->World);
+		IPF2CharacterInterface*                  Character1  = this->SpawnCharacter();
+		IPF2CharacterInterface*                  Character2  = this->SpawnCharacter();
+		IPF2CharacterCommandInterface*           Command1    =
+			APF2CharacterCommand::Create(Character1, FGameplayAbilitySpecHandle());
+		IPF2CharacterCommandInterface*           Command2;
+
+		if (!TestNotNull("CommandPool", CommandPool))
+		{
+			return;
+		}
+
+		UPF2CharacterCommandLibrary::ReleaseCommand(PF2InterfaceUtilities::ToScriptInterface(Command1));
+
+		TestEqual("GetNumAvailableCommands() after release", CommandPool->GetNumAvailableCommands(), 1);
+
+		Command2 = APF2CharacterCommand::Create(Character2, FGameplayAbilitySpecHandle());
+
+		TestEqual("GetNumAvailableCommands() after reuse", CommandPool->GetNumAvailableCommands(), 0);
+		TestEqual("Command2->ToActor()", Command2->ToActor(), Command1->ToActor());
+		TestEqual("Command2->GetOwningCharacter()", Command2->GetOwningCharacter()->ToActor(), Character2->ToActor());
+	});
+
+	It("ignores a command that has already been released", [=, this]
+	{
+		const UPF2CharacterCommandPoolSubsystem* CommandPool = UPF2CharacterCommandPoolSubsystem::Get(this->World);
+		IPF2CharacterCommandInterface*           Command     =
+			APF2CharacterCommand::Create(this->SpawnCharacter(), FGameplayAbilitySpecHandle());
+
+		if (!TestNotNull("CommandPool", CommandPool))
+		{
+			return;
+		}
+
+		UPF2CharacterCommandLibrary::ReleaseCommand(PF2InterfaceUtilities::ToScriptInterface(Command));
+		UPF2CharacterCommandLibrary::ReleaseCommand(PF2InterfaceUtilities::ToScriptInterface(Command));
+
+		TestEqual("GetNumAvailableCommands()", CommandPool->GetNumAvailableCommands(), 1);
+	});
+
+	Describe("when a command is reused after it was queued and then cancelled", [=, this]
+	{
+		static IPF2CharacterInterface* Character1;
+		static IPF2CharacterInterface* Character2;
+		static APF2CharacterCommand*   OriginalCommand;
+		static APF2CharacterCommand*   ReusedCommand;
+		static int32                   OriginalGeneration;
+
+		BeforeEach([=, this]
+		{
+			TScriptInterface<IPF2CommandQueueInterface> CommandQueue;
+
+			Character1 = this->SpawnCharacter();
+			Character2 = this->SpawnCharacter();
+
+			OriginalCommand =
+				Cast<APF2CharacterCommand>(
+					APF2CharacterCommand::Create(Character1, FGameplayAbilitySpecHandle())->ToActor()
+				);
+
+			OriginalGeneration = OriginalCommand->GetGeneration();
+
+			CommandQueue = Character1->GetCommandQueueComponent();
+
+			CommandQueue->Enqueue(OriginalCommand);
+
+			// Cancel the command the same way that the default MoPRS implementation does.
+			if (CommandQueue->Remove(OriginalCommand))
+			{
+				UPF2CharacterCommandLibrary::ReleaseCommand(OriginalCommand);
+			}
+
+			ReusedCommand =
+				Cast<APF2CharacterCommand>(
+					APF2CharacterCommand::Create(Character2, FGameplayAbilitySpecHandle())->ToActor()
+				);
+		});
+
+		It("reuses the same command actor", [=, this]
+		{
+			TestEqual("ReusedCommand", ReusedCommand, OriginalCommand);
+		});
+
+		It("gives the reused command a different generation", [=, this]
+		{
+			TestNotEqual("GetGeneration()", ReusedCommand->GetGeneration(), OriginalGeneration);
+		});
+
+		It("treats requests made for the original use of the command as stale", [=, this]
+		{
+			TestFalse(
+				"IsCurrentGeneration(OriginalGeneration)",
+				ReusedCommand->IsCurrentGeneration(OriginalGeneration)
+			);
+		});
+
+		It("treats requests made for the current use of the command as current", [=, this]
+		{
+			TestTrue(
+				"IsCurrentGeneration(GetGeneration())",
+				ReusedCommand->IsCurrentGeneration(ReusedCommand->GetGeneration())
+			);
+		});
+
+		It("issues the reused command to the new character", [=, this]
+		{
+			TestEqual(
+				"GetOwningCharacter()",
+				ReusedCommand->GetOwningCharacter()->ToActor(),
+				Character2->ToActor()
+			);
+		});
+	});
+}
@@ -0,0 +1,172 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Commands/PF2QueuedCommandList.h"
+
+#include "Commands/PF2CharacterCommand.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2QueuedCommandListSpec,
+                     "OpenPF2.QueuedCommandList",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	TArray<APF2CharacterCommand*> Commands;
+
+	APF2CharacterCommand* CreateCommand();
+END_DEFINE_PF_SPEC(FPF2QueuedCommandListSpec)
+
+void FPF2QueuedCommandListSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+
+		this->Commands.Empty();
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			this->Commands.Add(this->CreateCommand());
+		}
+	});
+
+	AfterEach([=, this]
+	{
+		this->DestroyWorld();
+	});
+
+	Describe("Insert", [=, this]
+	{
+		It("keeps commands added to the end of the queue in the order they were added", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+			List.Insert(this->Commands[1], 1);
+			List.Insert(this->Commands[2], 2);
+
+			TestArrayEquals(
+				"GetCommandsInOrder()",
+				List.GetCommandsInOrder(),
+				TArray<AInfo*>({ this->Commands[0], this->Commands[1], this->Commands[2] })
+			);
+		});
+
+		It("places commands added to the front of the queue ahead of all other commands", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+			List.Insert(this->Commands[1], 1);
+			List.Insert(this->Commands[2], 0);
+
+			TestArrayEquals(
+				"GetCommandsInOrder()",
+				List.GetCommandsInOrder(),
+				TArray<AInfo*>({ this->Commands[2], this->Commands[0], this->Commands[1] })
+			);
+
+			TestEqual("GetCommandAt(0)", List.GetCommandAt(0), static_cast<AInfo*>(this->Commands[2]));
+		});
+
+		It("places commands added to the middle of the queue at the requested position", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+			List.Insert(this->Commands[1], 1);
+			List.Insert(this->Commands[2], 2);
+			List.Insert(this->Commands[3], 1);
+
+			TestArrayEquals(
+				"GetCommandsInOrder()",
+				List.GetCommandsInOrder(),
+				TArray<AInfo*>({ this->Commands[0], this->Commands[3], this->Commands[1], this->Commands[2] })
+			);
+		});
+	});
+
+	Describe("RemoveAt", [=, this]
+	{
+		It("removes the command at the given position and returns it", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+			List.Insert(this->Commands[1], 1);
+			List.Insert(this->Commands[2], 2);
+
+			TestEqual("RemoveAt(1)", List.RemoveAt(1), static_cast<AInfo*>(this->Commands[1]));
+			TestEqual("RemoveAt(0)", List.RemoveAt(0), static_cast<AInfo*>(this->Commands[0]));
+
+			TestArrayEquals(
+				"GetCommandsInOrder()",
+				List.GetCommandsInOrder(),
+				TArray<AInfo*>({ this->Commands[2] })
+			);
+
+			TestFalse("Contains(Commands[0])", List.Contains(this->Commands[0]));
+			TestFalse("Contains(Commands[1])", List.Contains(this->Commands[1]));
+		});
+
+		It("returns nullptr when the position is out of range", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+
+			TestNull("RemoveAt(1)", List.RemoveAt(1));
+			TestEqual("Num()", List.Num(), 1);
+		});
+	});
+
+	Describe("Remove", [=, this]
+	{
+		It("removes the given command without changing the order of the remaining commands", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+			List.Insert(this->Commands[1], 1);
+			List.Insert(this->Commands[2], 2);
+			List.Insert(this->Commands[3], 3);
+
+			TestTrue("Remove(Commands[1])", List.Remove(this->Commands[1]));
+			TestFalse("Remove(Commands[1]) again", List.Remove(this->Commands[1]));
+
+			TestArrayEquals(
+				"GetCommandsInOrder()",
+				List.GetCommandsInOrder(),
+				TArray<AInfo*>({ this->Commands[0], this->Commands[2], this->Commands[3] })
+			);
+		});
+	});
+
+	Describe("FindCommandById", [=, this]
+	{
+		It("finds commands that are still in the list after other commands have been removed", [=, this]
+		{
+			FPF2QueuedCommandList List;
+
+			List.Insert(this->Commands[0], 0);
+			List.Insert(this->Commands[1], 1);
+			List.Insert(this->Commands[2], 2);
+
+			// IDs are assigned in the order that commands are added, starting from 1.
+			List.Remove(this->Commands[0]);
+
+			TestNull("FindCommandById(1)", List.FindCommandById(1));
+			TestEqual("FindCommandById(2)", List.FindCommandById(2), static_cast<AInfo*>(this->Commands[1]));
+			TestEqual("FindCommandById(3)", List.FindCommandById(3), static_cast<AInfo*>(this->Commands[2]));
+		});
+	});
+}
+
+APF2CharacterCommand* FPF2QueuedCommandListSpec::CreateCommand()
+{
+	IPF2CharacterInterface*        Character   = this->SpawnCharacter();
+	IPF2CharacterCommandInterface* CommandIntf = APF2CharacterCommand::Create(Character, FGameplayAbilitySpecHandle());
+
+	return Cast<APF2CharacterCommand>(CommandIntf->ToActor());
+}
@@ -0,0 +1,212 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Dice/PF2BatchRoller.h"
+
+#include "Libraries/PF2DiceLibrary.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2BatchRollerSpec,
+                     "OpenPF2.Dice.BatchRoller",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2BatchRollerSpec)
+
+void FPF2BatchRollerSpec::Define()
+{
+	static constexpr int64 NumRolls = 200000;
+
+	// The largest acceptable difference between the frequency of any sum from the batch roller and from RollSum().
+	static constexpr float FrequencyTolerance = 0.01f;
+
+	static const TArray<FString> Expressions = { "1d20", "2d6", "3d8+2", "1d4-1" };
+
+	Describe(TEXT("RollSums"), [=, this]
+	{
+		for (const FString& ExpressionString : Expressions)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {ExpressionString}), [=, this]
+			{
+				It(TEXT("returns only sums between the minimum and maximum sum of the expression"), [=, this]
+				{
+					const FPF2DiceExpression Expression = FPF2DiceExpression::Parse(ExpressionString);
+					FPF2BatchRoller          Roller(1234);
+					TArray<int32>            Sums;
+
+					// Not a multiple of the block size, to exercise the partial block at the end.
+					Sums.SetNumUninitialized(FPF2BatchRoller::BlockSize * 3 + 17);
+
+					Roller.RollSums(Expression, Sums);
+
+					for (const int32 Sum : Sums)
+					{
+						if (!TestTrue(
+								FString::Format(TEXT("{0} is in range"), {Sum}),
+								(Sum >= Expression.GetMinSum()) && (Sum <= Expression.GetMaxSum())))
+						{
+							break;
+						}
+					}
+				});
+			});
+		}
+
+		Describe(TEXT("when given an invalid expression"), [=, this]
+		{
+			It(TEXT("fills the buffer with zeros"), [=, this]
+			{
+				FPF2BatchRoller Roller(1234);
+				TArray<int32>   Sums;
+
+				Sums.Init(5, 10);
+
+				Roller.RollSums(FPF2DiceExpression::Parse(TEXT("BAD")), Sums);
+
+				TestArrayEquals("Sums", Sums, TArray<int32>({0, 0, 0, 0, 0, 0, 0, 0, 0, 0}));
+			});
+		});
+
+		Describe(TEXT("when two rollers are given the same seed"), [=, this]
+		{
+			It(TEXT("returns the same sums from both"), [=, this]
+			{
+				const FPF2DiceExpression Expression = FPF2DiceExpression::Parse(TEXT("2d6"));
+				FPF2BatchRoller          Roller1(42),
+				                         Roller2(42);
+				TArray<int32>            Sums1,
+				                         Sums2;
+
+				Sums1.SetNumUninitialized(100);
+				Sums2.SetNumUninitialized(100);
+
+				Roller1.RollSums(Expression, Sums1);
+				Roller2.RollSums(Expression, Sums2);
+
+				TestArrayEquals("Sums2", Sums2, Sums1);
+			});
+		});
+	});
+
+	Describe(TEXT("RollHistogram"), [=, this]
+	{
+		for (const FString& ExpressionString : Expressions)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {ExpressionString}), [=, this]
+			{
+				It(TEXT("has one element for every possible sum and counts every roll"), [=, this]
+				{
+					const FPF2DiceExpression Expression = FPF2DiceExpression::Parse(ExpressionString);
+					FPF2BatchRoller          Roller(1234);
+					TArray<int64>            Histogram;
+					int64                    TotalCount = 0;
+
+					Roller.RollHistogram(Expression, 5000, Histogram);
+
+					for (const int64 Count : Histogram)
+					{
+						TotalCount += Count;
+					}
+
+					TestEqual("Num()", Histogram.Num(), Expression.GetMaxSum() - Expression.GetMinSum() + 1);
+					TestEqual("TotalCount", TotalCount, static_cast<int64>(5000));
+				});
+
+				It(TEXT("produces the same distribution of sums as UPF2DiceLibrary::RollSum()"), [=, this]
+				{
+					const FPF2DiceExpression Expression = FPF2DiceExpression::Parse(ExpressionString);
+					const int32              MinSum     = Expression.GetMinSum();
+					FPF2BatchRoller          Roller(1234);
+					TArray<int64>            BatchHistogram,
+					                         ReferenceHistogram;
+
+					Roller.RollHistogram(Expression, NumRolls, BatchHistogram);
+
+					ReferenceHistogram.SetNumZeroed(BatchHistogram.Num());
+
+					UPF2DiceLibrary::SetRandomSeed(1234);
+
+					for (int64 RollIndex = 0; RollIndex < NumRolls; ++RollIndex)
+					{
+						const int32 Sum = UPF2DiceLibrary::RollExpressionSum(Expression);
+
+						++ReferenceHistogram[Sum - MinSum];
+					}
+
+					for (int32 SumIndex = 0; SumIndex < BatchHistogram.Num(); ++SumIndex)
+					{
+						TestEqual(
+							FString::Format(TEXT("Frequency of {0}"), {SumIndex + MinSum}),
+							static_cast<float>(BatchHistogram[SumIndex]) / NumRolls,
+							static_cast<float>(ReferenceHistogram[SumIndex]) / NumRolls,
+							FrequencyTolerance
+						);
+					}
+				});
+			});
+		}
+
+		Describe(TEXT("when given an invalid expression"), [=, this]
+		{
+			It(TEXT("returns an empty histogram"), [=, this]
+			{
+				FPF2BatchRoller Roller(1234);
+				TArray<int64>   Histogram;
+
+				Roller.RollHistogram(FPF2DiceExpression::Parse(TEXT("BAD")), 100, Histogram);
+
+				TestTrue("Histogram.IsEmpty()", Histogram.IsEmpty());
+			});
+		});
+
+		Describe(TEXT("when given an expression whose maximum sum is less than its minimum sum"), [=, this]
+		{
+			It(TEXT("returns an empty histogram"), [=, this]
+			{
+				FPF2BatchRoller Roller(1234);
+				TArray<int64>   Histogram;
+
+				Roller.RollHistogram(FPF2DiceExpression(-2, 6), 100, Histogram);
+
+				TestTrue("Histogram.IsEmpty()", Histogram.IsEmpty());
+			});
+		});
+	});
+
+	Describe(TEXT("Throughput"), [=, this]
+	{
+		It(TEXT("reports the number of rolls per second of the batch roller and of UPF2DiceLibrary::RollSum()"), [=, this]
+		{
+			const FPF2DiceExpression Expression = FPF2DiceExpression::Parse(TEXT("2d6"));
+			FPF2BatchRoller          Roller(1234);
+			TArray<int64>            Histogram;
+			int64                    ReferenceTotal = 0;
+
+			const double BatchStartTime = FPlatformTime::Seconds();
+
+			Roller.RollHistogram(Expression, NumRolls * 10, Histogram);
+
+			const double BatchSeconds       = FPlatformTime::Seconds() - BatchStartTime;
+			const double ReferenceStartTime = FPlatformTime::Seconds();
+
+			for (int64 RollIndex = 0; RollIndex < NumRolls * 10; ++RollIndex)
+			{
+				ReferenceTotal += UPF2DiceLibrary::RollExpressionSum(Expression);
+			}
+
+			const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStartTime;
+
+			AddInfo(
+				FString::Printf(
+					TEXT("FPF2BatchRoller: %.0f rolls/sec; UPF2DiceLibrary::RollSum(): %.0f rolls/sec (checksum %lld)."),
+					(NumRolls * 10) / FMath::Max(BatchSeconds, UE_DOUBLE_SMALL_NUMBER),
+					(NumRolls * 10) / FMath::Max(ReferenceSeconds, UE_DOUBLE_SMALL_NUMBER),
+					ReferenceTotal
+				)
+			);
+
+			TestFalse("Histogram.IsEmpty()", Histogram.IsEmpty());
+		});
+	});
+}
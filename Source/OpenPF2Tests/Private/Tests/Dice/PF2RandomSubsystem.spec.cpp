@@ -0,0 +1,199 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Dice/PF2RandomSubsystem.h"
+#include "Dice/PF2ScopedRandomStream.h"
+
+#include "Libraries/PF2DiceLibrary.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2RandomSubsystemSpec,
+                     "OpenPF2.Dice.RandomSubsystem",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	UPF2RandomSubsystem* Subsystem;
+END_DEFINE_PF_SPEC(FPF2RandomSubsystemSpec)
+
+void FPF2RandomSubsystemSpec::Define()
+{
+	static const TArray ExpectedFirstRollResult = {17, 6, 2, 15, 9, 7, 20, 8, 7, 12};
+
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+
+		this->Subsystem = UPF2RandomSubsystem::Get(this->World);
+	});
+
+	AfterEach([=, this]
+	{
+		this->Subsystem = nullptr;
+
+		this->DestroyWorld();
+	});
+
+	Describe(TEXT("Get"), [=, this]
+	{
+		It(TEXT("returns a subsystem for the world"), [=, this]
+		{
+			TestNotNull("Subsystem", this->Subsystem);
+		});
+	});
+
+	Describe(TEXT("SetRandomSeed"), [=, this]
+	{
+		It(TEXT("sets the initial random seed of the world to '8675309'"), [=, this]
+		{
+			this->Subsystem->SetRandomSeed(8675309);
+
+			TestEqual("GetRandomSeed()", this->Subsystem->GetRandomSeed(), 8675309);
+		});
+
+		It(TEXT("does not change the seed of the fallback stream"), [=, this]
+		{
+			UPF2DiceLibrary::SetRandomSeed(1234);
+
+			this->Subsystem->SetRandomSeed(8675309);
+
+			TestEqual("UPF2DiceLibrary::GetRandomSeed()", UPF2DiceLibrary::GetRandomSeed(), 1234);
+		});
+	});
+
+	Describe(TEXT("GetWorldStream"), [=, this]
+	{
+		Describe(TEXT("when bound as the active stream"), [=, this]
+		{
+			It(FString::Format(TEXT("ensures that rolling a 10d20 once is: {0}"), {ArrayToString(ExpectedFirstRollResult)}), [=, this]
+			{
+				TArray<int32> ActualFirstRollResult;
+
+				this->Subsystem->SetRandomSeed(8675309);
+
+				{
+					FPF2ScopedRandomStream RngScope(this->Subsystem->GetWorldStream());
+
+					ActualFirstRollResult = UPF2DiceLibrary::Roll(10, 20);
+				}
+
+				TestArrayEquals("Roll(10, 20)", ActualFirstRollResult, ExpectedFirstRollResult);
+			});
+
+			It(TEXT("restores the previously-active stream when the scope ends"), [=, this]
+			{
+				FRandomStream* PreviousStream = UPF2DiceLibrary::GetActiveRandomStream();
+
+				{
+					FPF2ScopedRandomStream RngScope(this->Subsystem->GetWorldStream());
+
+					TestEqual(
+						"GetActiveRandomStream() inside scope",
+						UPF2DiceLibrary::GetActiveRandomStream(),
+						&this->Subsystem->GetWorldStream()
+					);
+				}
+
+				TestEqual("GetActiveRandomStream() after scope", UPF2DiceLibrary::GetActiveRandomStream(), PreviousStream);
+			});
+		});
+	});
+
+	Describe(TEXT("GetWorkerStream"), [=, this]
+	{
+		It(TEXT("returns the same stream each time it is called for the same worker"), [=, this]
+		{
+			FRandomStream& FirstStream  = this->Subsystem->GetWorkerStream(3);
+			FRandomStream& SecondStream = this->Subsystem->GetWorkerStream(3);
+
+			TestEqual("GetWorkerStream(3)", &SecondStream, &FirstStream);
+		});
+
+		It(TEXT("returns a stream with the same seed for the same worker and world seed"), [=, this]
+		{
+			int32 FirstSeed,
+			      SecondSeed;
+
+			this->Subsystem->SetRandomSeed(8675309);
+			FirstSeed = this->Subsystem->GetWorkerStream(3).GetInitialSeed();
+
+			this->Subsystem->SetRandomSeed(8675309);
+			SecondSeed = this->Subsystem->GetWorkerStream(3).GetInitialSeed();
+
+			TestEqual("GetWorkerStream(3).GetInitialSeed()", SecondSeed, FirstSeed);
+		});
+
+		It(TEXT("returns streams with different seeds for different workers"), [=, this]
+		{
+			this->Subsystem->SetRandomSeed(8675309);
+
+			TestNotEqual(
+				"GetWorkerStream(1).GetInitialSeed()",
+				this->Subsystem->GetWorkerStream(1).GetInitialSeed(),
+				this->Subsystem->GetWorkerStream(2).GetInitialSeed()
+			);
+		});
+	});
+
+	Describe(TEXT("GetCharacterStream"), [=, this]
+	{
+		BeforeEach([=, this]
+		{
+			this->SetupTestPawn();
+		});
+
+		AfterEach([=, this]
+		{
+			this->DestroyTestPawn();
+		});
+
+		It(TEXT("returns the same stream each time it is called for the same character"), [=, this]
+		{
+			FRandomStream& FirstStream  = this->Subsystem->GetCharacterStream(this->TestPawn);
+			FRandomStream& SecondStream = this->Subsystem->GetCharacterStream(this->TestPawn);
+
+			TestEqual("GetCharacterStream()", &SecondStream, &FirstStream);
+		});
+
+		It(TEXT("returns a stream that is seeded from the world seed"), [=, this]
+		{
+			int32 FirstSeed,
+			      SecondSeed;
+
+			this->Subsystem->SetRandomSeed(8675309);
+			FirstSeed = this->Subsystem->GetCharacterStream(this->TestPawn).GetInitialSeed();
+
+			this->Subsystem->SetRandomSeed(8675309);
+			SecondSeed = this->Subsystem->GetCharacterStream(this->TestPawn).GetInitialSeed();
+
+			TestEqual("GetInitialSeed()", SecondSeed, FirstSeed);
+		});
+	});
+
+	Describe(TEXT("CreateChildStream"), [=, this]
+	{
+		It(TEXT("returns streams that are reproducible for the same key"), [=, this]
+		{
+			this->Subsystem->SetRandomSeed(8675309);
+
+			FRandomStream FirstStream  = this->Subsystem->CreateChildStream(42),
+			              SecondStream = this->Subsystem->CreateChildStream(42);
+
+			for (int RollIndex = 0; RollIndex < 10; ++RollIndex)
+			{
+				TestEqual("RandRange(1, 20)", SecondStream.RandRange(1, 20), FirstStream.RandRange(1, 20));
+			}
+		});
+
+		It(TEXT("returns streams with different seeds for different keys"), [=, this]
+		{
+			this->Subsystem->SetRandomSeed(8675309);
+
+			TestNotEqual(
+				"GetInitialSeed()",
+				this->Subsystem->CreateChildStream(1).GetInitialSeed(),
+				this->Subsystem->CreateChildStream(2).GetInitialSeed()
+			);
+		});
+	});
+}
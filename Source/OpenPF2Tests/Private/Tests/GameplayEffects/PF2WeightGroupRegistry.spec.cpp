@@ -0,0 +1,86 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "GameplayEffects/PF2WeightGroupRegistry.h"
+
+#include "PF2CharacterConstants.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2WeightGroupRegistrySpec,
+                     "OpenPF2.GameplayEffects.WeightGroupRegistry",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2WeightGroupRegistrySpec)
+
+void FPF2WeightGroupRegistrySpec::Define()
+{
+	static const TArray<FName> WeightGroups = {
+		PF2CharacterConstants::GeWeightGroups::InitializeBaseStats,
+		PF2CharacterConstants::GeWeightGroups::PostInitializeBaseStats,
+		PF2CharacterConstants::GeWeightGroups::ManagedEffects,
+		PF2CharacterConstants::GeWeightGroups::PreAbilityBoosts,
+		PF2CharacterConstants::GeWeightGroups::AbilityBoosts,
+		PF2CharacterConstants::GeWeightGroups::PreFinalizeStats,
+		PF2CharacterConstants::GeWeightGroups::FinalizeStats,
+	};
+
+	Describe(TEXT("GetPriority"), [=, this]
+	{
+		It(TEXT("returns a priority for every weight group registered with the project"), [=, this]
+		{
+			const FPF2WeightGroupRegistry& Registry = FPF2WeightGroupRegistry::GetInstance();
+
+			for (const FName& WeightGroup : WeightGroups)
+			{
+				TestNotEqual(WeightGroup.ToString(), Registry.GetPriority(WeightGroup), INDEX_NONE);
+			}
+		});
+
+		It(TEXT("returns priorities that increase in weight order"), [=, this]
+		{
+			const FPF2WeightGroupRegistry& Registry = FPF2WeightGroupRegistry::GetInstance();
+
+			for (int32 GroupIndex = 1; GroupIndex < WeightGroups.Num(); ++GroupIndex)
+			{
+				TestTrue(
+					WeightGroups[GroupIndex].ToString(),
+					Registry.GetPriority(WeightGroups[GroupIndex - 1]) < Registry.GetPriority(WeightGroups[GroupIndex])
+				);
+			}
+		});
+
+		It(TEXT("returns INDEX_NONE for a weight group that is not registered"), [=, this]
+		{
+			TestEqual(
+				"GetPriority()",
+				FPF2WeightGroupRegistry::GetInstance().GetPriority(FName(TEXT("GameplayEffect.WeightGroup.99_Missing"))),
+				INDEX_NONE
+			);
+		});
+	});
+
+	Describe(TEXT("IsBefore"), [=, this]
+	{
+		It(TEXT("orders weight groups the same way as comparing their names"), [=, this]
+		{
+			const FPF2WeightGroupRegistry& Registry  = FPF2WeightGroupRegistry::GetInstance();
+			TArray<FName>                  AllGroups = WeightGroups;
+
+			AllGroups.Add(FName(TEXT("GameplayEffect.WeightGroup.12_Unregistered")));
+
+			for (const FName& WeightGroup : AllGroups)
+			{
+				for (const FName& OtherWeightGroup : AllGroups)
+				{
+					TestEqual(
+						FString::Format(TEXT("IsBefore('{0}', '{1}')"), {WeightGroup.ToString(), OtherWeightGroup.ToString()}),
+						Registry.IsBefore(WeightGroup, OtherWeightGroup),
+						WeightGroup.LexicalLess(OtherWeightGroup)
+					);
+				}
+			}
+		});
+	});
+}
@@ -0,0 +1,291 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Items/PF2InventoryItemList.h"
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestInventoryComponent.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2InventoryItemListSpec,
+                     "OpenPF2.InventoryItemList",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	const FPrimaryAssetId ShortswordId = FPrimaryAssetId(TEXT("PF2Item"), TEXT("Shortsword"));
+	const FPrimaryAssetId ShortbowId   = FPrimaryAssetId(TEXT("PF2Item"), TEXT("Shortbow"));
+	const FPrimaryAssetId ArrowsId     = FPrimaryAssetId(TEXT("PF2Item"), TEXT("Arrows"));
+
+	UPF2TestInventoryComponent* InventoryComponent;
+
+	void SetupInventoryComponent();
+	TArray<int32> AddReplicatedEntries(const TArray<FPrimaryAssetId>& ItemIds);
+END_DEFINE_PF_SPEC(FPF2InventoryItemListSpec)
+
+void FPF2InventoryItemListSpec::Define()
+{
+	Describe("Add", [=, this]
+	{
+		It("adds items that are not already in the list", [=, this]
+		{
+			FPF2InventoryItemList List;
+
+			TestTrue("Add(ShortswordId)", List.Add(this->ShortswordId, nullptr));
+			TestTrue("Add(ShortbowId)", List.Add(this->ShortbowId, nullptr));
+
+			TestEqual("Num()", List.Num(), 2);
+			TestTrue("Contains(ShortswordId)", List.Contains(this->ShortswordId));
+			TestTrue("Contains(ShortbowId)", List.Contains(this->ShortbowId));
+			TestFalse("Contains(ArrowsId)", List.Contains(this->ArrowsId));
+		});
+
+		It("does not add the same item more than once", [=, this]
+		{
+			FPF2InventoryItemList List;
+
+			TestTrue("Add(ShortswordId)", List.Add(this->ShortswordId, nullptr));
+			TestFalse("Add(ShortswordId) again", List.Add(this->ShortswordId, nullptr));
+
+			TestEqual("Num()", List.Num(), 1);
+		});
+	});
+
+	Describe("Remove", [=, this]
+	{
+		It("removes the given item without removing any other items", [=, this]
+		{
+			FPF2InventoryItemList List;
+
+			List.Add(this->ShortswordId, nullptr);
+			List.Add(this->ShortbowId, nullptr);
+			List.Add(this->ArrowsId, nullptr);
+
+			TestTrue("Remove(ShortswordId)", List.Remove(this->ShortswordId));
+			TestFalse("Remove(ShortswordId) again", List.Remove(this->ShortswordId));
+
+			TestEqual("Num()", List.Num(), 2);
+			TestFalse("Contains(ShortswordId)", List.Contains(this->ShortswordId));
+			TestTrue("Contains(ShortbowId)", List.Contains(this->ShortbowId));
+			TestTrue("Contains(ArrowsId)", List.Contains(this->ArrowsId));
+		});
+	});
+
+	Describe("Reset", [=, this]
+	{
+		It("removes all items", [=, this]
+		{
+			FPF2InventoryItemList List;
+
+			List.Add(this->ShortswordId, nullptr);
+			List.Add(this->ShortbowId, nullptr);
+
+			List.Reset();
+
+			TestEqual("Num()", List.Num(), 0);
+			TestFalse("Contains(ShortswordId)", List.Contains(this->ShortswordId));
+		});
+	});
+
+	Describe("GetItemIds", [=, this]
+	{
+		It("returns the IDs of all items, including items that have not been loaded", [=, this]
+		{
+			FPF2InventoryItemList   List;
+			TArray<FPrimaryAssetId> ItemIds;
+
+			List.Add(this->ShortswordId, nullptr);
+			List.Add(this->ShortbowId, nullptr);
+
+			ItemIds = List.GetItemIds();
+
+			TestEqual("ItemIds.Num()", ItemIds.Num(), 2);
+			TestTrue("ItemIds.Contains(ShortswordId)", ItemIds.Contains(this->ShortswordId));
+			TestTrue("ItemIds.Contains(ShortbowId)", ItemIds.Contains(this->ShortbowId));
+		});
+	});
+
+	Describe("GetLoadedItems", [=, this]
+	{
+		It("omits items that have not been loaded", [=, this]
+		{
+			FPF2InventoryItemList List;
+
+			List.Add(this->ShortswordId, nullptr);
+
+			TestEqual("GetLoadedItems().Num()", List.GetLoadedItems().Num(), 0);
+		});
+	});
+
+	Describe("when replicated to a client", [=, this]
+	{
+		BeforeEach([=, this]
+		{
+			this->SetupWorld();
+			this->SetupTestPawn();
+			this->SetupInventoryComponent();
+		});
+
+		AfterEach([=, this]
+		{
+			this->InventoryComponent = nullptr;
+
+			this->DestroyTestPawn();
+			this->DestroyWorld();
+		});
+
+		It("loads all of the items added in the same update together", [=, this]
+		{
+			this->AddReplicatedEntries({ this->ShortswordId, this->ShortbowId });
+			this->InventoryComponent->OnRep_InventoryItems();
+
+			const TArray<TArray<FPrimaryAssetId>>& LoadRequests = this->InventoryComponent->GetLoadRequests();
+
+			TestEqual("LoadRequests.Num()", LoadRequests.Num(), 1);
+			TestEqual("LoadRequests[0].Num()", LoadRequests[0].Num(), 2);
+			TestTrue("LoadRequests[0].Contains(ShortswordId)", LoadRequests[0].Contains(this->ShortswordId));
+			TestTrue("LoadRequests[0].Contains(ShortbowId)", LoadRequests[0].Contains(this->ShortbowId));
+
+			// No events are fired until the items have loaded.
+			TestEqual("GetRecordedEvents().Num()", this->InventoryComponent->GetRecordedEvents().Num(), 0);
+
+			this->InventoryComponent->CompletePendingLoads();
+
+			TestArrayEquals(
+				"GetRecordedEvents()",
+				this->InventoryComponent->GetRecordedEvents(),
+				TArray<FString>({ TEXT("Added:Shortsword"), TEXT("Added:Shortbow"), TEXT("Changed") })
+			);
+			TestEqual("GetContents().Num()", this->InventoryComponent->GetContents().Num(), 2);
+		});
+
+		It("does not load an item that is removed in the same update in which it was added", [=, this]
+		{
+			const TArray<int32> ReplicationIds = this->AddReplicatedEntries({ this->ShortswordId });
+
+			this->InventoryComponent->OnRep_InventoryItemRemoved(
+				*this->InventoryComponent->FindReplicatedEntry(ReplicationIds[0])
+			);
+			this->InventoryComponent->RemoveReplicatedEntry(this->ShortswordId);
+
+			this->InventoryComponent->OnRep_InventoryItems();
+
+			TestEqual("GetLoadRequests().Num()", this->InventoryComponent->GetLoadRequests().Num(), 0);
+			TestEqual("GetRecordedEvents().Num()", this->InventoryComponent->GetRecordedEvents().Num(), 0);
+		});
+
+		It("does not fire an add event for an item that is removed while it is loading", [=, this]
+		{
+			const TArray<int32> ReplicationIds =
+				this->AddReplicatedEntries({ this->ShortswordId, this->ShortbowId });
+
+			this->InventoryComponent->OnRep_InventoryItems();
+
+			this->InventoryComponent->OnRep_InventoryItemRemoved(
+				*this->InventoryComponent->FindReplicatedEntry(ReplicationIds[0])
+			);
+			this->InventoryComponent->RemoveReplicatedEntry(this->ShortswordId);
+			this->InventoryComponent->OnRep_InventoryItems();
+
+			this->InventoryComponent->CompletePendingLoads();
+
+			TestEqual("GetLoadRequests().Num()", this->InventoryComponent->GetLoadRequests().Num(), 1);
+			TestArrayEquals(
+				"GetRecordedEvents()",
+				this->InventoryComponent->GetRecordedEvents(),
+				TArray<FString>({ TEXT("Added:Shortbow"), TEXT("Changed") })
+			);
+		});
+
+		It("fires a remove event for an item that is removed after it has loaded", [=, this]
+		{
+			const TArray<int32> ReplicationIds = this->AddReplicatedEntries({ this->ShortswordId });
+
+			this->InventoryComponent->OnRep_InventoryItems();
+			this->InventoryComponent->CompletePendingLoads();
+
+			this->InventoryComponent->OnRep_InventoryItemRemoved(
+				*this->InventoryComponent->FindReplicatedEntry(ReplicationIds[0])
+			);
+			this->InventoryComponent->RemoveReplicatedEntry(this->ShortswordId);
+			this->InventoryComponent->OnRep_InventoryItems();
+
+			TestArrayEquals(
+				"GetRecordedEvents()",
+				this->InventoryComponent->GetRecordedEvents(),
+				TArray<FString>({
+					TEXT("Added:Shortsword"),
+					TEXT("Changed"),
+					TEXT("Removed:Shortsword"),
+					TEXT("Changed"),
+				})
+			);
+			TestEqual("GetContents().Num()", this->InventoryComponent->GetContents().Num(), 0);
+		});
+
+		It("fires a remove event and then an add event when an entry changes to a different item", [=, this]
+		{
+			const TArray<int32> ReplicationIds = this->AddReplicatedEntries({ this->ShortswordId });
+
+			this->InventoryComponent->OnRep_InventoryItems();
+			this->InventoryComponent->CompletePendingLoads();
+
+			FPF2InventoryItemEntry* Entry = this->InventoryComponent->FindReplicatedEntry(ReplicationIds[0]);
+
+			Entry->ItemId = this->ArrowsId;
+
+			this->InventoryComponent->OnRep_InventoryItemChanged(*Entry);
+			this->InventoryComponent->OnRep_InventoryItems();
+
+			const TArray<TArray<FPrimaryAssetId>>& LoadRequests = this->InventoryComponent->GetLoadRequests();
+
+			TestEqual("LoadRequests.Num()", LoadRequests.Num(), 2);
+			TestEqual("LoadRequests[1].Num()", LoadRequests[1].Num(), 1);
+			TestTrue("LoadRequests[1].Contains(ArrowsId)", LoadRequests[1].Contains(this->ArrowsId));
+
+			this->InventoryComponent->CompletePendingLoads();
+
+			TestArrayEquals(
+				"GetRecordedEvents()",
+				this->InventoryComponent->GetRecordedEvents(),
+				TArray<FString>({
+					TEXT("Added:Shortsword"),
+					TEXT("Changed"),
+					TEXT("Removed:Shortsword"),
+					TEXT("Changed"),
+					TEXT("Added:Arrows"),
+					TEXT("Changed"),
+				})
+			);
+		});
+	});
+}
+
+void FPF2InventoryItemListSpec::SetupInventoryComponent()
+{
+	this->InventoryComponent = this->SpawnActorComponent<UPF2TestInventoryComponent>();
+
+	this->InventoryComponent->AddLoadableItem(this->ShortswordId);
+	this->InventoryComponent->AddLoadableItem(this->ShortbowId);
+	this->InventoryComponent->AddLoadableItem(this->ArrowsId);
+
+	this->InventoryComponent->StartRecordingEvents();
+}
+
+TArray<int32> FPF2InventoryItemListSpec::AddReplicatedEntries(const TArray<FPrimaryAssetId>& ItemIds)
+{
+	// Replication adds all of the entries of an update before it notifies the component about any of them.
+	TArray<int32> ReplicationIds;
+
+	for (const FPrimaryAssetId& ItemId : ItemIds)
+	{
+		ReplicationIds.Add(this->InventoryComponent->AddReplicatedEntry(ItemId));
+	}
+
+	for (const int32 ReplicationId : ReplicationIds)
+	{
+		this->InventoryComponent->OnRep_InventoryItemAdded(
+			*this->InventoryComponent->FindReplicatedEntry(ReplicationId)
+		);
+	}
+
+	return ReplicationIds;
+}
@@ -0,0 +1,150 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Libraries/PF2AttackStatLibrary.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2AttackStatLibrarySpec,
+                     "OpenPF2.Libraries.AttackStats",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2AttackStatLibrarySpec)
+
+void FPF2AttackStatLibrarySpec::Define()
+{
+	struct FDistributionTestTuple
+	{
+		float Modifier;
+		float DifficultyClass;
+		float CriticalSuccess;
+		float Success;
+		float Failure;
+		float CriticalFailure;
+	};
+
+	Describe(TEXT("GetDegreeOfSuccessDistribution"), [=, this]
+	{
+		TArray<FDistributionTestTuple> ExpectedValues =
+		{
+			// Modifier,  DC, Crit. Success, Success, Failure, Crit. Failure
+			{       0.0f, 11.0f,        0.05f,   0.45f,   0.45f,         0.05f },
+			{      10.0f, 10.0f,        0.55f,   0.40f,   0.05f,         0.00f },
+			{      10.0f, 25.0f,        0.05f,   0.25f,   0.45f,         0.25f },
+			{       0.0f, 50.0f,        0.00f,   0.00f,   0.05f,         0.95f },
+			{      50.0f,  0.0f,        0.95f,   0.05f,   0.00f,         0.00f },
+			// Fractional margins are rounded down, not up into the next band.
+			{       9.5f, 10.0f,        0.50f,   0.45f,   0.05f,         0.00f },
+			{       0.5f,  0.0f,        0.55f,   0.40f,   0.05f,         0.00f },
+		};
+
+		for (const auto& [Modifier, DifficultyClass, CriticalSuccess, Success, Failure, CriticalFailure] : ExpectedValues)
+		{
+			Describe(FString::Format(TEXT("when given a modifier of '{0}' against DC '{1}'"), {Modifier, DifficultyClass}), [=, this]
+			{
+				It(TEXT("returns the probability of each degree of success"), [=, this]
+				{
+					const FPF2DegreeOfSuccessDistribution Distribution =
+						UPF2AttackStatLibrary::GetDegreeOfSuccessDistribution(Modifier, DifficultyClass);
+
+					TestEqual("CriticalSuccess", Distribution.CriticalSuccess, CriticalSuccess);
+					TestEqual("Success", Distribution.Success, Success);
+					TestEqual("Failure", Distribution.Failure, Failure);
+					TestEqual("CriticalFailure", Distribution.CriticalFailure, CriticalFailure);
+				});
+			});
+		}
+
+		for (int32 Margin = -35; Margin <= 35; ++Margin)
+		{
+			Describe(FString::Format(TEXT("when the modifier exceeds the DC by '{0}'"), {Margin}), [=, this]
+			{
+				It(TEXT("returns probabilities that sum to 1.0"), [=, this]
+				{
+					const FPF2DegreeOfSuccessDistribution Distribution =
+						UPF2AttackStatLibrary::GetDegreeOfSuccessDistribution(Margin, 0.0f);
+
+					TestEqual(
+						"Sum",
+						Distribution.CriticalSuccess + Distribution.Success + Distribution.Failure +
+							Distribution.CriticalFailure,
+						1.0f
+					);
+				});
+
+				It(TEXT("matches the results of a flat check on every face of the d20"), [=, this]
+				{
+					const FPF2DegreeOfSuccessDistribution Distribution =
+						UPF2AttackStatLibrary::GetDegreeOfSuccessDistribution(Margin, 0.0f);
+
+					float ExpectedSuccessOrBetter = 0.0f;
+
+					for (int32 DieRoll = 1; DieRoll <= 20; ++DieRoll)
+					{
+						EPF2DegreeOfSuccess Result =
+							UPF2AttackStatLibrary::DetermineDegreeOfSuccessForCheck(DieRoll + Margin, 0.0f);
+
+						if ((DieRoll == 20) && (Result != EPF2DegreeOfSuccess::CriticalSuccess))
+						{
+							Result = UPF2AttackStatLibrary::IncreaseDegreeOfSuccess(Result);
+						}
+						else if ((DieRoll == 1) && (Result != EPF2DegreeOfSuccess::CriticalFailure))
+						{
+							Result = UPF2AttackStatLibrary::DecreaseDegreeOfSuccess(Result);
+						}
+
+						if (UPF2AttackStatLibrary::IsSuccess(Result))
+						{
+							ExpectedSuccessOrBetter += 1.0f / 20.0f;
+						}
+					}
+
+					TestEqual("GetSuccessOrBetter()", Distribution.GetSuccessOrBetter(), ExpectedSuccessOrBetter);
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("CalculateExpectedDamageRoll"), [=, this]
+	{
+		TMap<FString, float> ExpectedValues =
+		{
+			{ "1d6",    3.5f  },
+			{ "2d6",    7.0f  },
+			{ "2d8+4", 13.0f  },
+			{ "1d4-1",  1.5f  },
+			{ "BAD",    0.0f  },
+		};
+
+		for (const auto& [DamageDie, ExpectedDamage] : ExpectedValues)
+		{
+			Describe(FString::Format(TEXT("when given '{0}' with a damage ability modifier of '2'"), {DamageDie}), [=, this]
+			{
+				It(FString::Format(TEXT("returns '{0}'"), {ExpectedDamage + 2.0f}), [=, this]
+				{
+					TestEqual(
+						"CalculateExpectedDamageRoll()",
+						UPF2AttackStatLibrary::CalculateExpectedDamageRoll(FName(DamageDie), 2.0f),
+						ExpectedDamage + 2.0f
+					);
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("CalculateExpectedStrikeDamage"), [=, this]
+	{
+		It(TEXT("counts critical hits as double damage and misses as no damage"), [=, this]
+		{
+			const FPF2DegreeOfSuccessDistribution Distribution(0.25f, 0.25f, 0.25f, 0.25f);
+
+			// 2d6 + 3 = 10 on average; 0.25 * 10 + 0.25 * 20 = 7.5
+			TestEqual(
+				"CalculateExpectedStrikeDamage()",
+				UPF2AttackStatLibrary::CalculateExpectedStrikeDamage(Distribution, FName(TEXT("2d6")), 3.0f),
+				7.5f
+			);
+		});
+	});
+}
@@ -37,6 +37,15 @@ void FPF2DiceLibrarySpec::Define()
 		int MaxSum;
 	};
 
+	struct FCompileRollExpressionTestTuple
+	{
+		FString RollExpression;
+		bool bIsValid;
+		int RollCount;
+		int DieSize;
+		int Modifier;
+	};
+
 	struct FParseRollExpressionTestTuple
 	{
 		FString RollExpression;
@@ -57,6 +66,9 @@ void FPF2DiceLibrarySpec::Define()
 			{   "2d6",       1,      12 },
 			{   "1d2",       1,       2 },
 			{   "3d5",       1,      15 },
+			{ "2d8+4",       6,      20 },
+			{ "1d4-1",       0,       3 },
+			{ "1d6+",        0,       0 },
 		};
 
 		for (const auto& [RollExpression, MinSum, MaxSum] : ExpectedRanges)
@@ -320,6 +332,85 @@ void FPF2DiceLibrarySpec::Define()
 		}
 	});
 
+	Describe(TEXT("GetExpectedRollStringSum"), [=, this]
+	{
+		TMap<FString, float> ExpectedValues =
+		{
+			{ "1d6",    3.5f },
+			{ "2d6",    7.0f },
+			{ "2d8+4", 13.0f },
+			{ "1d0",    0.0f },
+			{ "BAD",    0.0f },
+		};
+
+		for (const auto& [RollExpression, ExpectedSum] : ExpectedValues)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {RollExpression}), [=, this]
+			{
+				It(FString::Format(TEXT("returns '{0}'"), {ExpectedSum}), [=, this]
+				{
+					TestEqual(
+						"Result",
+						UPF2DiceLibrary::GetExpectedRollStringSum(FName(RollExpression)),
+						ExpectedSum
+					);
+				});
+			});
+		}
+	});
+
+	Describe(TEXT("RollInline"), [=, this]
+	{
+		for (const int32 RollCount : {0, 1, 10, 32, 40})
+		{
+			Describe(FString::Format(TEXT("when given '{0}d20'"), {FString::FormatAsNumber(RollCount)}), [=, this]
+			{
+				It(FString::Format(TEXT("returns {0} results"), {FString::FormatAsNumber(RollCount)}), [=, this]
+				{
+					FPF2InlineDiceRolls Rolls;
+
+					UPF2DiceLibrary::RollInline(RollCount, 20, Rolls);
+
+					TestEqual("Rolls.Num()", Rolls.Num(), RollCount);
+				});
+
+				It(TEXT("returns the same results as Roll() given the same random seed"), [=, this]
+				{
+					FPF2InlineDiceRolls InlineRolls;
+					TArray<int32>       ExpectedRolls;
+
+					UPF2DiceLibrary::SetRandomSeed(8675309);
+					ExpectedRolls = UPF2DiceLibrary::Roll(RollCount, 20);
+
+					UPF2DiceLibrary::SetRandomSeed(8675309);
+					UPF2DiceLibrary::RollInline(RollCount, 20, InlineRolls);
+
+					TestArrayEquals("RollInline()", TArray<int32>(InlineRolls), ExpectedRolls);
+				});
+
+				It(TEXT("returns results that sum to the same value as RollSum() given the same random seed"), [=, this]
+				{
+					FPF2InlineDiceRolls InlineRolls;
+					int32               InlineSum = 0,
+					                    ExpectedSum;
+
+					UPF2DiceLibrary::SetRandomSeed(8675309);
+					ExpectedSum = UPF2DiceLibrary::RollSum(RollCount, 20);
+
+					UPF2DiceLibrary::SetRandomSeed(8675309);
+					UPF2DiceLibrary::RollInline(RollCount, 20, InlineRolls);
+
+					for (const int32 Roll : InlineRolls)
+					{
+						InlineSum += Roll;
+					}
+
+					TestEqual("Sum of RollInline()", InlineSum, ExpectedSum);
+				});
+			});
+		}
+	});
+
 	Describe(TEXT("NextSizeString"), [=, this]
 	{
 		TMap<FString, FString> ExpectedValues =
@@ -329,6 +420,8 @@ void FPF2DiceLibrarySpec::Define()
 			{ "1d3",  "1d5"  },
 			{ "8d1",  "8d3"  },
 			{ "1d16", "1d18" },
+			{ "2d4+1", "2d6+1" },
+			{ "1d4-1", "1d6-1" },
 		};
 
 		for (const auto& TestParameters : ExpectedValues)
@@ -379,6 +472,49 @@ void FPF2DiceLibrarySpec::Define()
 		}
 	});
 
+	Describe(TEXT("CompileRollExpression"), [=, this]
+	{
+		TArray<FCompileRollExpressionTestTuple> ExpectedValues =
+		{
+			{"1d6",        true,  1,  6,  0},
+			{"2D8",        true,  2,  8,  0},
+			{"2d8+4",      true,  2,  8,  4},
+			{"1d4-1",      true,  1,  4, -1},
+			{"10d12+10",   true, 10, 12, 10},
+			{"d6",         false, 0,  0,  0},
+			{"1d6+",       false, 0,  0,  0},
+			{"1d6+2+2",    false, 0,  0,  0},
+			{"1d6 + 2",    false, 0,  0,  0},
+			{"1d9999999999", false, 0, 0, 0},
+			{"BAD",        false, 0,  0,  0},
+		};
+
+		for (const auto& [RollExpression, bExpectedIsValid, ExpectedRollCount, ExpectedDieSize, ExpectedModifier] : ExpectedValues)
+		{
+			Describe(FString::Format(TEXT("when given '{0}'"), {RollExpression}), [=, this]
+			{
+				It(FString::Format(TEXT("{0} as roll count {1}, dice size {2}, and modifier {3}"), {bExpectedIsValid ? "compiles" : "fails to compile", FString::FormatAsNumber(ExpectedRollCount), FString::FormatAsNumber(ExpectedDieSize), FString::FormatAsNumber(ExpectedModifier)}), [=, this]
+				{
+					const FPF2DiceExpression Expression = UPF2DiceLibrary::CompileRollExpression(FName(RollExpression));
+
+					TestEqual("bIsValid", Expression.bIsValid, bExpectedIsValid);
+					TestEqual("RollCount", Expression.RollCount, ExpectedRollCount);
+					TestEqual("DieSize", Expression.DieSize, ExpectedDieSize);
+					TestEqual("Modifier", Expression.Modifier, ExpectedModifier);
+				});
+
+				It(TEXT("returns the same result when compiled a second time"), [=, this]
+				{
+					const FPF2DiceExpression FirstExpression  = UPF2DiceLibrary::CompileRollExpression(FName(RollExpression)),
+					                         SecondExpression = UPF2DiceLibrary::CompileRollExpression(FName(RollExpression));
+
+					TestEqual("ToString()", SecondExpression.ToString(), FirstExpression.ToString());
+					TestEqual("bIsValid", SecondExpression.bIsValid, FirstExpression.bIsValid);
+				});
+			});
+		}
+	});
+
 	Describe(TEXT("ParseRollExpression"), [=, this]
 	{
 		TArray<FParseRollExpressionTestTuple> ExpectedValues =
@@ -388,6 +524,7 @@ void FPF2DiceLibrarySpec::Define()
 			{"8d1",  true,  8, 1},
 			{"8d-1", false, 0, 0},
 			{"BAD",  false, 0, 0},
+			{"2d8+4", false, 0, 0},
 		};
 
 		for (const auto& [RollExpression, bExpectedWasParsed, ExpectedRollCount, ExpectedDieSize] : ExpectedValues)
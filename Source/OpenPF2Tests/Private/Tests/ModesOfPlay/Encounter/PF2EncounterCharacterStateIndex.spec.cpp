@@ -0,0 +1,135 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ModesOfPlay/Encounter/PF2EncounterCharacterStateIndex.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2EncounterCharacterStateIndexSpec,
+                     "OpenPF2.EncounterCharacterStateIndex",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	/**
+	 * Builds the states of a character.
+	 *
+	 * @param bIsAlive
+	 *	Whether the character has hit points remaining.
+	 * @param bIsPlayerControlled
+	 *	Whether the character is controlled by a player.
+	 * @param bIsDying
+	 *	Whether the character has the dying condition.
+	 *
+	 * @return
+	 *	The states of the character.
+	 */
+	static FPF2EncounterCharacterStates MakeStates(const bool bIsAlive,
+	                                               const bool bIsPlayerControlled,
+	                                               const bool bIsDying = false);
+END_DEFINE_PF_SPEC(FPF2EncounterCharacterStateIndexSpec)
+
+void FPF2EncounterCharacterStateIndexSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+	});
+
+	AfterEach([=, this]
+	{
+		this->DestroyWorld();
+	});
+
+	Describe(TEXT("SetCharacterStates"), [=, this]
+	{
+		It(TEXT("counts each character that is added in each of its states"), [=, this]
+		{
+			FPF2EncounterCharacterStateIndex Index;
+
+			Index.SetCharacterStates(this->SpawnCharacter(), MakeStates(true, true));
+			Index.SetCharacterStates(this->SpawnCharacter(), MakeStates(true, false));
+			Index.SetCharacterStates(this->SpawnCharacter(), MakeStates(false, false, true));
+
+			TestEqual("Num()", Index.Num(), 3);
+			TestEqual("GetNumAlive()", Index.GetNumAlive(), 2);
+			TestEqual("GetNumDying()", Index.GetNumDying(), 1);
+			TestEqual("GetNumPlayerControlled()", Index.GetNumPlayerControlled(), 1);
+			TestEqual("GetNumAlivePlayerControlled()", Index.GetNumAlivePlayerControlled(), 1);
+			TestEqual("GetNumAliveNonPlayerControlled()", Index.GetNumAliveNonPlayerControlled(), 1);
+		});
+
+		It(TEXT("replaces the states of a character that is already in the index"), [=, this]
+		{
+			FPF2EncounterCharacterStateIndex Index;
+			IPF2CharacterInterface*          Character = this->SpawnCharacter();
+
+			Index.SetCharacterStates(Character, MakeStates(true, true));
+			Index.SetCharacterStates(Character, MakeStates(false, true, true));
+
+			TestEqual("Num()", Index.Num(), 1);
+			TestEqual("GetNumAlive()", Index.GetNumAlive(), 0);
+			TestEqual("GetNumDying()", Index.GetNumDying(), 1);
+			TestEqual("GetNumPlayerControlled()", Index.GetNumPlayerControlled(), 1);
+			TestEqual("GetNumAlivePlayerControlled()", Index.GetNumAlivePlayerControlled(), 0);
+		});
+	});
+
+	Describe(TEXT("RemoveCharacter"), [=, this]
+	{
+		It(TEXT("stops counting the states of the character"), [=, this]
+		{
+			FPF2EncounterCharacterStateIndex Index;
+			IPF2CharacterInterface*          Character1 = this->SpawnCharacter();
+			IPF2CharacterInterface*          Character2 = this->SpawnCharacter();
+
+			Index.SetCharacterStates(Character1, MakeStates(true, true));
+			Index.SetCharacterStates(Character2, MakeStates(true, false));
+
+			TestTrue("RemoveCharacter(Character1)", Index.RemoveCharacter(Character1));
+
+			TestFalse("Contains(Character1)", Index.Contains(Character1));
+			TestTrue("Contains(Character2)", Index.Contains(Character2));
+			TestEqual("GetNumAlive()", Index.GetNumAlive(), 1);
+			TestEqual("GetNumAlivePlayerControlled()", Index.GetNumAlivePlayerControlled(), 0);
+		});
+
+		It(TEXT("returns false for a character that is not in the index"), [=, this]
+		{
+			FPF2EncounterCharacterStateIndex Index;
+
+			TestFalse("RemoveCharacter()", Index.RemoveCharacter(this->SpawnCharacter()));
+			TestEqual("GetNumAlive()", Index.GetNumAlive(), 0);
+		});
+	});
+
+	Describe(TEXT("Reset"), [=, this]
+	{
+		It(TEXT("removes all characters and clears all counts"), [=, this]
+		{
+			FPF2EncounterCharacterStateIndex Index;
+
+			Index.SetCharacterStates(this->SpawnCharacter(), MakeStates(true, true));
+			Index.SetCharacterStates(this->SpawnCharacter(), MakeStates(false, false, true));
+
+			Index.Reset();
+
+			TestEqual("Num()", Index.Num(), 0);
+			TestEqual("GetNumAlive()", Index.GetNumAlive(), 0);
+			TestEqual("GetNumDying()", Index.GetNumDying(), 0);
+			TestEqual("GetNumPlayerControlled()", Index.GetNumPlayerControlled(), 0);
+		});
+	});
+}
+
+FPF2EncounterCharacterStates FPF2EncounterCharacterStateIndexSpec::MakeStates(const bool bIsAlive,
+                                                                            const bool bIsPlayerControlled,
+                                                                            const bool bIsDying)
+{
+	FPF2EncounterCharacterStates States;
+
+	States.bIsAlive            = bIsAlive;
+	States.bIsDying            = bIsDying;
+	States.bIsPlayerControlled = bIsPlayerControlled;
+
+	return States;
+}
@@ -0,0 +1,292 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
+#include "ModesOfPlay/Encounter/PF2EncounterModeOfPlayRuleSetBase.h"
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestEncounterModeOfPlayRuleSet.h"
+
+#include "Utilities/PF2InterfaceUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2EncounterModeOfPlayRuleSetBaseSpec,
+                     "OpenPF2.EncounterModeOfPlayRuleSetBase",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	APF2TestEncounterModeOfPlayRuleSet*      RuleSet;
+	TScriptInterface<IPF2CharacterInterface> OtherCharacter;
+END_DEFINE_PF_SPEC(FPF2EncounterModeOfPlayRuleSetBaseSpec)
+
+void FPF2EncounterModeOfPlayRuleSetBaseSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+		this->SetupTestCharacter();
+
+		this->OtherCharacter = PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+		this->RuleSet        = this->World->SpawnActor<APF2TestEncounterModeOfPlayRuleSet>();
+
+		this->BeginPlay();
+
+		// Suppress warnings about the lack of player controllers; the test characters are all NPCs.
+		this->AddExpectedError(
+			TEXT("does not have an OpenPF2-compatible player controller"),
+			EAutomationExpectedMessageFlags::Contains,
+			0
+		);
+
+		this->RuleSet->OnModeOfPlayStart(EPF2ModeOfPlayType::Encounter);
+		this->RuleSet->OnCharacterAddedToEncounter(this->TestCharacter);
+		this->RuleSet->OnCharacterAddedToEncounter(this->OtherCharacter);
+	});
+
+	AfterEach([=, this]
+	{
+		this->RuleSet        = nullptr;
+		this->OtherCharacter = nullptr;
+
+		this->DestroyTestCharacter();
+		this->DestroyWorld();
+	});
+
+	Describe(TEXT("tag callback table"), [=, this]
+	{
+		It(TEXT("gives the slot of a character that has left the encounter to the next character to join"), [=, this]
+		{
+			const int32                                    FreedSlot    =
+				this->RuleSet->GetTagCallbackSlot(this->TestCharacter);
+			const TScriptInterface<IPF2CharacterInterface> NewCharacter =
+				PF2InterfaceUtilities::ToScriptInterface(this->SpawnCharacter());
+
+			this->RuleSet->OnCharacterRemovedFromEncounter(this->TestCharacter);
+
+			TestFalse("IsTrackingCharacter(TestCharacter)", this->RuleSet->IsTrackingCharacter(this->TestCharacter));
+
+			this->RuleSet->OnCharacterAddedToEncounter(NewCharacter);
+
+			TestEqual("GetTagCallbackSlot(NewCharacter)", this->RuleSet->GetTagCallbackSlot(NewCharacter), FreedSlot);
+			TestEqual("GetNumTagCallbackSlots()", this->RuleSet->GetNumTagCallbackSlots(), 2);
+		});
+
+		It(TEXT("does not dispatch callbacks for a character after it has left the encounter"), [=, this]
+		{
+			this->RuleSet->OnCharacterRemovedFromEncounter(this->TestCharacter);
+
+			this->TestCharacterAsc->AddLooseGameplayTag(this->RuleSet->GetUnconsciousTag());
+
+			TestEqual("GetNumUnconsciousCallbacks()", this->RuleSet->GetNumUnconsciousCallbacks(), 0);
+
+			this->OtherCharacter->GetAbilitySystemComponent()->AddLooseGameplayTag(
+				this->RuleSet->GetUnconsciousTag()
+			);
+
+			TestEqual("GetNumUnconsciousCallbacks()", this->RuleSet->GetNumUnconsciousCallbacks(), 1);
+		});
+
+		It(TEXT("registers and unregisters a batch of characters together, reusing the freed slots"), [=, this]
+		{
+			const TArray<TScriptInterface<IPF2CharacterInterface>> Characters = {
+				this->TestCharacter,
+				this->OtherCharacter,
+			};
+
+			this->RuleSet->RemoveCharactersFromEncounter(Characters);
+
+			TestFalse("IsTrackingCharacter(TestCharacter)", this->RuleSet->IsTrackingCharacter(this->TestCharacter));
+			TestFalse("IsTrackingCharacter(OtherCharacter)", this->RuleSet->IsTrackingCharacter(this->OtherCharacter));
+			TestEqual("GetCharacterStateIndex().Num()", this->RuleSet->GetCharacterStateIndex().Num(), 0);
+
+			this->RuleSet->AddCharactersToEncounter(Characters);
+
+			TestTrue("IsTrackingCharacter(TestCharacter)", this->RuleSet->IsTrackingCharacter(this->TestCharacter));
+			TestTrue("IsTrackingCharacter(OtherCharacter)", this->RuleSet->IsTrackingCharacter(this->OtherCharacter));
+			TestEqual("GetCharacterStateIndex().Num()", this->RuleSet->GetCharacterStateIndex().Num(), 2);
+			TestEqual("GetNumTagCallbackSlots()", this->RuleSet->GetNumTagCallbackSlots(), 2);
+		});
+	});
+
+	Describe(TEXT("when the hit points of a character change"), [=, this]
+	{
+		It(TEXT("no longer counts the character as alive once its hit points drop to 0"), [=, this]
+		{
+			const IPF2CharacterInterface*       Character =
+				PF2InterfaceUtilities::FromScriptInterface(this->TestCharacter);
+			const FPF2EncounterCharacterStates* States;
+
+			this->TestCharacterAsc->SetNumericAttributeBase(UPF2CharacterAttributeSet::GetHitPointsAttribute(), 0.0f);
+
+			States = this->RuleSet->GetCharacterStateIndex().FindStates(Character);
+
+			if (TestNotNull("FindStates(TestCharacter)", States))
+			{
+				TestFalse("bIsAlive", States->bIsAlive);
+			}
+
+			TestEqual(
+				"GetCharacterStateIndex().GetNumAlive()",
+				this->RuleSet->GetCharacterStateIndex().GetNumAlive(),
+				1
+			);
+		});
+
+		It(TEXT("counts the character as alive again once it has been healed"), [=, this]
+		{
+			const IPF2CharacterInterface*       Character =
+				PF2InterfaceUtilities::FromScriptInterface(this->TestCharacter);
+			const FPF2EncounterCharacterStates* States;
+
+			this->TestCharacterAsc->SetNumericAttributeBase(UPF2CharacterAttributeSet::GetHitPointsAttribute(), 0.0f);
+			this->TestCharacterAsc->SetNumericAttributeBase(UPF2CharacterAttributeSet::GetHitPointsAttribute(), 5.0f);
+
+			States = this->RuleSet->GetCharacterStateIndex().FindStates(Character);
+
+			if (TestNotNull("FindStates(TestCharacter)", States))
+			{
+				TestTrue("bIsAlive", States->bIsAlive);
+			}
+
+			TestEqual(
+				"GetCharacterStateIndex().GetNumAlive()",
+				this->RuleSet->GetCharacterStateIndex().GetNumAlive(),
+				2
+			);
+		});
+
+		It(TEXT("stops tracking the hit points of a character once it leaves the encounter"), [=, this]
+		{
+			const FGameplayAttribute HitPointsAttribute = UPF2CharacterAttributeSet::GetHitPointsAttribute();
+
+			TestTrue(
+				"GetGameplayAttributeValueChangeDelegate(HitPoints).IsBoundToObject(RuleSet) (before removal)",
+				this->TestCharacterAsc->GetGameplayAttributeValueChangeDelegate(HitPointsAttribute).IsBoundToObject(
+					this->RuleSet
+				)
+			);
+
+			this->RuleSet->OnCharacterRemovedFromEncounter(this->TestCharacter);
+
+			TestFalse(
+				"GetGameplayAttributeValueChangeDelegate(HitPoints).IsBoundToObject(RuleSet) (after removal)",
+				this->TestCharacterAsc->GetGameplayAttributeValueChangeDelegate(HitPointsAttribute).IsBoundToObject(
+					this->RuleSet
+				)
+			);
+		});
+	});
+
+	Describe(TEXT("planned NPC turns"), [=, this]
+	{
+		BeforeEach([=, this]
+		{
+			this->RuleSet->SetCharacterInitiative(this->TestCharacter, 15);
+			this->RuleSet->SetCharacterInitiative(this->OtherCharacter, 20);
+
+			this->RuleSet->PlanTurns();
+		});
+
+		It(TEXT("are current right after they are planned"), [=, this]
+		{
+			TestTrue("HasCurrentPlannedTurns()", this->RuleSet->HasCurrentPlannedTurns());
+		});
+
+		It(TEXT("stay current when a character moves less than the movement tolerance"), [=, this]
+		{
+			AActor* CharacterActor = this->TestCharacter->ToActor();
+
+			CharacterActor->SetActorLocation(CharacterActor->GetActorLocation() + FVector(0.5f, 0.0f, 0.0f));
+
+			TestTrue("HasCurrentPlannedTurns()", this->RuleSet->HasCurrentPlannedTurns());
+		});
+
+		It(TEXT("become stale when a character moves"), [=, this]
+		{
+			AActor* CharacterActor = this->TestCharacter->ToActor();
+
+			CharacterActor->SetActorLocation(CharacterActor->GetActorLocation() + FVector(100.0f, 0.0f, 0.0f));
+
+			TestFalse("HasCurrentPlannedTurns()", this->RuleSet->HasCurrentPlannedTurns());
+		});
+
+		It(TEXT("become stale when the hit points of a character change"), [=, this]
+		{
+			this->TestCharacterAsc->SetNumericAttributeBase(UPF2CharacterAttributeSet::GetHitPointsAttribute(), 0.0f);
+
+			TestFalse("HasCurrentPlannedTurns()", this->RuleSet->HasCurrentPlannedTurns());
+		});
+	});
+
+	Describe(TEXT("when rule sets persist across changes in mode of play"), [=, this]
+	{
+		It(TEXT("removes every character from the encounter when suspended"), [=, this]
+		{
+			this->RuleSet->SetCharacterInitiative(this->TestCharacter, 15);
+			this->RuleSet->SetCharacterInitiative(this->OtherCharacter, 20);
+			this->RuleSet->MakeActiveCharacter(this->TestCharacter);
+
+			// This is the call that the game mode makes when switching away from the encounter.
+			this->RuleSet->OnModeSuspended(EPF2ModeOfPlayType::Encounter);
+
+			TestTrue("IsSuspended()", this->RuleSet->IsSuspended());
+			TestNull("GetActiveCharacter()", this->RuleSet->GetActiveCharacter().GetObject());
+			TestFalse("HavePlayableCharacters()", this->RuleSet->HavePlayableCharacters());
+			TestEqual("GetCharacterStateIndex().Num()", this->RuleSet->GetCharacterStateIndex().Num(), 0);
+
+			TestFalse(
+				"IsInitiativeSetForCharacter(TestCharacter)",
+				this->RuleSet->IsInitiativeSetForCharacter(this->TestCharacter)
+			);
+
+			TestFalse("IsTrackingCharacter(TestCharacter)", this->RuleSet->IsTrackingCharacter(this->TestCharacter));
+			TestFalse("IsTrackingCharacter(OtherCharacter)", this->RuleSet->IsTrackingCharacter(this->OtherCharacter));
+
+			TestFalse(
+				"GetGameplayAttributeValueChangeDelegate(HitPoints).IsBoundToObject(RuleSet)",
+				this->TestCharacterAsc->GetGameplayAttributeValueChangeDelegate(
+					UPF2CharacterAttributeSet::GetHitPointsAttribute()
+				).IsBoundToObject(this->RuleSet)
+			);
+		});
+
+		It(TEXT("does not dispatch condition callbacks while suspended"), [=, this]
+		{
+			this->RuleSet->OnModeSuspended(EPF2ModeOfPlayType::Encounter);
+
+			this->TestCharacterAsc->AddLooseGameplayTag(this->RuleSet->GetUnconsciousTag());
+
+			TestEqual("GetNumUnconsciousCallbacks()", this->RuleSet->GetNumUnconsciousCallbacks(), 0);
+		});
+
+		It(TEXT("starts the mode of play again when resumed"), [=, this]
+		{
+			this->RuleSet->OnModeSuspended(EPF2ModeOfPlayType::Encounter);
+			this->RuleSet->OnModeResumed(EPF2ModeOfPlayType::Encounter);
+
+			TestFalse("IsSuspended()", this->RuleSet->IsSuspended());
+
+			// The first start happened when the rule set was created.
+			TestEqual("GetNumModeOfPlayStarts()", this->RuleSet->GetNumModeOfPlayStarts(), 2);
+		});
+
+		It(TEXT("reuses the tag callback table for the characters of each new encounter"), [=, this]
+		{
+			for (int32 SwitchIndex = 0; SwitchIndex < 2; ++SwitchIndex)
+			{
+				// This is the sequence of calls that the game mode makes when switching to exploration and back.
+				this->RuleSet->OnModeSuspended(EPF2ModeOfPlayType::Encounter);
+				this->RuleSet->OnModeResumed(EPF2ModeOfPlayType::Encounter);
+
+				this->RuleSet->AddCharactersToEncounter({this->TestCharacter, this->OtherCharacter});
+
+				TestEqual("GetNumTagCallbackSlots()", this->RuleSet->GetNumTagCallbackSlots(), 2);
+				TestEqual("GetCharacterStateIndex().Num()", this->RuleSet->GetCharacterStateIndex().Num(), 2);
+			}
+
+			this->TestCharacterAsc->AddLooseGameplayTag(this->RuleSet->GetUnconsciousTag());
+
+			TestEqual("GetNumUnconsciousCallbacks()", this->RuleSet->GetNumUnconsciousCallbacks(), 1);
+		});
+	});
+}
@@ -0,0 +1,112 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "PF2AIControllerBase.h"
+#include "PF2CharacterInterface.h"
+
+#include "Tests/PF2SpecBase.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2AIControllerBaseSpec,
+                     "OpenPF2.AIControllerBase",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	/**
+	 * Adds the state of a new character to an encounter snapshot.
+	 *
+	 * @param Snapshot
+	 *	The snapshot to which the character will be added.
+	 * @param Location
+	 *	The location of the character.
+	 * @param HitPoints
+	 *	The current hit points of the character. The character is considered alive if this is greater than 0.
+	 * @param bIsPlayerControlled
+	 *	Whether the character is controlled by a player.
+	 *
+	 * @return
+	 *	The character that was added.
+	 */
+	IPF2CharacterInterface* AddCharacterToSnapshot(FPF2EncounterSnapshot& Snapshot,
+	                                               const FVector&         Location,
+	                                               const float            HitPoints,
+	                                               const bool             bIsPlayerControlled) const;
+END_DEFINE_PF_SPEC(FPF2AIControllerBaseSpec)
+
+void FPF2AIControllerBaseSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+	});
+
+	AfterEach([=, this]
+	{
+		this->DestroyWorld();
+	});
+
+	Describe(TEXT("PlanEncounterTurn"), [=, this]
+	{
+		It(TEXT("targets the closest living character on the opposing side"), [=, this]
+		{
+			const APF2AIControllerBase* Controller = GetDefault<APF2AIControllerBase>();
+			FPF2EncounterSnapshot       Snapshot;
+			FPF2AITurnPlan              Plan;
+			IPF2CharacterInterface*     ClosestOpponent;
+
+			this->AddCharacterToSnapshot(Snapshot, FVector(0.0f, 0.0f, 0.0f), 10.0f, false);
+			this->AddCharacterToSnapshot(Snapshot, FVector(100.0f, 0.0f, 0.0f), 10.0f, false);
+			this->AddCharacterToSnapshot(Snapshot, FVector(200.0f, 0.0f, 0.0f), 0.0f, true);
+			ClosestOpponent = this->AddCharacterToSnapshot(Snapshot, FVector(300.0f, 0.0f, 0.0f), 10.0f, true);
+			this->AddCharacterToSnapshot(Snapshot, FVector(400.0f, 0.0f, 0.0f), 10.0f, true);
+
+			TestTrue("PlanEncounterTurn()", Controller->PlanEncounterTurn(Snapshot, 0, Plan));
+			TestEqual("Plan.TargetCharacter", Plan.TargetCharacter.Get(), ClosestOpponent);
+		});
+
+		It(TEXT("prefers the opponent with fewer hit points when opponents are equally close"), [=, this]
+		{
+			const APF2AIControllerBase* Controller = GetDefault<APF2AIControllerBase>();
+			FPF2EncounterSnapshot       Snapshot;
+			FPF2AITurnPlan              Plan;
+			IPF2CharacterInterface*     WeakestOpponent;
+
+			this->AddCharacterToSnapshot(Snapshot, FVector(0.0f, 0.0f, 0.0f), 10.0f, false);
+			this->AddCharacterToSnapshot(Snapshot, FVector(100.0f, 0.0f, 0.0f), 8.0f, true);
+			WeakestOpponent = this->AddCharacterToSnapshot(Snapshot, FVector(-100.0f, 0.0f, 0.0f), 3.0f, true);
+
+			TestTrue("PlanEncounterTurn()", Controller->PlanEncounterTurn(Snapshot, 0, Plan));
+			TestEqual("Plan.TargetCharacter", Plan.TargetCharacter.Get(), WeakestOpponent);
+		});
+
+		It(TEXT("does not make a plan when there are no living opponents"), [=, this]
+		{
+			const APF2AIControllerBase* Controller = GetDefault<APF2AIControllerBase>();
+			FPF2EncounterSnapshot       Snapshot;
+			FPF2AITurnPlan              Plan;
+
+			this->AddCharacterToSnapshot(Snapshot, FVector(0.0f, 0.0f, 0.0f), 10.0f, false);
+			this->AddCharacterToSnapshot(Snapshot, FVector(100.0f, 0.0f, 0.0f), 10.0f, false);
+			this->AddCharacterToSnapshot(Snapshot, FVector(200.0f, 0.0f, 0.0f), 0.0f, true);
+
+			TestFalse("PlanEncounterTurn()", Controller->PlanEncounterTurn(Snapshot, 0, Plan));
+		});
+	});
+}
+
+IPF2CharacterInterface* FPF2AIControllerBaseSpec::AddCharacterToSnapshot(
+	FPF2EncounterSnapshot& Snapshot,
+	const FVector&         Location,
+	const float            HitPoints,
+	const bool             bIsPlayerControlled) const
+{
+	FPF2EncounterCharacterSnapshot& CharacterSnapshot = Snapshot.Characters.AddDefaulted_GetRef();
+	IPF2CharacterInterface*         Character         = this->SpawnCharacter();
+
+	CharacterSnapshot.Character           = *Character;
+	CharacterSnapshot.Location            = Location;
+	CharacterSnapshot.HitPoints           = HitPoints;
+	CharacterSnapshot.bIsAlive            = (HitPoints > 0.0f);
+	CharacterSnapshot.bIsPlayerControlled = bIsPlayerControlled;
+
+	return Character;
+}
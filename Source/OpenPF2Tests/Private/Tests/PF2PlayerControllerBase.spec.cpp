@@ -0,0 +1,121 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "PF2PlayerControllerBase.h"
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestPlayerController.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2PlayerControllerBaseSpec,
+                     "OpenPF2.PlayerControllerBase",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	APF2TestPlayerController* TestController;
+
+	/**
+	 * Builds a batch of commands that each target the test pawn with a distinct ability spec handle.
+	 *
+	 * @param NumCommands
+	 *	The number of commands to include in the batch.
+	 *
+	 * @return
+	 *	The batch of commands.
+	 */
+	TArray<FPF2CharacterCommandDescriptor> BuildCommandBatch(const int32 NumCommands) const;
+END_DEFINE_PF_SPEC(FPF2PlayerControllerBaseSpec)
+
+void FPF2PlayerControllerBaseSpec::Define()
+{
+	BeforeEach([=, this]
+	{
+		this->SetupWorld();
+		this->SetupTestPawn();
+
+		this->TestController = this->World->SpawnActor<APF2TestPlayerController>();
+
+		this->BeginPlay();
+	});
+
+	AfterEach([=, this]
+	{
+		this->TestController = nullptr;
+
+		this->DestroyTestPawn();
+		this->DestroyWorld();
+	});
+
+	Describe(TEXT("Server_ExecuteCharacterCommands"), [=, this]
+	{
+		It(TEXT("executes the commands in a batch in the order they were submitted"), [=, this]
+		{
+			const TArray<FPF2CharacterCommandDescriptor> Commands = this->BuildCommandBatch(3);
+
+			this->TestController->ExecuteCharacterCommands(Commands);
+
+			const TArray<FPF2CharacterCommandDescriptor>& ExecutedCommands =
+				this->TestController->GetExecutedCommands();
+
+			if (TestEqual("ExecutedCommands.Num()", ExecutedCommands.Num(), Commands.Num()))
+			{
+				for (int32 CommandIndex = 0; CommandIndex < Commands.Num(); ++CommandIndex)
+				{
+					TestTrue(
+						FString::Format(
+							TEXT("ExecutedCommands[{0}].AbilitySpecHandle == Commands[{0}].AbilitySpecHandle"),
+							{CommandIndex}
+						),
+						ExecutedCommands[CommandIndex].AbilitySpecHandle == Commands[CommandIndex].AbilitySpecHandle
+					);
+
+					TestEqual(
+						FString::Format(TEXT("ExecutedCommands[{0}].CharacterActor"), {CommandIndex}),
+						ExecutedCommands[CommandIndex].CharacterActor,
+						Commands[CommandIndex].CharacterActor
+					);
+				}
+			}
+		});
+
+		It(TEXT("executes every command in a batch that is exactly at the limit"), [=, this]
+		{
+			const int32 MaxCommands = APF2PlayerControllerBase::MaxCommandsPerBatch;
+
+			this->TestController->ExecuteCharacterCommands(this->BuildCommandBatch(MaxCommands));
+
+			TestEqual("GetExecutedCommands().Num()", this->TestController->GetExecutedCommands().Num(), MaxCommands);
+		});
+
+		It(TEXT("rejects the entire batch and logs an error when the batch exceeds the limit"), [=, this]
+		{
+			const int32 MaxCommands = APF2PlayerControllerBase::MaxCommandsPerBatch;
+
+			AddExpectedError(
+				TEXT("Batch from player controller \\('.*'\\) contains too many commands"),
+				EAutomationExpectedMessageFlags::Contains
+			);
+
+			this->TestController->ExecuteCharacterCommands(this->BuildCommandBatch(MaxCommands + 1));
+
+			TestEqual("GetExecutedCommands().Num()", this->TestController->GetExecutedCommands().Num(), 0);
+		});
+	});
+}
+
+TArray<FPF2CharacterCommandDescriptor> FPF2PlayerControllerBaseSpec::BuildCommandBatch(const int32 NumCommands) const
+{
+	TArray<FPF2CharacterCommandDescriptor> Commands;
+
+	Commands.Reserve(NumCommands);
+
+	for (int32 CommandIndex = 0; CommandIndex < NumCommands; ++CommandIndex)
+	{
+		FGameplayAbilitySpecHandle AbilitySpecHandle;
+
+		AbilitySpecHandle.GenerateNewHandle();
+
+		Commands.Emplace(this->TestPawn, AbilitySpecHandle);
+	}
+
+	return Commands;
+}
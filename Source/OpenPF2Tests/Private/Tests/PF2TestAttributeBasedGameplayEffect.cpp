@@ -0,0 +1,35 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2TestAttributeBasedGameplayEffect.h"
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
+#include "Utilities/PF2GameplayAbilityUtilities.h"
+
+const FName UPF2TestAttributeBasedGameplayEffect::SourceFilterTagName = FName(TEXT("DamageType.Energy.Fire"));
+const FName UPF2TestAttributeBasedGameplayEffect::TargetFilterTagName = FName(TEXT("Armor.Equipped.Heavy"));
+
+UPF2TestAttributeBasedGameplayEffect::UPF2TestAttributeBasedGameplayEffect()
+{
+	FAttributeBasedFloat  Magnitude;
+	FGameplayModifierInfo Modifier;
+
+	this->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+	Magnitude.BackingAttribute =
+		PF2GameplayAbilityUtilities::BuildSourceCaptureFor(UPF2CharacterAttributeSet::GetAbBoostCountAttribute());
+
+	Magnitude.AttributeCalculationType = EAttributeBasedFloatCalculationType::AttributeMagnitude;
+
+	Magnitude.SourceTagFilter.AddTag(FGameplayTag::RequestGameplayTag(SourceFilterTagName));
+	Magnitude.TargetTagFilter.AddTag(FGameplayTag::RequestGameplayTag(TargetFilterTagName));
+
+	Modifier.Attribute         = UPF2CharacterAttributeSet::GetAbBoostCountAttribute();
+	Modifier.ModifierOp        = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Magnitude);
+
+	this->Modifiers.Add(Modifier);
+}
@@ -0,0 +1,70 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2TestEncounterModeOfPlayRuleSet.h"
+
+#include "PF2CharacterInterface.h"
+
+APF2TestEncounterModeOfPlayRuleSet::APF2TestEncounterModeOfPlayRuleSet() :
+	NumUnconsciousCallbacks(0),
+	NumModeOfPlayStarts(0)
+{
+}
+
+bool APF2TestEncounterModeOfPlayRuleSet::IsTrackingCharacter(
+	const TScriptInterface<IPF2CharacterInterface>& Character) const
+{
+	return this->HasTagCallbacksForCharacter(Character->ToActor());
+}
+
+int32 APF2TestEncounterModeOfPlayRuleSet::GetTagCallbackSlot(
+	const TScriptInterface<IPF2CharacterInterface>& Character) const
+{
+	const int32* CharacterIndex = this->TagCallbackCharacterIndicesByActor.Find(Character->ToActor());
+
+	return (CharacterIndex == nullptr) ? INDEX_NONE : *CharacterIndex;
+}
+
+void APF2TestEncounterModeOfPlayRuleSet::AddCharactersToEncounter(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
+{
+	this->OnCharactersAddedToEncounter(Characters);
+}
+
+void APF2TestEncounterModeOfPlayRuleSet::RemoveCharactersFromEncounter(
+	const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters)
+{
+	this->OnCharactersRemovedFromEncounter(Characters);
+}
+
+void APF2TestEncounterModeOfPlayRuleSet::MakeActiveCharacter(const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	this->SetActiveCharacter(Character);
+}
+
+void APF2TestEncounterModeOfPlayRuleSet::PlanTurns()
+{
+	this->PlanNonPlayerTurns();
+}
+
+bool APF2TestEncounterModeOfPlayRuleSet::HasCurrentPlannedTurns() const
+{
+	return this->ArePlannedTurnsCurrent();
+}
+
+void APF2TestEncounterModeOfPlayRuleSet::OnModeOfPlayStart(const EPF2ModeOfPlayType ModeOfPlay)
+{
+	++this->NumModeOfPlayStarts;
+
+	Super::OnModeOfPlayStart(ModeOfPlay);
+}
+
+void APF2TestEncounterModeOfPlayRuleSet::Native_OnCharacterUnconscious(
+	const TScriptInterface<IPF2CharacterInterface>& Character)
+{
+	++this->NumUnconsciousCallbacks;
+
+	Super::Native_OnCharacterUnconscious(Character);
+}
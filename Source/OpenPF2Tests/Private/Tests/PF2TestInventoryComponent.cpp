@@ -0,0 +1,108 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2TestInventoryComponent.h"
+
+#include "Tests/PF2TestItem.h"
+
+#include "Utilities/PF2InterfaceUtilities.h"
+
+void UPF2TestInventoryComponent::StartRecordingEvents()
+{
+	UPF2InventoryInterfaceEvents* EventsObject = this->GetEvents();
+
+	EventsObject->OnInventoryChanged.AddDynamic(this, &UPF2TestInventoryComponent::RecordInventoryChanged);
+	EventsObject->OnItemAddedToInventory.AddDynamic(this, &UPF2TestInventoryComponent::RecordItemAdded);
+	EventsObject->OnItemRemovedFromInventory.AddDynamic(this, &UPF2TestInventoryComponent::RecordItemRemoved);
+}
+
+void UPF2TestInventoryComponent::AddLoadableItem(const FPrimaryAssetId& ItemId)
+{
+	UPF2TestItem* Item = NewObject<UPF2TestItem>(this);
+
+	Item->SetItemId(ItemId);
+
+	this->LoadableItems.Add(Item);
+}
+
+int32 UPF2TestInventoryComponent::AddReplicatedEntry(const FPrimaryAssetId& ItemId)
+{
+	this->InventoryItems.Add(ItemId, nullptr);
+
+	// Adding an entry marks it dirty, which assigns it the next replication ID.
+	return this->InventoryItems.IDCounter;
+}
+
+void UPF2TestInventoryComponent::RemoveReplicatedEntry(const FPrimaryAssetId& ItemId)
+{
+	this->InventoryItems.Remove(ItemId);
+}
+
+FPF2InventoryItemEntry* UPF2TestInventoryComponent::FindReplicatedEntry(const int32 ReplicationId)
+{
+	const TArray<FPF2InventoryItemEntry*> Entries = this->InventoryItems.FindItemsByReplicationId({ ReplicationId });
+	FPF2InventoryItemEntry*               Result  = nullptr;
+
+	if (Entries.Num() != 0)
+	{
+		Result = Entries[0];
+	}
+
+	return Result;
+}
+
+void UPF2TestInventoryComponent::CompletePendingLoads()
+{
+	// Completions are moved out first in case a completion requests another load.
+	const TArray<FStreamableDelegate> Completions = MoveTemp(this->PendingLoadCompletions);
+
+	for (const FStreamableDelegate& Completion : Completions)
+	{
+		Completion.ExecuteIfBound();
+	}
+}
+
+void UPF2TestInventoryComponent::LoadItemsById(const TArray<FPrimaryAssetId>& ItemAssetIds,
+                                               const FStreamableDelegate&     CompletionDelegate,
+                                               const TArray<FName>&           BundlesToLoad)
+{
+	this->LoadRequests.Add(ItemAssetIds);
+	this->PendingLoadCompletions.Add(CompletionDelegate);
+}
+
+TScriptInterface<IPF2ItemInterface> UPF2TestInventoryComponent::GetLoadedItemById(
+	const FPrimaryAssetId& ItemAssetId) const
+{
+	TScriptInterface<IPF2ItemInterface> Result;
+
+	for (UPF2TestItem* Item : this->LoadableItems)
+	{
+		if (Item->GetPrimaryAssetId() == ItemAssetId)
+		{
+			Result = PF2InterfaceUtilities::ToScriptInterface<IPF2ItemInterface>(Item);
+			break;
+		}
+	}
+
+	return Result;
+}
+
+void UPF2TestInventoryComponent::RecordInventoryChanged(
+	const TScriptInterface<IPF2InventoryInterface>& InventoryComponent)
+{
+	this->RecordedEvents.Add(TEXT("Changed"));
+}
+
+void UPF2TestInventoryComponent::RecordItemAdded(const TScriptInterface<IPF2InventoryInterface>& InventoryComponent,
+                                                 const TScriptInterface<IPF2ItemInterface>&      InventoryItem)
+{
+	this->RecordedEvents.Add(TEXT("Added:") + InventoryItem->GetPrimaryAssetId().PrimaryAssetName.ToString());
+}
+
+void UPF2TestInventoryComponent::RecordItemRemoved(const TScriptInterface<IPF2InventoryInterface>& InventoryComponent,
+                                                   const TScriptInterface<IPF2ItemInterface>&      InventoryItem)
+{
+	this->RecordedEvents.Add(TEXT("Removed:") + InventoryItem->GetPrimaryAssetId().PrimaryAssetName.ToString());
+}
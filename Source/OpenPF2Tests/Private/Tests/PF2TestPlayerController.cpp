@@ -0,0 +1,19 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2TestPlayerController.h"
+
+void APF2TestPlayerController::ExecuteCharacterCommands(const TArray<FPF2CharacterCommandDescriptor>& Commands)
+{
+	this->Server_ExecuteCharacterCommands_Implementation(Commands);
+}
+
+void APF2TestPlayerController::ExecuteAbilitySpecAsCharacterCommand(
+	AActor*                          CharacterActor,
+	const FGameplayAbilitySpecHandle AbilitySpecHandle,
+	const FGameplayEventData&        AbilityPayload)
+{
+	this->ExecutedCommands.Emplace(CharacterActor, AbilitySpecHandle, AbilityPayload);
+}
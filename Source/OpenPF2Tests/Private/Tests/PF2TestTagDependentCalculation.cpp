@@ -0,0 +1,26 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2TestTagDependentCalculation.h"
+
+const FName UPF2TestTagDependentCalculation::QueriedTagName = FName(TEXT("Armor.Equipped.Heavy"));
+
+float UPF2TestTagDependentCalculation::CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const
+{
+	const FGameplayTagContainer* TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+	float                        Result     = 0.0f;
+
+	if ((TargetTags != nullptr) && TargetTags->HasTag(FGameplayTag::RequestGameplayTag(QueriedTagName)))
+	{
+		Result = 1.0f;
+	}
+
+	return Result;
+}
+
+FGameplayTagContainer UPF2TestTagDependentCalculation::GetQueriedTags() const
+{
+	return FGameplayTagContainer(FGameplayTag::RequestGameplayTag(QueriedTagName));
+}
@@ -0,0 +1,26 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2TestTagDependentGameplayEffect.h"
+
+#include "CharacterStats/PF2CharacterAttributeSet.h"
+
+#include "Tests/PF2TestTagDependentCalculation.h"
+
+UPF2TestTagDependentGameplayEffect::UPF2TestTagDependentGameplayEffect()
+{
+	FCustomCalculationBasedFloat Magnitude;
+	FGameplayModifierInfo        Modifier;
+
+	this->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+	Magnitude.CalculationClassMagnitude = UPF2TestTagDependentCalculation::StaticClass();
+
+	Modifier.Attribute         = UPF2CharacterAttributeSet::GetAbBoostCountAttribute();
+	Modifier.ModifierOp        = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Magnitude);
+
+	this->Modifiers.Add(Modifier);
+}
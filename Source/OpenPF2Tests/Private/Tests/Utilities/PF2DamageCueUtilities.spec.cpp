@@ -0,0 +1,135 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2SpecBase.h"
+
+#include "Utilities/PF2DamageCueUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2DamageCueUtilitiesSpec,
+                     "OpenPF2.Utilities.DamageCueUtilities",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2DamageCueUtilitiesSpec)
+
+void FPF2DamageCueUtilitiesSpec::Define()
+{
+	static const FName FireDamageName        = "DamageType.Energy.Fire";
+	static const FName ColdDamageName        = "DamageType.Energy.Cold";
+	static const FName PiercingDamageName    = "DamageType.Physical.Piercing";
+	static const FName PrecisionDamageName   = "DamageType.Precision";
+	static const FName BludgeoningDamageName = "DamageType.Physical.Bludgeoning";
+
+	Describe(TEXT("when packing damage of a single type"), [=, this]
+	{
+		It(TEXT("carries the damage in the raw magnitude without disturbing the levels of the cue"), [=, this]
+		{
+			const FGameplayTag     FireDamage = FGameplayTag::RequestGameplayTag(FireDamageName);
+			FGameplayCueParameters CueParams;
+
+			CueParams.GameplayEffectLevel = 3;
+			CueParams.AbilityLevel        = 5;
+
+			PF2DamageCueUtilities::PackDamageByType({ MakeTuple(FireDamage, 7.5f) }, CueParams);
+
+			TestEqual("RawMagnitude", CueParams.RawMagnitude, 7.5f);
+			TestEqual("GameplayEffectLevel", CueParams.GameplayEffectLevel, 3);
+			TestEqual("AbilityLevel", CueParams.AbilityLevel, 5);
+			TestTrue(
+				"AggregatedSourceTags.HasTagExact(FireDamage)",
+				CueParams.AggregatedSourceTags.HasTagExact(FireDamage)
+			);
+		});
+
+		It(TEXT("unpacks to the same damage"), [=, this]
+		{
+			const FGameplayTag     FireDamage = FGameplayTag::RequestGameplayTag(FireDamageName);
+			FGameplayCueParameters CueParams;
+
+			PF2DamageCueUtilities::PackDamageByType({ MakeTuple(FireDamage, 7.5f) }, CueParams);
+
+			const TMap<FGameplayTag, float> DamageByType = PF2DamageCueUtilities::UnpackDamageByType(CueParams);
+
+			TestEqual("DamageByType.Num()", DamageByType.Num(), 1);
+			TestEqual("DamageByType[FireDamage]", DamageByType.FindRef(FireDamage), 7.5f);
+		});
+	});
+
+	Describe(TEXT("when packing damage of several types"), [=, this]
+	{
+		It(TEXT("carries the total damage in the raw magnitude"), [=, this]
+		{
+			FGameplayCueParameters CueParams;
+
+			PF2DamageCueUtilities::PackDamageByType(
+				{
+					MakeTuple(FGameplayTag::RequestGameplayTag(FireDamageName), 4.0f),
+					MakeTuple(FGameplayTag::RequestGameplayTag(PiercingDamageName), 9.0f),
+				},
+				CueParams
+			);
+
+			TestEqual("RawMagnitude", CueParams.RawMagnitude, 13.0f);
+		});
+
+		It(TEXT("unpacks to the same damage regardless of the order in which types were packed"), [=, this]
+		{
+			const FGameplayTag     FireDamage        = FGameplayTag::RequestGameplayTag(FireDamageName);
+			const FGameplayTag     ColdDamage        = FGameplayTag::RequestGameplayTag(ColdDamageName);
+			const FGameplayTag     PiercingDamage    = FGameplayTag::RequestGameplayTag(PiercingDamageName);
+			const FGameplayTag     PrecisionDamage   = FGameplayTag::RequestGameplayTag(PrecisionDamageName);
+			FGameplayCueParameters CueParams;
+
+			PF2DamageCueUtilities::PackDamageByType(
+				{
+					MakeTuple(PrecisionDamage, 2.0f),
+					MakeTuple(FireDamage, 4.0f),
+					MakeTuple(PiercingDamage, 65535.0f),
+					MakeTuple(ColdDamage, 1.0f),
+				},
+				CueParams
+			);
+
+			const TMap<FGameplayTag, float> DamageByType = PF2DamageCueUtilities::UnpackDamageByType(CueParams);
+
+			TestEqual("DamageByType.Num()", DamageByType.Num(), 4);
+			TestEqual("DamageByType[FireDamage]", DamageByType.FindRef(FireDamage), 4.0f);
+			TestEqual("DamageByType[ColdDamage]", DamageByType.FindRef(ColdDamage), 1.0f);
+			TestEqual("DamageByType[PiercingDamage]", DamageByType.FindRef(PiercingDamage), 65535.0f);
+			TestEqual("DamageByType[PrecisionDamage]", DamageByType.FindRef(PrecisionDamage), 2.0f);
+		});
+
+		It(TEXT("rounds each type of damage to the nearest whole number"), [=, this]
+		{
+			const FGameplayTag     FireDamage        = FGameplayTag::RequestGameplayTag(FireDamageName);
+			const FGameplayTag     BludgeoningDamage = FGameplayTag::RequestGameplayTag(BludgeoningDamageName);
+			FGameplayCueParameters CueParams;
+
+			PF2DamageCueUtilities::PackDamageByType(
+				{
+					MakeTuple(FireDamage, 2.4f),
+					MakeTuple(BludgeoningDamage, 5.6f),
+				},
+				CueParams
+			);
+
+			const TMap<FGameplayTag, float> DamageByType = PF2DamageCueUtilities::UnpackDamageByType(CueParams);
+
+			TestEqual("RawMagnitude", CueParams.RawMagnitude, 8.0f);
+			TestEqual("DamageByType[FireDamage]", DamageByType.FindRef(FireDamage), 2.0f);
+			TestEqual("DamageByType[BludgeoningDamage]", DamageByType.FindRef(BludgeoningDamage), 6.0f);
+		});
+	});
+
+	Describe(TEXT("when unpacking a cue for a miss"), [=, this]
+	{
+		It(TEXT("returns no damage"), [=, this]
+		{
+			FGameplayCueParameters CueParams;
+
+			CueParams.RawMagnitude = 0.0f;
+
+			TestTrue("UnpackDamageByType().IsEmpty()", PF2DamageCueUtilities::UnpackDamageByType(CueParams).IsEmpty());
+		});
+	});
+}
@@ -0,0 +1,79 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Tests/PF2SpecBase.h"
+#include "Tests/PF2TestAttributeBasedGameplayEffect.h"
+#include "Tests/PF2TestGameplayEffect.h"
+#include "Tests/PF2TestTagDependentCalculation.h"
+#include "Tests/PF2TestTagDependentGameplayEffect.h"
+
+#include "Utilities/PF2GameplayAbilityUtilities.h"
+
+BEGIN_DEFINE_PF_SPEC(FPF2GameplayAbilityUtilitiesSpec,
+                     "OpenPF2.Utilities.GameplayAbilityUtilities",
+                     EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_PF_SPEC(FPF2GameplayAbilityUtilitiesSpec)
+
+void FPF2GameplayAbilityUtilitiesSpec::Define()
+{
+	Describe(TEXT("GetTagsQueriedByGameplayEffect"), [=, this]
+	{
+		It(TEXT("returns no tags for a GE that does not check any tags"), [=, this]
+		{
+			FGameplayTagContainer QueriedTags;
+
+			const bool bAllTagsKnown = PF2GameplayAbilityUtilities::GetTagsQueriedByGameplayEffect(
+				UPF2TestGameplayEffect::StaticClass(),
+				QueriedTags
+			);
+
+			TestTrue("bAllTagsKnown", bAllTagsKnown);
+			TestEqual("QueriedTags.Num()", QueriedTags.Num(), 0);
+		});
+
+		It(TEXT("returns the tags declared by the MMCs of a GE"), [=, this]
+		{
+			FGameplayTagContainer QueriedTags;
+
+			const bool bAllTagsKnown = PF2GameplayAbilityUtilities::GetTagsQueriedByGameplayEffect(
+				UPF2TestTagDependentGameplayEffect::StaticClass(),
+				QueriedTags
+			);
+
+			TestTrue("bAllTagsKnown", bAllTagsKnown);
+			TestTrue(
+				"QueriedTags.HasTagExact(QueriedTagName)",
+				QueriedTags.HasTagExact(
+					FGameplayTag::RequestGameplayTag(UPF2TestTagDependentCalculation::QueriedTagName)
+				)
+			);
+		});
+
+		It(TEXT("returns the source and target tag filters of attribute-based magnitudes"), [=, this]
+		{
+			FGameplayTagContainer QueriedTags;
+
+			const bool bAllTagsKnown = PF2GameplayAbilityUtilities::GetTagsQueriedByGameplayEffect(
+				UPF2TestAttributeBasedGameplayEffect::StaticClass(),
+				QueriedTags
+			);
+
+			TestTrue("bAllTagsKnown", bAllTagsKnown);
+			TestEqual("QueriedTags.Num()", QueriedTags.Num(), 2);
+			TestTrue(
+				"QueriedTags.HasTagExact(SourceFilterTagName)",
+				QueriedTags.HasTagExact(
+					FGameplayTag::RequestGameplayTag(UPF2TestAttributeBasedGameplayEffect::SourceFilterTagName)
+				)
+			);
+			TestTrue(
+				"QueriedTags.HasTagExact(TargetFilterTagName)",
+				QueriedTags.HasTagExact(
+					FGameplayTag::RequestGameplayTag(UPF2TestAttributeBasedGameplayEffect::TargetFilterTagName)
+				)
+			);
+		});
+	});
+}
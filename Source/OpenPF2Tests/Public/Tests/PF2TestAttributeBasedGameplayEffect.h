@@ -0,0 +1,44 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayEffect.h>
+
+#include "PF2TestAttributeBasedGameplayEffect.generated.h"
+
+/**
+ * A fake, infinite-duration Gameplay Effect whose only modifier has an attribute-based magnitude with tag filters.
+ *
+ * The magnitude only counts modifiers of the backing attribute when the source has SourceFilterTagName and the target
+ * has TargetFilterTagName. This is used to test logic that determines which tags a GE depends on.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestAttributeBasedGameplayEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Constants
+	// =================================================================================================================
+	/**
+	 * The name of the tag that the attribute-based magnitude of this GE requires on the source.
+	 */
+	static const FName SourceFilterTagName;
+
+	/**
+	 * The name of the tag that the attribute-based magnitude of this GE requires on the target.
+	 */
+	static const FName TargetFilterTagName;
+
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for UPF2TestAttributeBasedGameplayEffect.
+	 */
+	explicit UPF2TestAttributeBasedGameplayEffect();
+};
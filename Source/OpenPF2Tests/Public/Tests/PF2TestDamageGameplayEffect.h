@@ -0,0 +1,31 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayEffect.h>
+
+#include "PF2TestDamageGameplayEffect.generated.h"
+
+/**
+ * A fake, instant Gameplay Effect that inflicts the damage accumulated on the source onto the target.
+ *
+ * The GE has no modifiers; its only execution is UPF2ApplyDamageFromSourceExecution, so that the execution can be
+ * tested without relying on any content from Blueprints.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestDamageGameplayEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for UPF2TestDamageGameplayEffect.
+	 */
+	explicit UPF2TestDamageGameplayEffect();
+};
@@ -0,0 +1,172 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ModesOfPlay/Encounter/PF2EncounterModeOfPlayRuleSetBase.h"
+
+#include "PF2TestEncounterModeOfPlayRuleSet.generated.h"
+
+/**
+ * A concrete encounter rule set that exposes its internal state and counts condition callbacks, for testing.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API APF2TestEncounterModeOfPlayRuleSet : public APF2EncounterModeOfPlayRuleSetBase
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The number of times that Native_OnCharacterUnconscious() has been invoked.
+	 */
+	int32 NumUnconsciousCallbacks;
+
+	/**
+	 * The number of times that OnModeOfPlayStart() has been invoked.
+	 */
+	int32 NumModeOfPlayStarts;
+
+public:
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for APF2TestEncounterModeOfPlayRuleSet.
+	 */
+	explicit APF2TestEncounterModeOfPlayRuleSet();
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the number of times that this rule set has been notified that a character became unconscious.
+	 *
+	 * @return
+	 *	The number of unconscious callbacks that have been dispatched.
+	 */
+	FORCEINLINE int32 GetNumUnconsciousCallbacks() const
+	{
+		return this->NumUnconsciousCallbacks;
+	}
+
+	/**
+	 * Gets the number of times that this rule set has been started, whether newly or upon being resumed.
+	 *
+	 * @return
+	 *	The number of times that OnModeOfPlayStart() has been invoked.
+	 */
+	FORCEINLINE int32 GetNumModeOfPlayStarts() const
+	{
+		return this->NumModeOfPlayStarts;
+	}
+
+	/**
+	 * Gets the index of the characters in the encounter by state.
+	 *
+	 * @return
+	 *	The character state index.
+	 */
+	FORCEINLINE const FPF2EncounterCharacterStateIndex& GetCharacterStateIndex() const
+	{
+		return this->GetCharacterStates();
+	}
+
+	/**
+	 * Gets the unconscious condition tag that this rule set reacts to.
+	 *
+	 * @return
+	 *	The unconscious condition tag.
+	 */
+	FORCEINLINE const FGameplayTag& GetUnconsciousTag() const
+	{
+		return this->UnconsciousConditionTag;
+	}
+
+	/**
+	 * Determines whether this rule set has registered tag callbacks for the given character.
+	 *
+	 * @param Character
+	 *	The character of interest.
+	 *
+	 * @return
+	 *	- true if tag callbacks are registered for the character.
+	 *	- false if tag callbacks are not registered for the character.
+	 */
+	bool IsTrackingCharacter(const TScriptInterface<IPF2CharacterInterface>& Character) const;
+
+	/**
+	 * Gets the slot that the given character occupies in the tag callback table of this rule set.
+	 *
+	 * @param Character
+	 *	The character of interest.
+	 *
+	 * @return
+	 *	The character index of the character; or, INDEX_NONE if tag callbacks are not registered for the character.
+	 */
+	int32 GetTagCallbackSlot(const TScriptInterface<IPF2CharacterInterface>& Character) const;
+
+	/**
+	 * Gets the number of slots in the tag callback table of this rule set, including empty slots.
+	 *
+	 * @return
+	 *	The number of character slots in the tag callback table.
+	 */
+	FORCEINLINE int32 GetNumTagCallbackSlots() const
+	{
+		return this->TagCallbackCharacters.Num();
+	}
+
+	/**
+	 * Adds several characters to the encounter as a single batch.
+	 *
+	 * @param Characters
+	 *	The characters to add.
+	 */
+	void AddCharactersToEncounter(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters);
+
+	/**
+	 * Removes several characters from the encounter as a single batch.
+	 *
+	 * @param Characters
+	 *	The characters to remove.
+	 */
+	void RemoveCharactersFromEncounter(const TArray<TScriptInterface<IPF2CharacterInterface>>& Characters);
+
+	/**
+	 * Makes the given character the character whose turn it is, without any of the other effects of starting a turn.
+	 *
+	 * @param Character
+	 *	The character to make the active character.
+	 */
+	void MakeActiveCharacter(const TScriptInterface<IPF2CharacterInterface>& Character);
+
+	/**
+	 * Plans the turns of all NPCs in the encounter, regardless of whether existing plans are current.
+	 */
+	void PlanTurns();
+
+	/**
+	 * Determines whether the turns that were last planned still reflect the state of the encounter.
+	 *
+	 * @return
+	 *	- true if the planned turns are current.
+	 *	- false if the turns need to be planned again.
+	 */
+	bool HasCurrentPlannedTurns() const;
+
+	// =================================================================================================================
+	// Public Methods - IPF2ModeOfPlayRuleSetInterface Implementation
+	// =================================================================================================================
+	virtual void OnModeOfPlayStart(const EPF2ModeOfPlayType ModeOfPlay) override;
+
+protected:
+	// =================================================================================================================
+	// Protected Methods - APF2ModeOfPlayRuleSetBase Overrides
+	// =================================================================================================================
+	virtual void Native_OnCharacterUnconscious(const TScriptInterface<IPF2CharacterInterface>& Character) override;
+};
@@ -0,0 +1,30 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayEffect.h>
+
+#include "PF2TestGameplayEffect.generated.h"
+
+/**
+ * A fake, infinite-duration Gameplay Effect for use in testing logic that manages passive GEs.
+ *
+ * This GE has no modifiers or tag requirements, so it does not depend on any tags.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestGameplayEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for UPF2TestGameplayEffect.
+	 */
+	explicit UPF2TestGameplayEffect();
+};
@@ -0,0 +1,181 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Items/PF2InventoryComponent.h"
+
+#include "PF2TestInventoryComponent.generated.h"
+
+// =====================================================================================================================
+// Forward Declarations (to minimize header dependencies)
+// =====================================================================================================================
+class UPF2TestItem;
+
+// =====================================================================================================================
+// Normal Declarations
+// =====================================================================================================================
+/**
+ * An inventory component that loads items from memory instead of the asset manager and records the events it fires.
+ *
+ * Loads do not complete until CompletePendingLoads() is called, so tests can control when replicated items finish
+ * loading on a client.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestInventoryComponent : public UPF2InventoryComponent
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The items that this component can "load", in place of item assets.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UPF2TestItem>> LoadableItems;
+
+	/**
+	 * The IDs of the items requested by each call to LoadItemsById(), in the order that the calls were made.
+	 */
+	TArray<TArray<FPrimaryAssetId>> LoadRequests;
+
+	/**
+	 * The completion delegates of the loads that have been requested but have not yet completed.
+	 */
+	TArray<FStreamableDelegate> PendingLoadCompletions;
+
+	/**
+	 * A description of each event that this component has fired, in the order they were fired.
+	 *
+	 * Each entry is "Added:", "Removed:", followed by the name of the primary asset of the item; or, "Changed".
+	 */
+	TArray<FString> RecordedEvents;
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Gets the IDs of the items requested by each load that this component has started.
+	 *
+	 * @return
+	 *	The IDs of the items requested by each load, in the order that the loads were started.
+	 */
+	FORCEINLINE const TArray<TArray<FPrimaryAssetId>>& GetLoadRequests() const
+	{
+		return this->LoadRequests;
+	}
+
+	/**
+	 * Gets a description of each event that this component has fired since StartRecordingEvents() was called.
+	 *
+	 * @return
+	 *	The recorded events, in the order they were fired.
+	 */
+	FORCEINLINE const TArray<FString>& GetRecordedEvents() const
+	{
+		return this->RecordedEvents;
+	}
+
+	/**
+	 * Begins recording each event that this component fires.
+	 */
+	void StartRecordingEvents();
+
+	/**
+	 * Creates an item that this component can load, having the given ID.
+	 *
+	 * @param ItemId
+	 *	The primary asset ID of the item.
+	 */
+	void AddLoadableItem(const FPrimaryAssetId& ItemId);
+
+	/**
+	 * Adds an entry for an item that has not yet been loaded, as replication does on a client.
+	 *
+	 * OnRep_InventoryItemAdded() is not invoked; callers are expected to invoke it themselves.
+	 *
+	 * @param ItemId
+	 *	The primary asset ID of the item.
+	 *
+	 * @return
+	 *	The replication ID of the new entry.
+	 */
+	int32 AddReplicatedEntry(const FPrimaryAssetId& ItemId);
+
+	/**
+	 * Removes the entry for the given item, as replication does on a client.
+	 *
+	 * OnRep_InventoryItemRemoved() is not invoked; callers are expected to invoke it themselves beforehand.
+	 *
+	 * @param ItemId
+	 *	The primary asset ID of the item.
+	 */
+	void RemoveReplicatedEntry(const FPrimaryAssetId& ItemId);
+
+	/**
+	 * Finds the entry that has the given replication ID.
+	 *
+	 * @param ReplicationId
+	 *	The replication ID of the entry.
+	 *
+	 * @return
+	 *	The entry; or, nullptr if there is no entry having the given replication ID.
+	 */
+	FPF2InventoryItemEntry* FindReplicatedEntry(const int32 ReplicationId);
+
+	/**
+	 * Completes all of the loads that have been requested but have not yet completed.
+	 */
+	void CompletePendingLoads();
+
+protected:
+	// =================================================================================================================
+	// Protected Methods - UPF2InventoryComponent Overrides
+	// =================================================================================================================
+	virtual void LoadItemsById(const TArray<FPrimaryAssetId>& ItemAssetIds,
+	                           const FStreamableDelegate&     CompletionDelegate,
+	                           const TArray<FName>&           BundlesToLoad = TArray<FName>()) override;
+
+	virtual TScriptInterface<IPF2ItemInterface> GetLoadedItemById(const FPrimaryAssetId& ItemAssetId) const override;
+
+	// =================================================================================================================
+	// Protected Event Callbacks
+	// =================================================================================================================
+	/**
+	 * Records that the contents of this inventory changed.
+	 *
+	 * @param InventoryComponent
+	 *	The component broadcasting this event.
+	 */
+	UFUNCTION()
+	void RecordInventoryChanged(const TScriptInterface<IPF2InventoryInterface>& InventoryComponent);
+
+	/**
+	 * Records that an item was added to this inventory.
+	 *
+	 * @param InventoryComponent
+	 *	The component broadcasting this event.
+	 * @param InventoryItem
+	 *	The item that was added.
+	 */
+	UFUNCTION()
+	void RecordItemAdded(const TScriptInterface<IPF2InventoryInterface>& InventoryComponent,
+	                     const TScriptInterface<IPF2ItemInterface>&      InventoryItem);
+
+	/**
+	 * Records that an item was removed from this inventory.
+	 *
+	 * @param InventoryComponent
+	 *	The component broadcasting this event.
+	 * @param InventoryItem
+	 *	The item that was removed.
+	 */
+	UFUNCTION()
+	void RecordItemRemoved(const TScriptInterface<IPF2InventoryInterface>& InventoryComponent,
+	                       const TScriptInterface<IPF2ItemInterface>&      InventoryItem);
+};
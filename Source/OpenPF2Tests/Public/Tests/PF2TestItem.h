@@ -0,0 +1,48 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Items/PF2Item.h"
+
+#include "PF2TestItem.generated.h"
+
+/**
+ * A fake item that can be created at runtime with any primary asset ID, for testing inventory logic without assets.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestItem : public UPF2Item
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The ID that this item reports as its primary asset ID.
+	 */
+	FPrimaryAssetId ItemId;
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Sets the ID that this item reports as its primary asset ID.
+	 *
+	 * @param NewItemId
+	 *	The new ID of this item.
+	 */
+	FORCEINLINE void SetItemId(const FPrimaryAssetId& NewItemId)
+	{
+		this->ItemId = NewItemId;
+	}
+
+	// =================================================================================================================
+	// Public Methods - IPF2ItemInterface Implementation
+	// =================================================================================================================
+	virtual FPrimaryAssetId GetPrimaryAssetId() override;
+};
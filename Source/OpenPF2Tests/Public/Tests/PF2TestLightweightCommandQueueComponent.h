@@ -0,0 +1,42 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Commands/PF2CommandQueueComponent.h"
+
+#include "PF2TestLightweightCommandQueueComponent.generated.h"
+
+/**
+ * A command queue component that has lightweight replication enabled, for testing the lightweight queue.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestLightweightCommandQueueComponent : public UPF2CommandQueueComponent
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for UPF2TestLightweightCommandQueueComponent.
+	 */
+	explicit UPF2TestLightweightCommandQueueComponent();
+
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Sets the maximum number of commands that can be in the queue at one time.
+	 *
+	 * @param NewSizeLimit
+	 *	The new size limit, or CommandLimitNone for no limit.
+	 */
+	FORCEINLINE void SetSizeLimit(const uint8 NewSizeLimit)
+	{
+		this->SizeLimit = NewSizeLimit;
+	}
+};
@@ -0,0 +1,61 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "PF2PlayerControllerBase.h"
+
+#include "Commands/PF2CharacterCommandDescriptor.h"
+
+#include "PF2TestPlayerController.generated.h"
+
+/**
+ * A player controller that records the commands it executes instead of issuing them to characters, for testing.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API APF2TestPlayerController : public APF2PlayerControllerBase
+{
+	GENERATED_BODY()
+
+protected:
+	// =================================================================================================================
+	// Protected Fields
+	// =================================================================================================================
+	/**
+	 * The commands that this player controller has executed, in the order they were executed.
+	 */
+	TArray<FPF2CharacterCommandDescriptor> ExecutedCommands;
+
+public:
+	// =================================================================================================================
+	// Public Methods
+	// =================================================================================================================
+	/**
+	 * Invokes the server-side logic of Server_ExecuteCharacterCommands() directly, bypassing RPC validation.
+	 *
+	 * @param Commands
+	 *	Descriptions of the commands to execute.
+	 */
+	void ExecuteCharacterCommands(const TArray<FPF2CharacterCommandDescriptor>& Commands);
+
+	/**
+	 * Gets the commands that this player controller has executed, in the order they were executed.
+	 *
+	 * @return
+	 *	The executed commands.
+	 */
+	FORCEINLINE const TArray<FPF2CharacterCommandDescriptor>& GetExecutedCommands() const
+	{
+		return this->ExecutedCommands;
+	}
+
+protected:
+	// =================================================================================================================
+	// Protected Methods - APF2PlayerControllerBase Overrides
+	// =================================================================================================================
+	virtual void ExecuteAbilitySpecAsCharacterCommand(AActor*                          CharacterActor,
+	                                                  const FGameplayAbilitySpecHandle AbilitySpecHandle,
+	                                                  const FGameplayEventData&        AbilityPayload) override;
+};
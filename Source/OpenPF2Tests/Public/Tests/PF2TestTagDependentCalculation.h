@@ -0,0 +1,45 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayModMagnitudeCalculation.h>
+
+#include "CharacterStats/PF2TagDependentCalculationInterface.h"
+
+#include "PF2TestTagDependentCalculation.generated.h"
+
+/**
+ * A fake Modifier Magnitude Calculation (MMC) that returns 1 if the target has a particular tag, or 0 if it does not.
+ *
+ * The calculation declares the tag it checks for through IPF2TagDependentCalculationInterface, so that it can be used
+ * to test logic that re-applies passive GEs when the tags they depend on change.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestTagDependentCalculation :
+	public UGameplayModMagnitudeCalculation,
+	public IPF2TagDependentCalculationInterface
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Constants
+	// =================================================================================================================
+	/**
+	 * The name of the tag that this calculation checks for on the target.
+	 */
+	static const FName QueriedTagName;
+
+	// =================================================================================================================
+	// Public Methods - UGameplayModMagnitudeCalculation Overrides
+	// =================================================================================================================
+	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
+
+	// =================================================================================================================
+	// Public Methods - IPF2TagDependentCalculationInterface Implementation
+	// =================================================================================================================
+	virtual FGameplayTagContainer GetQueriedTags() const override;
+};
@@ -0,0 +1,31 @@
+﻿// OpenPF2 Game Framework for Unreal Engine, Copyright 2024, Guy Elsmore-Paddock. All Rights Reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <GameplayEffect.h>
+
+#include "PF2TestTagDependentGameplayEffect.generated.h"
+
+/**
+ * A fake, infinite-duration Gameplay Effect whose only modifier depends on a tag of the target.
+ *
+ * The modifier uses UPF2TestTagDependentCalculation, so this GE depends only on the tag that calculation checks for.
+ * This is used to test logic that re-applies passive GEs when the tags they depend on change.
+ */
+UCLASS(notplaceable)
+class OPENPF2TESTS_API UPF2TestTagDependentGameplayEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	// =================================================================================================================
+	// Public Constructors
+	// =================================================================================================================
+	/**
+	 * Default constructor for UPF2TestTagDependentGameplayEffect.
+	 */
+	explicit UPF2TestTagDependentGameplayEffect();
+};